@@ -111,8 +111,20 @@ namespace IBTK
  skip_relax = 1                 // see hypre User's Manual (only used by PFMG solver or
  preconditioner)
  two_norm = 1                   // see hypre User's Manual (only used by PCG solver)
+ setup_reuse_tol = -1.0         // relative change in constant C and D below which the hypre
+ solver setup is reused (negative values disable reuse)
  \endverbatim
  *
+ * The hypre grid, stencil, matrix, and vector objects are retained when the
+ * solver state is deallocated.  If initializeSolverState() is subsequently
+ * called on a patch level with the same boxes and processor mapping, these
+ * objects are reused and only the matrix values are recomputed.  The hypre
+ * solver setup is recomputed as well unless \f$C\f$ and \f$D\f$ are constant
+ * and differ from the values used in the last setup by less than
+ * setup_reuse_tol (relative to those values).  A reused setup retains the
+ * coarse-grid operators of the previous setup, so that only the fine-grid
+ * matrix reflects the new coefficients.
+ *
  * \em hypre is developed in the Center for Applied Scientific Computing (CASC)
  * at Lawrence Livermore National Laboratory (LLNL).  For more information about
  * \em hypre, see <A
@@ -240,6 +252,14 @@ public:
      */
     void deallocateSolverState() override;
 
+    /*!
+     * \brief Update the solver to use new problem coefficients.
+     *
+     * The hypre grid, stencil, matrix, and vector objects are reused; only the
+     * matrix values and the hypre solver setup are recomputed.
+     */
+    bool updateProblemCoefficients() override;
+
     //\}
 
 private:
@@ -277,6 +297,7 @@ private:
     void allocateHypreData();
     void setMatrixCoefficients_aligned();
     void setMatrixCoefficients_nonaligned();
+    void setMatrixCoefficients();
     void setupHypreSolver();
     bool solveSystem(int x_idx, int b_idx);
     void copyToHypre(const std::vector<HYPRE_StructVector>& vectors,
@@ -288,6 +309,12 @@ private:
     void destroyHypreSolver();
     void deallocateHypreData();
 
+    /*!
+     * \brief Determine whether the current hypre solver setup may be used with
+     * the current problem coefficients.
+     */
+    bool canReuseHypreSolverSetup() const;
+
     /*!
      * \brief Associated hierarchy.
      */
@@ -326,6 +353,20 @@ private:
     int d_skip_relax = 1;
     int d_two_norm = 1;
     //\}
+
+    /*!
+     * \name Data used to reuse hypre objects across reinitializations.
+     */
+    //\{
+    bool d_hypre_data_allocated = false;
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hypre_hierarchy;
+    int d_hypre_level_num = IBTK::invalid_level_number;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_hypre_level_boxes;
+    std::vector<int> d_hypre_level_mapping;
+    double d_setup_reuse_tol = -1.0;
+    bool d_setup_coefs_constant = false;
+    double d_setup_C = 0.0, d_setup_D = 0.0;
+    //\}
 };
 } // namespace IBTK
 
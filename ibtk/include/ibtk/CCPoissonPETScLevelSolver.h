@@ -88,6 +88,10 @@ namespace IBTK
  abs_residual_tol = 1.0e-50    // see setAbsoluteTolerance()
  max_iterations = 10000        // see setMaxIterations()
  enable_logging = FALSE        // see setLoggingEnabled()
+ agglomeration_reduction_factor = 1  // factor by which to reduce the number of
+ processes that solve the level system (1 disables agglomeration)
+ agglomeration_pc_type = "lu"  // preconditioner used on the reduced set of
+ processes
  \endverbatim
  *
  * PETSc is developed at the Argonne National Laboratory Mathematics and
@@ -137,6 +141,12 @@ protected:
      */
     void deallocateSolverStateSpecialized() override;
 
+    /*!
+     * \brief Reset the matrix values to correspond to the current problem
+     * coefficients.
+     */
+    bool updateSolverStateSpecialized() override;
+
     /*!
      * \brief Copy a generic vector to the PETSc representation.
      */
@@ -91,6 +91,7 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 1             // see setCoarseSolverMaxIterations()
+ ghost_fill_interval = 1                      // see setGhostFillInterval()
  coarse_solver_db {                           // SAMRAI::tbox::Database for initializing coarse
  level solver
     solver_type = "PFMG"
@@ -147,6 +148,37 @@ public:
      */
     void setCoarseSolverType(const std::string& coarse_solver_type) override;
 
+    /*!
+     * \brief Specify the number of red-black half-sweeps to perform between
+     * ghost cell exchanges.
+     *
+     * When the interval \f$ k \f$ is larger than one and the \c
+     * "RED_BLACK_GAUSS_SEIDEL" smoother is used with a constant diffusion
+     * coefficient, the smoother copies the error and residual into scratch
+     * data with \f$ k \f$ ghost cells and exchanges ghost cell values only
+     * once every \f$ k \f$ half-sweeps.  In between exchanges, each patch
+     * redundantly smooths the part of its ghost cell region that is covered by
+     * the patch level, with the width of that region shrinking by one cell per
+     * half-sweep.  Physical boundary and coarse-fine interface ghost cell
+     * values are still recomputed locally before every half-sweep.
+     *
+     * This trades some redundant computation for a factor of \f$ k \f$ fewer
+     * ghost cell exchanges.  Away from physical boundaries and coarse-fine
+     * interfaces the result is identical to exchanging ghost cell values
+     * before every half-sweep; near such boundaries, the redundantly smoothed
+     * values may lag the values computed by the patches that own them.
+     *
+     * On patches whose deep ghost cell region is entirely covered by the patch
+     * level, the \f$ k \f$ half-sweeps between exchanges are additionally
+     * fused into a single wavefront pass over the patch data, so that each
+     * cell is loaded from memory once per block of half-sweeps rather than
+     * once per half-sweep.
+     *
+     * \note This function may not be called while the operator state is
+     * initialized.
+     */
+    void setGhostFillInterval(int ghost_fill_interval);
+
     //\}
 
     /*!
@@ -202,6 +234,14 @@ public:
                          int coarsest_level_num,
                          int finest_level_num) override;
 
+    /*!
+     * \brief Update the operator to use new problem coefficients.
+     *
+     * The smoothers and the residual computation use the problem coefficients
+     * directly, so only the coarse level solver needs to be updated.
+     */
+    bool updateProblemCoefficients() override;
+
     //\}
 
 protected:
@@ -246,6 +286,15 @@ private:
      */
     CCPoissonPointRelaxationFACOperator& operator=(const CCPoissonPointRelaxationFACOperator& that) = delete;
 
+    /*!
+     * \brief Perform red-black Gauss-Seidel sweeps using deep ghost cell
+     * regions that are exchanged once every d_ghost_fill_interval half-sweeps.
+     */
+    void smoothErrorWithDeepHalo(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& error,
+                                 const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& residual,
+                                 int level_num,
+                                 int num_sweeps);
+
     /*
      * Coarse level solvers and solver parameters.
      */
@@ -257,6 +306,28 @@ private:
      */
     std::vector<std::vector<SAMRAI::hier::BoxList<NDIM> > > d_patch_bc_box_overlap;
     std::vector<std::vector<std::map<int, SAMRAI::hier::Box<NDIM> > > > d_patch_neighbor_overlap;
+
+    /*
+     * Communication-avoiding smoother data: the number of half-sweeps between
+     * ghost cell exchanges, scratch data with correspondingly wide ghost cell
+     * regions, and the refine schedules used to fill those ghost cells.
+     */
+    int d_ghost_fill_interval = 1;
+    int d_deep_error_idx = IBTK::invalid_index, d_deep_residual_idx = IBTK::invalid_index;
+    SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > d_deep_error_fill_alg, d_deep_error_residual_fill_alg;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_deep_error_fill_scheds,
+        d_deep_error_residual_fill_scheds;
+
+    /*
+     * For each patch, the parts of the deep ghost cell region that are
+     * redundantly smoothed, the ghost cells that lie along physical boundaries
+     * or coarse-fine interfaces, and whether the deep ghost cell region is
+     * entirely covered by the level (in which case the half-sweeps between
+     * ghost cell exchanges are fused into a single pass over the patch).
+     */
+    std::vector<std::vector<SAMRAI::hier::BoxList<NDIM> > > d_patch_deep_halo_boxes;
+    std::vector<std::vector<SAMRAI::hier::BoxList<NDIM> > > d_patch_bdry_ghost_boxes;
+    std::vector<std::vector<bool> > d_patch_deep_halo_is_interior;
 };
 } // namespace IBTK
 
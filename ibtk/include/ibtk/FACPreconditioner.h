@@ -201,6 +201,12 @@ public:
      */
     void deallocateSolverState() override;
 
+    /*!
+     * \brief Update the solver to use new problem coefficients via
+     * FACPreconditionerStrategy::updateProblemCoefficients().
+     */
+    bool updateProblemCoefficients() override;
+
     //\}
 
     /*!
@@ -202,6 +202,19 @@ public:
      */
     virtual void deallocateOperatorState();
 
+    /*!
+     * \brief Update the hierarchy-dependent data initialized by
+     * initializeOperatorState() to reflect new problem coefficients, without
+     * reconstructing data that depend only on the patch hierarchy
+     * configuration.
+     *
+     * \return true if the operator state was updated, or false if the
+     * operator state must instead be reinitialized.
+     *
+     * \note The default implementation returns false.
+     */
+    virtual bool updateProblemCoefficients();
+
     /*!
      * \brief Allocate scratch data.
      */
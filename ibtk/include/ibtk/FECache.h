@@ -16,6 +16,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <ibtk/HashedLRUCache.h>
 #include <ibtk/QuadratureCache.h>
 
 #include <tbox/Utilities.h>
@@ -26,7 +27,7 @@
 #include <libmesh/enum_quadrature_type.h>
 #include <libmesh/fe.h>
 
-#include <map>
+#include <cstddef>
 #include <memory>
 #include <tuple>
 
@@ -139,9 +140,15 @@ operator&=(FEUpdateFlags& f1, const FEUpdateFlags f2)
  * one FE object for each quadrature rule instead of constantly recomputing,
  * e.g., shape function values.
  *
- * This class essentially provides a wrapper around std::map to manage FE
+ * This class essentially provides a wrapper around a hash table to manage FE
  * objects and the quadrature rules they use. The keys are descriptions of
- * quadrature rules.
+ * quadrature rules. With adaptive quadrature the number of distinct rules
+ * seen over a long simulation can become large, so the number of stored FE
+ * objects may optionally be bounded: in that case the least recently used FE
+ * object is discarded when a new one is needed and references returned by
+ * <code>operator()</code> are only valid until the next call. Quadrature rules
+ * are small and are always kept, since discarded FE objects may still be
+ * recreated later with the same rule.
  */
 class FECache
 {
@@ -169,8 +176,14 @@ public:
      *
      * @param flags FEUpdateFlags indicating which values should be calculated
      * by each libMesh::FEBase object.
+     *
+     * @param max_size The maximum number of stored FE objects. Zero (the
+     * default) means that the cache is unbounded.
      */
-    FECache(const unsigned int dim, const libMesh::FEType& fe_type, const FEUpdateFlags flags);
+    FECache(const unsigned int dim,
+            const libMesh::FEType& fe_type,
+            const FEUpdateFlags flags,
+            const std::size_t max_size = 0);
 
     /**
      * Return a reference to an FE object that matches the specified
@@ -194,6 +207,17 @@ public:
      */
     libMesh::FEType getFEType() const;
 
+    /**
+     * Set the maximum number of stored FE objects. Zero means that the cache
+     * is unbounded.
+     */
+    void setMaxSize(const std::size_t max_size);
+
+    /**
+     * Return the hit, miss, and eviction counts of the cache.
+     */
+    const CacheStatistics& getStatistics() const;
+
 protected:
     /**
      * Dimension of the FE mesh.
@@ -219,11 +243,14 @@ protected:
     /**
      * Managed libMesh::FE objects of specified dimension and family.
      */
-    std::map<key_type, std::unique_ptr<libMesh::FEBase> > d_fes;
+    HashedLRUCache<key_type, libMesh::FEBase, QuadratureKeyHash> d_fes;
 };
 
-inline FECache::FECache(const unsigned int dim, const libMesh::FEType& fe_type, const FEUpdateFlags flags)
-    : d_dim(dim), d_fe_type(fe_type), d_update_flags(flags), d_quadrature_cache(d_dim)
+inline FECache::FECache(const unsigned int dim,
+                        const libMesh::FEType& fe_type,
+                        const FEUpdateFlags flags,
+                        const std::size_t max_size)
+    : d_dim(dim), d_fe_type(fe_type), d_update_flags(flags), d_quadrature_cache(d_dim), d_fes(max_size)
 {
 }
 
@@ -239,17 +266,29 @@ FECache::getFEType() const
     return d_fe_type;
 }
 
+inline void
+FECache::setMaxSize(const std::size_t max_size)
+{
+    d_fes.setMaxSize(max_size);
+}
+
+inline const CacheStatistics&
+FECache::getStatistics() const
+{
+    return d_fes.getStatistics();
+}
+
 inline FECache::value_type&
 FECache::operator()(const FECache::key_type& quad_key, const libMesh::Elem* elem)
 {
 #ifndef NDEBUG
     TBOX_ASSERT(elem->type() == std::get<0>(quad_key));
 #endif
-    auto it = d_fes.find(quad_key);
-    if (it == d_fes.end())
+    libMesh::FEBase* cached_fe = d_fes.find(quad_key);
+    if (cached_fe == nullptr)
     {
         libMesh::QBase& quad = d_quadrature_cache[quad_key];
-        libMesh::FEBase& fe = *(*d_fes.emplace(quad_key, libMesh::FEBase::build(d_dim, d_fe_type)).first).second;
+        libMesh::FEBase& fe = d_fes.insert(quad_key, libMesh::FEBase::build(d_dim, d_fe_type));
         fe.attach_quadrature_rule(&quad);
 
         if (d_update_flags & FEUpdateFlags::update_phi) fe.get_phi();
@@ -261,7 +300,7 @@ FECache::operator()(const FECache::key_type& quad_key, const libMesh::Elem* elem
     }
     else
     {
-        libMesh::FEBase& fe = *(it->second);
+        libMesh::FEBase& fe = *cached_fe;
         // TODO: we need better reinitialization logic than hardcoding in
         // libMesh element types.
         //
@@ -36,6 +36,7 @@ IBTK_DISABLE_EXTRA_WARNINGS
 IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <limits>
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -306,6 +307,17 @@ public:
      */
     void collectDataForInterpolation(const libMesh::Elem* elem);
 
+    /*!
+     * \brief Collect element data from read-only arrays of the local forms of the system vectors that the caller has
+     * already retrieved (e.g., with PetscVector::get_array_read()) instead of retrieving and restoring the arrays for
+     * every element. The map must contain an entry for the vector of every registered system.
+     *
+     * NOTE: This makes it possible for several threads, each with its own FEDataInterpolation object, to collect
+     * data at the same time, provided that the DOF map caches already contain the elements. This method must be
+     * called after init().
+     */
+    void setLocalSolutionArrays(const std::map<const libMesh::NumericVector<double>*, const double*>& local_solns);
+
     /*!
      * \brief Provide the elemental data associated with the given system index and element.
      */
@@ -353,6 +365,7 @@ private:
     std::vector<std::vector<int> > d_system_all_vars, d_system_vars, d_system_grad_vars;
     std::vector<std::vector<size_t> > d_system_var_idx, d_system_grad_var_idx;
     std::vector<libMesh::NumericVector<double>*> d_system_vecs;
+    std::vector<const double*> d_system_local_solns;
     std::vector<std::vector<size_t> > d_system_var_fe_type_idx, d_system_grad_var_fe_type_idx;
     std::vector<std::vector<std::vector<double> > > d_system_var_data;
     std::vector<std::vector<std::vector<libMesh::VectorValue<double> > > > d_system_grad_var_data;
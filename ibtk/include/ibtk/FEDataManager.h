@@ -18,6 +18,7 @@
 
 #include "ibtk/QuadratureCache.h"
 #include "ibtk/SAMRAIDataCache.h"
+#include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_macros.h"
 #include "ibtk/ibtk_utilities.h"
 
@@ -126,17 +127,21 @@ public:
         /*!
          * Alternative indexing operation: retrieve all dof indices of all
          * variables in the given system at once by reference.
+         *
+         * Looking up an element that is already in the cache does not
+         * modify the cache, so several threads may look up elements at once
+         * once the cache has been populated (e.g., by calling this function
+         * on every element from a single thread).
          */
         inline const std::vector<std::vector<libMesh::dof_id_type> >& dof_indices(const libMesh::Elem* const elem)
         {
+            const auto it = d_dof_cache.find(elem->id());
+            if (it != d_dof_cache.end()) return it->second;
             std::vector<std::vector<libMesh::dof_id_type> >& elem_dof_indices = d_dof_cache[elem->id()];
-            if (elem_dof_indices.empty())
+            elem_dof_indices.resize(d_dof_map.n_variables());
+            for (unsigned int var_n = 0; var_n < d_dof_map.n_variables(); ++var_n)
             {
-                elem_dof_indices.resize(d_dof_map.n_variables());
-                for (unsigned int var_n = 0; var_n < d_dof_map.n_variables(); ++var_n)
-                {
-                    d_dof_map.dof_indices(elem, elem_dof_indices[var_n], var_n);
-                }
+                d_dof_map.dof_indices(elem, elem_dof_indices[var_n], var_n);
             }
             return elem_dof_indices;
         }
@@ -194,6 +199,18 @@ public:
      */
     SystemDofMapCache* getDofMapCache(unsigned int system_num);
 
+    /*!
+     * \brief Set the maximum number of entries stored in each of the
+     * quadrature, FE, and Jacobian caches used with this FEData object. Zero
+     * (the default) means that the caches are unbounded.
+     */
+    void setCacheMaxSize(std::size_t max_size);
+
+    /*!
+     * \brief Get the maximum number of entries stored in each cache.
+     */
+    std::size_t getCacheMaxSize() const;
+
     /*!
      * Clear all cached (i.e., computed at first request and then stored for
      * future calls) data that depends on the Eulerian data partitioning.
@@ -229,6 +246,12 @@ protected:
      */
     QuadratureCache d_quadrature_cache;
 
+    /*!
+     * Maximum number of entries stored in each cache. Zero means that the
+     * caches are unbounded.
+     */
+    std::size_t d_cache_max_size = 0;
+
     /*!
      * Number of the level on which the equation systems live.
      */
@@ -262,7 +285,12 @@ protected:
  * work on the Eulerian cell itself and a weight times the number of
  * quadrature points on that cell. These values are set at the time of object
  * construction through the FEDataManager::WorkloadSpec object, which contains
- * reasonable defaults.
+ * reasonable defaults. All weights are relative to the work done on one
+ * Eulerian cell, which is always one. Quadrature points on different element
+ * types may be assigned different relative costs through
+ * FEDataManager::WorkloadSpec::elem_type_q_point_weights. The weights may be
+ * changed later (e.g., after measuring the actual cost of the IBFE
+ * calculations) by FEDataManager::setWorkloadSpec.
  *
  * \note Multiple FEDataManager objects may be instantiated simultaneously.
  */
@@ -350,6 +378,11 @@ public:
     {
         /// The multiplier applied to each quadrature point.
         double q_point_weight = 1.0;
+
+        /// Relative costs of quadrature points on particular element types,
+        /// which are multiplied by q_point_weight. Element types not in this
+        /// map have a relative cost of one. Relative costs must be positive.
+        std::map<libMesh::ElemType, double> elem_type_q_point_weights;
     };
 
 protected:
@@ -492,6 +525,25 @@ public:
      */
     bool getLoggingEnabled() const;
 
+    /*!
+     * \brief Set the parameters used in subsequent workload calculations.
+     */
+    void setWorkloadSpec(const WorkloadSpec& workload_spec);
+
+    /*!
+     * \brief Get the parameters used in workload calculations.
+     */
+    const WorkloadSpec& getWorkloadSpec() const;
+
+    /*!
+     * \brief Set the maximum number of entries stored in each of the
+     * quadrature, FE, and Jacobian caches used by this object. Zero means
+     * that the caches are unbounded.
+     *
+     * @note The cache size is stored in the (possibly shared) FEData object.
+     */
+    void setCacheMaxSize(std::size_t max_size);
+
     /*!
      * \brief Register a load balancer for non-uniform load balancing.
      *
@@ -856,6 +908,12 @@ public:
                              double tol = 1.0e-6,
                              unsigned int max_its = 100);
 
+    /*!
+     * \brief Set the method used to solve consistent mass matrix L2
+     * projections. See FEProjector::setL2ProjectionSolverType().
+     */
+    void setL2ProjectionSolverType(L2ProjectionSolverType solver_type);
+
     /*!
      * Update the quarature rule for the current element.  If the provided
      * qrule is already configured appropriately, it is not modified.
@@ -913,6 +971,15 @@ public:
                              const int coarsest_ln = -1,
                              const int finest_ln = -1);
 
+    /*!
+     * \brief Compute the sum, over all processors, of the values that
+     * addWorkloadEstimate would add for the current configuration of the
+     * structure.
+     *
+     * @note This is a collective operation.
+     */
+    double computeTotalQuadPointWorkload();
+
     /*!
      * Set integer tags to "one" in cells where refinement of the given level
      * should occur due to the presence of Lagrangian data.  The double time
@@ -1175,7 +1242,7 @@ private:
     /*!
      * The default parameters used during workload calculations.
      */
-    const WorkloadSpec d_default_workload_spec;
+    WorkloadSpec d_default_workload_spec;
 
     /*!
      * The default kernel functions and quadrature rule used to mediate
@@ -16,6 +16,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <ibtk/HashedLRUCache.h>
 #include <ibtk/QuadratureCache.h>
 #include <ibtk/libmesh_utilities.h>
 
@@ -26,7 +27,7 @@
 #include <libmesh/fe_map.h>
 #include <libmesh/quadrature.h>
 
-#include <map>
+#include <cstddef>
 #include <memory>
 #include <tuple>
 
@@ -47,9 +48,11 @@ namespace IBTK
  * values) and FEMap (which compute Jacobians) objects separately and only
  * call <code>reinit</code> on the appropriate object when necessary.
  *
- * This class essentially provides a wrapper around std::map to manage FEMap
- * objects and the quadrature rules they use. The keys are descriptions of
- * quadrature rules.
+ * This class essentially provides a wrapper around a hash table to manage
+ * FEMap objects and the quadrature rules they use. The keys are descriptions
+ * of quadrature rules. The number of stored FEMap objects may optionally be
+ * bounded, in which case the least recently used object is discarded when a
+ * new one is needed.
  *
  * @note At the present time the only values accessible through the FEMap
  * objects stored by this class are the Jacobians and JxW values: no second
@@ -76,8 +79,11 @@ public:
      *
      * @param dim The topological dimension of the relevant libMesh::Mesh: see
      * libMesh::MeshBase::mesh_dimension() for more information.
+     *
+     * @param max_size The maximum number of stored FEMap objects. Zero (the
+     * default) means that the cache is unbounded.
      */
-    FEMapCache(const unsigned int dim);
+    FEMapCache(const unsigned int dim, const std::size_t max_size = 0);
 
     /**
      * Return a reference to an FEMap object that matches the specified
@@ -88,6 +94,23 @@ public:
      */
     libMesh::FEMap& operator[](const key_type& quad_key);
 
+    /**
+     * Set the maximum number of stored FEMap objects. Zero means that the
+     * cache is unbounded.
+     */
+    void setMaxSize(const std::size_t max_size)
+    {
+        d_fe_maps.setMaxSize(max_size);
+    }
+
+    /**
+     * Return the hit, miss, and eviction counts of the cache.
+     */
+    const CacheStatistics& getStatistics() const
+    {
+        return d_fe_maps.getStatistics();
+    }
+
 protected:
     /**
      * Topological dimension of the FE mesh.
@@ -103,10 +126,11 @@ protected:
     /**
      * Managed libMesh::FEMap objects of specified dimension and family.
      */
-    std::map<key_type, libMesh::FEMap> d_fe_maps;
+    HashedLRUCache<key_type, libMesh::FEMap, QuadratureKeyHash> d_fe_maps;
 };
 
-inline FEMapCache::FEMapCache(const unsigned int dim) : d_dim(dim), d_quadrature_cache(d_dim)
+inline FEMapCache::FEMapCache(const unsigned int dim, const std::size_t max_size)
+    : d_dim(dim), d_quadrature_cache(d_dim), d_fe_maps(max_size)
 {
 }
 
@@ -114,11 +138,11 @@ inline libMesh::FEMap&
 FEMapCache::operator[](const FEMapCache::key_type& quad_key)
 {
     TBOX_ASSERT(static_cast<unsigned int>(get_dim(std::get<0>(quad_key))) == d_dim);
-    auto it = d_fe_maps.find(quad_key);
-    if (it == d_fe_maps.end())
+    libMesh::FEMap* cached_fe_map = d_fe_maps.find(quad_key);
+    if (cached_fe_map == nullptr)
     {
         libMesh::QBase& quad = d_quadrature_cache[quad_key];
-        libMesh::FEMap& fe_map = d_fe_maps[quad_key];
+        libMesh::FEMap& fe_map = d_fe_maps.insert(quad_key, std::unique_ptr<libMesh::FEMap>(new libMesh::FEMap()));
         // Calling this function enables JxW calculations
         fe_map.get_JxW();
 
@@ -151,7 +175,7 @@ FEMapCache::operator[](const FEMapCache::key_type& quad_key)
     }
     else
     {
-        return it->second;
+        return *cached_fe_map;
     }
 }
 } // namespace IBTK
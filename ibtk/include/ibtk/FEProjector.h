@@ -16,6 +16,8 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <ibtk/ibtk_enums.h>
+
 #include <libmesh/equation_systems.h>
 #include <libmesh/petsc_linear_solver.h>
 #include <libmesh/petsc_matrix.h>
@@ -23,6 +25,7 @@
 
 #include <map>
 #include <string>
+#include <utility>
 
 namespace IBTK
 {
@@ -36,6 +39,24 @@ namespace IBTK
 /*!
  * \brief Class FEProjector coordinates data structures for projecting
  * fields in FE models.
+ *
+ * The mass matrix of a system does not change while the mesh connectivity is
+ * fixed, so the way in which projections with a consistent mass matrix are
+ * computed can be selected with setL2ProjectionSolverType():
+ * <ul>
+ *   <li><code>L2_PROJECTION_KRYLOV</code> (the default) solves the system
+ *   with a Krylov method configured from the command line.</li>
+ *   <li><code>L2_PROJECTION_CHOLESKY</code> computes a sparse Cholesky
+ *   factorization of the mass matrix once and reuses it for every subsequent
+ *   projection. In parallel this requires PETSc to be configured with
+ *   MUMPS.</li>
+ *   <li><code>L2_PROJECTION_CHEBYSHEV</code> uses Chebyshev iteration
+ *   preconditioned by the lumped mass matrix. The eigenvalue bounds are
+ *   computed element by element and the number of iterations is chosen a
+ *   priori from the requested tolerance, so the iteration itself requires no
+ *   inner products. Convergence is determined by computing the residual
+ *   once after the last iteration.</li>
+ * </ul>
  */
 class FEProjector
 {
@@ -82,6 +103,18 @@ public:
                              double tol = 1.0e-6,
                              unsigned int max_its = 100);
 
+    /*!
+     * \brief Set the method used to solve the mass matrix system when a
+     * consistent mass matrix is requested.
+     */
+    void setL2ProjectionSolverType(L2ProjectionSolverType solver_type);
+
+    /*!
+     * \brief Get the method used to solve the mass matrix system when a
+     * consistent mass matrix is requested.
+     */
+    L2ProjectionSolverType getL2ProjectionSolverType() const;
+
     /*!
      * \brief Enable or disable logging.
      */
@@ -108,7 +141,37 @@ protected:
     /// Data structures for lumped (diagonal) mass matrices and related solvers.
     std::map<std::string, std::unique_ptr<libMesh::PetscVector<double> > > d_L2_proj_matrix_diag;
 
+    /// Bounds on the eigenvalues of the consistent mass matrix preconditioned
+    /// by the lumped mass matrix, used by the Chebyshev solver.
+    std::map<std::string, std::pair<double, double> > d_L2_proj_eigenvalue_bounds;
+
 private:
+    /*!
+     * Compute (or look up) bounds on the spectrum of the consistent mass
+     * matrix preconditioned by the lumped mass matrix. The bounds are the
+     * extreme eigenvalues of the corresponding generalized element eigenvalue
+     * problems.
+     */
+    std::pair<double, double> getLumpedMassEigenvalueBounds(const std::string& system_name);
+
+    /*!
+     * Solve the consistent mass matrix system with Chebyshev iteration.
+     *
+     * \return Whether or not the residual, computed after the last iteration
+     * and measured in the norm induced by the inverse of the lumped mass
+     * matrix, was reduced below @p tol relative to @p F.
+     */
+    bool solveChebyshev(libMesh::PetscVector<double>& U,
+                        libMesh::PetscVector<double>& F,
+                        const std::string& system_name,
+                        double tol,
+                        unsigned int max_its);
+
+    /*!
+     * The method used to solve the consistent mass matrix system.
+     */
+    L2ProjectionSolverType d_solver_type = L2_PROJECTION_KRYLOV;
+
     /*!
      * Whether or not to log data to the screen: see
      * FEProjector::setLoggingEnabled() and
@@ -18,6 +18,7 @@
 
 #include <ibtk/FECache.h>
 #include <ibtk/JacobianCalculator.h>
+#include <ibtk/ibtk_macros.h>
 
 #include <tbox/Utilities.h>
 
@@ -30,6 +31,11 @@
 #include <libmesh/point.h>
 #include <libmesh/quadrature.h>
 
+IBTK_DISABLE_EXTRA_WARNINGS
+#include <boost/multi_array.hpp>
+IBTK_ENABLE_EXTRA_WARNINGS
+
+#include <array>
 #include <map>
 #include <vector>
 
@@ -137,6 +143,167 @@ protected:
      */
     libMesh::ElemType d_last_elem_type = libMesh::ElemType::INVALID_ELEM;
 };
+
+/**
+ * Class like FEValues that evaluates mapping and shape function quantities on
+ * a batch of up to <code>width</code> elements of the same type at once. All
+ * computed quantities are stored with the element (i.e., lane) index varying
+ * fastest, so that the innermost loops run over the elements in the batch
+ * with unit stride and vectorize. This is intended for low-order elements,
+ * where the per-element work is too small to vectorize well on its own.
+ *
+ * A typical use is
+ * @code
+ * FEValuesBatch<NDIM> fe_batch(qrule, update_JxW | update_quadrature_points);
+ * std::vector<const libMesh::Elem*> elems = ...; // all of the same type
+ * for (std::size_t e = 0; e < elems.size(); e += fe_batch.batch_width)
+ * {
+ *     const unsigned int n_elems = std::min<std::size_t>(fe_batch.batch_width, elems.size() - e);
+ *     fe_batch.reinit(&elems[e], n_elems);
+ *     const auto& JxW = fe_batch.getJxW();
+ *     for (unsigned int q = 0; q < JxW.size(); ++q)
+ *         for (unsigned int lane = 0; lane < n_elems; ++lane)
+ *             do_something(elems[e + lane], q, JxW[q][lane]);
+ * }
+ * @endcode
+ *
+ * If fewer than <code>width</code> elements are provided then the remaining
+ * lanes are filled with copies of the last element.
+ *
+ * @tparam width Number of elements processed at once. This should usually be
+ * the number of doubles in a SIMD register (or a small multiple thereof).
+ */
+template <int dim, int spacedim = dim, unsigned int width = 4>
+class FEValuesBatch
+{
+public:
+    /**
+     * Number of elements in each batch.
+     */
+    static constexpr unsigned int batch_width = width;
+
+    /**
+     * A value for each element in the batch.
+     */
+    using LaneArray = std::array<double, width>;
+
+    FEValuesBatch(libMesh::QBase* qrule, const FEUpdateFlags update_flags);
+
+    /**
+     * Recompute values on the given elements, which must all have the same
+     * type.
+     */
+    void reinit(const libMesh::Elem* const* elems, const unsigned int n_elems);
+
+    /**
+     * Number of elements in the current batch.
+     */
+    inline unsigned int getNumberOfElements() const
+    {
+        return d_n_elems;
+    }
+
+    /**
+     * JxW values, indexed by quadrature point and then by lane.
+     */
+    inline const std::vector<LaneArray>& getJxW() const
+    {
+        return d_JxW;
+    }
+
+    /**
+     * Jacobians, indexed by quadrature point and then by lane.
+     */
+    inline const std::vector<LaneArray>& getJacobians() const
+    {
+        return d_Jacobians;
+    }
+
+    /**
+     * Mapped quadrature points, indexed by quadrature point, then by
+     * coordinate, and then by lane.
+     */
+    inline const boost::multi_array<LaneArray, 2>& getQuadraturePoints() const
+    {
+        return d_quadrature_points;
+    }
+
+    /**
+     * Shape function values, indexed by shape function and then by quadrature
+     * point. These are the same for every element in the batch.
+     */
+    inline const std::vector<std::vector<double> >& getShapeValues() const
+    {
+        return d_shape_values;
+    }
+
+    /**
+     * Shape function gradients, indexed by shape function, then by quadrature
+     * point, then by coordinate, and then by lane.
+     */
+    inline const boost::multi_array<LaneArray, 3>& getShapeGradients() const
+    {
+        return d_shape_gradients;
+    }
+
+protected:
+    /**
+     * Tabulate reference values for a new element type.
+     */
+    void reinitReferenceValues(const libMesh::ElemType elem_type);
+
+    libMesh::QBase* d_qrule;
+
+    /*
+     * Things to actually recompute.
+     */
+    FEUpdateFlags d_update_flags;
+
+    /**
+     * Element type of the current batch.
+     */
+    libMesh::ElemType d_elem_type = libMesh::ElemType::INVALID_ELEM;
+
+    /**
+     * Number of elements in the current batch.
+     */
+    unsigned int d_n_elems = 0;
+
+    /**
+     * Reference shape values, indexed by shape function and then by
+     * quadrature point.
+     */
+    std::vector<std::vector<double> > d_shape_values;
+
+    /**
+     * Reference shape gradients, indexed by shape function, then by
+     * quadrature point, and then by reference coordinate.
+     */
+    boost::multi_array<double, 3> d_reference_shape_gradients;
+
+    /**
+     * Nodal coordinates of the elements, indexed by node, then by coordinate,
+     * and then by lane.
+     */
+    boost::multi_array<LaneArray, 2> d_nodes;
+
+    /**
+     * Contravariants and covariants, indexed by quadrature point, then by row,
+     * then by column, and then by lane.
+     */
+    boost::multi_array<LaneArray, 3> d_contravariants, d_covariants;
+
+    std::vector<LaneArray> d_Jacobians;
+
+    std::vector<LaneArray> d_JxW;
+
+    boost::multi_array<LaneArray, 2> d_quadrature_points;
+
+    boost::multi_array<LaneArray, 3> d_shape_gradients;
+};
+
+template <int dim, int spacedim, unsigned int width>
+constexpr unsigned int FEValuesBatch<dim, spacedim, width>::batch_width;
 } // namespace IBTK
 
 #endif //#ifndef included_IBTK_FEValues
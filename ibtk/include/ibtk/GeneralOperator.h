@@ -223,6 +223,20 @@ public:
      */
     virtual void deallocateOperatorState();
 
+    /*!
+     * \brief Update an initialized operator to use the problem coefficients
+     * most recently provided to it, without reconstructing data structures
+     * that depend only on the patch hierarchy configuration.
+     *
+     * \return true if the operator state was updated, or false if the
+     * operator must instead be reinitialized by initializeOperatorState().
+     *
+     * \note The default implementation returns false.
+     *
+     * \see GeneralSolver::updateProblemCoefficients
+     */
+    virtual bool updateProblemCoefficients();
+
     /*!
      * \brief Modify the RHS vector to account for boundary conditions.
      *
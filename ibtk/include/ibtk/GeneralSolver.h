@@ -222,6 +222,26 @@ public:
      */
     virtual void deallocateSolverState();
 
+    /*!
+     * \brief Update an initialized solver to use the problem coefficients
+     * (e.g., the constants of a PoissonSpecifications object) most recently
+     * provided to it, without reconstructing data structures that depend only
+     * on the patch hierarchy configuration.
+     *
+     * This is intended for cases in which only the values of the problem
+     * coefficients change between solves, e.g., when the time step size
+     * changes.  The form of the coefficients (e.g., whether they are zero,
+     * constant, or spatially varying) must be the same as when the solver
+     * state was initialized.
+     *
+     * \return true if the solver state was updated, or false if the solver
+     * could not update its state and must instead be reinitialized by
+     * initializeSolverState().
+     *
+     * \note The default implementation returns false.
+     */
+    virtual bool updateProblemCoefficients();
+
     //\}
 
     /*!
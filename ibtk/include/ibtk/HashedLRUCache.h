@@ -0,0 +1,352 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_HashedLRUCache
+#define included_IBTK_HashedLRUCache
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "tbox/Utilities.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+/**
+ * \brief Counters describing how effective a cache has been.
+ */
+struct CacheStatistics
+{
+    /**
+     * Number of lookups that found an existing entry.
+     */
+    std::size_t n_hits = 0;
+
+    /**
+     * Number of lookups that did not find an existing entry.
+     */
+    std::size_t n_misses = 0;
+
+    /**
+     * Number of entries removed to keep the cache under its maximum size.
+     */
+    std::size_t n_evictions = 0;
+};
+
+/**
+ * \brief Class implementing a map from keys to heap-allocated values backed
+ * by an open-addressing (linear probing) hash table, with an optional bound
+ * on the number of stored entries.
+ *
+ * The hash of each key is computed once, on insertion, and stored alongside
+ * the entry so that probing and rehashing only compare keys whose hashes
+ * match. Entries are additionally kept in a doubly-linked list ordered by
+ * last use: if a maximum size is set then inserting a new entry into a full
+ * cache removes the least recently used one.
+ *
+ * Values are stored by pointer so references to them are not invalidated by
+ * rehashing. They are, however, invalidated when the corresponding entry is
+ * evicted, so a bounded cache must be large enough to hold every entry a
+ * caller uses at the same time.
+ *
+ * @tparam Key the key type, which must be copyable and equality comparable.
+ *
+ * @tparam T the value type.
+ *
+ * @tparam Hash a function object computing a <code>std::size_t</code> hash
+ * of a Key.
+ */
+template <typename Key, typename T, typename Hash>
+class HashedLRUCache
+{
+public:
+    /**
+     * Constructor.
+     *
+     * @param max_size Maximum number of stored entries. Zero (the default)
+     * means that the cache is unbounded.
+     */
+    HashedLRUCache(const std::size_t max_size = 0) : d_max_size(max_size)
+    {
+    }
+
+    /**
+     * Return a pointer to the value associated with @p key, or
+     * <code>nullptr</code> if there is no such entry. Successful lookups
+     * mark the entry as the most recently used one.
+     */
+    T* find(const Key& key)
+    {
+        const std::size_t slot = findSlot(key, d_hash(key));
+        if (slot == invalid_index)
+        {
+            ++d_statistics.n_misses;
+            return nullptr;
+        }
+        ++d_statistics.n_hits;
+        const std::size_t entry_n = d_table[slot];
+        unlink(entry_n);
+        pushFront(entry_n);
+        return d_entries[entry_n].value.get();
+    }
+
+    /**
+     * Store @p value under @p key and return a reference to it. If the cache
+     * is full then the least recently used entry is removed first.
+     *
+     * @note @p key must not already be present in the cache.
+     */
+    T& insert(const Key& key, std::unique_ptr<T> value)
+    {
+        const std::size_t hash = d_hash(key);
+        TBOX_ASSERT(findSlot(key, hash) == invalid_index);
+        if (d_max_size != 0 && d_size >= d_max_size)
+        {
+            eraseSlot(findSlot(d_entries[d_lru_tail].key, d_entries[d_lru_tail].hash));
+            ++d_statistics.n_evictions;
+        }
+        // keep the load factor at or below one half:
+        if (2 * (d_size + 1) > d_table.size()) rehash(std::max<std::size_t>(16, 2 * d_table.size()));
+
+        std::size_t entry_n;
+        if (d_free_entries.empty())
+        {
+            entry_n = d_entries.size();
+            d_entries.emplace_back();
+        }
+        else
+        {
+            entry_n = d_free_entries.back();
+            d_free_entries.pop_back();
+        }
+        Entry& entry = d_entries[entry_n];
+        entry.key = key;
+        entry.hash = hash;
+        entry.value = std::move(value);
+        pushFront(entry_n);
+        d_table[findEmptySlot(hash)] = entry_n;
+        ++d_size;
+        return *entry.value;
+    }
+
+    /**
+     * Remove the entry associated with @p key, if there is one. Returns
+     * <code>true</code> if an entry was removed.
+     */
+    bool erase(const Key& key)
+    {
+        const std::size_t slot = findSlot(key, d_hash(key));
+        if (slot == invalid_index) return false;
+        eraseSlot(slot);
+        return true;
+    }
+
+    /**
+     * Remove all entries. The statistics are not reset.
+     */
+    void clear()
+    {
+        d_entries.clear();
+        d_free_entries.clear();
+        d_table.clear();
+        d_lru_head = d_lru_tail = invalid_index;
+        d_size = 0;
+    }
+
+    /**
+     * Return the number of stored entries.
+     */
+    std::size_t size() const
+    {
+        return d_size;
+    }
+
+    /**
+     * Return the maximum number of stored entries. Zero means that the
+     * cache is unbounded.
+     */
+    std::size_t getMaxSize() const
+    {
+        return d_max_size;
+    }
+
+    /**
+     * Set the maximum number of stored entries, removing the least recently
+     * used ones if there are currently more than @p max_size entries. Zero
+     * means that the cache is unbounded.
+     */
+    void setMaxSize(const std::size_t max_size)
+    {
+        d_max_size = max_size;
+        while (d_max_size != 0 && d_size > d_max_size)
+        {
+            eraseSlot(findSlot(d_entries[d_lru_tail].key, d_entries[d_lru_tail].hash));
+            ++d_statistics.n_evictions;
+        }
+    }
+
+    /**
+     * Return the hit, miss, and eviction counts accumulated since the cache
+     * was constructed or since resetStatistics() was last called.
+     */
+    const CacheStatistics& getStatistics() const
+    {
+        return d_statistics;
+    }
+
+    /**
+     * Set all statistics counters to zero.
+     */
+    void resetStatistics()
+    {
+        d_statistics = CacheStatistics();
+    }
+
+private:
+    static constexpr std::size_t invalid_index = std::numeric_limits<std::size_t>::max();
+
+    struct Entry
+    {
+        Key key;
+        std::size_t hash = 0;
+        std::unique_ptr<T> value;
+        std::size_t prev = invalid_index, next = invalid_index;
+    };
+
+    std::size_t findSlot(const Key& key, const std::size_t hash) const
+    {
+        if (d_table.empty()) return invalid_index;
+        const std::size_t mask = d_table.size() - 1;
+        for (std::size_t slot = hash & mask; d_table[slot] != invalid_index; slot = (slot + 1) & mask)
+        {
+            const Entry& entry = d_entries[d_table[slot]];
+            if (entry.hash == hash && entry.key == key) return slot;
+        }
+        return invalid_index;
+    }
+
+    std::size_t findEmptySlot(const std::size_t hash) const
+    {
+        const std::size_t mask = d_table.size() - 1;
+        std::size_t slot = hash & mask;
+        while (d_table[slot] != invalid_index) slot = (slot + 1) & mask;
+        return slot;
+    }
+
+    void rehash(const std::size_t table_size)
+    {
+        d_table.assign(table_size, invalid_index);
+        for (std::size_t entry_n = d_lru_head; entry_n != invalid_index; entry_n = d_entries[entry_n].next)
+        {
+            d_table[findEmptySlot(d_entries[entry_n].hash)] = entry_n;
+        }
+    }
+
+    void eraseSlot(std::size_t slot)
+    {
+        const std::size_t entry_n = d_table[slot];
+        unlink(entry_n);
+        d_entries[entry_n].value.reset();
+        d_free_entries.push_back(entry_n);
+        --d_size;
+
+        // Backward-shift deletion: move later entries in the same probe
+        // sequence into the hole so that lookups never need tombstones.
+        const std::size_t mask = d_table.size() - 1;
+        d_table[slot] = invalid_index;
+        for (std::size_t next_slot = (slot + 1) & mask; d_table[next_slot] != invalid_index;
+             next_slot = (next_slot + 1) & mask)
+        {
+            const std::size_t home_slot = d_entries[d_table[next_slot]].hash & mask;
+            const bool home_in_range = slot <= next_slot ? (slot < home_slot && home_slot <= next_slot) :
+                                                           (slot < home_slot || home_slot <= next_slot);
+            if (home_in_range) continue;
+            d_table[slot] = d_table[next_slot];
+            d_table[next_slot] = invalid_index;
+            slot = next_slot;
+        }
+    }
+
+    void unlink(const std::size_t entry_n)
+    {
+        Entry& entry = d_entries[entry_n];
+        if (entry.prev != invalid_index)
+            d_entries[entry.prev].next = entry.next;
+        else
+            d_lru_head = entry.next;
+        if (entry.next != invalid_index)
+            d_entries[entry.next].prev = entry.prev;
+        else
+            d_lru_tail = entry.prev;
+        entry.prev = entry.next = invalid_index;
+    }
+
+    void pushFront(const std::size_t entry_n)
+    {
+        Entry& entry = d_entries[entry_n];
+        entry.prev = invalid_index;
+        entry.next = d_lru_head;
+        if (d_lru_head != invalid_index) d_entries[d_lru_head].prev = entry_n;
+        d_lru_head = entry_n;
+        if (d_lru_tail == invalid_index) d_lru_tail = entry_n;
+    }
+
+    /**
+     * Maximum number of entries (zero means unbounded).
+     */
+    std::size_t d_max_size;
+
+    /**
+     * Number of stored entries.
+     */
+    std::size_t d_size = 0;
+
+    /**
+     * Entry storage. Removed entries are recycled through d_free_entries.
+     */
+    std::vector<Entry> d_entries;
+
+    std::vector<std::size_t> d_free_entries;
+
+    /**
+     * Open-addressing table of indices into d_entries. The size of this
+     * table is always either zero or a power of two.
+     */
+    std::vector<std::size_t> d_table;
+
+    /**
+     * Most and least recently used entries.
+     */
+    std::size_t d_lru_head = invalid_index, d_lru_tail = invalid_index;
+
+    CacheStatistics d_statistics;
+
+    Hash d_hash;
+};
+
+template <typename Key, typename T, typename Hash>
+constexpr std::size_t HashedLRUCache<Key, T, Hash>::invalid_index;
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_HashedLRUCache
@@ -76,6 +76,11 @@ namespace IBTK
  * "composite-grid" mathematical operations on a range of levels in a
  * SAMRAI::hier::PatchHierarchy object.
  *
+ * When IBTK is compiled with OpenMP enabled, the patch loops of the curl(),
+ * div(), grad(), interp(), harmonic_interp(), and laplace() operations are
+ * distributed over threads with dynamic scheduling.  The remaining operations
+ * loop over patches serially.
+ *
  * \note All specified variable descriptor indices must refer to
  * SAMRAI::hier::Variable / SAMRAI::hier::VariableContext pairs that have been
  * registered with the SAMRAI::hier::VariableDatabase.
@@ -43,8 +43,13 @@ IBTK_ENABLE_EXTRA_WARNINGS
 
 namespace IBTK
 {
+class Tri6Mapping;
+class Tri6SurfaceMapping;
+class Quad8Mapping;
 class Tet10Mapping;
+class Hex20Mapping;
 class Hex27Mapping;
+class Prism15Mapping;
 } // namespace IBTK
 
 namespace IBTK
@@ -376,6 +381,8 @@ protected:
     virtual void fillTransforms(const libMesh::Elem* elem) override;
 
     virtual bool isAffine() const override;
+
+    friend class Tri6Mapping;
 };
 
 /*!
@@ -392,6 +399,8 @@ public:
 
 protected:
     virtual void fillTransforms(const libMesh::Elem* elem) override;
+
+    friend class Quad8Mapping;
 };
 
 /*!
@@ -433,6 +442,77 @@ protected:
     libMesh::DenseMatrix<double> d_dphi;
 };
 
+/*!
+ * Specialization for TRI6 elements with codimension zero. Since, for most
+ * applications and in the reference configuration, most TRI6 elements are
+ * actually affine this class tries to use the TRI3 mapping whenever possible.
+ */
+class Tri6Mapping : public LagrangeMapping<2, 2, 6>
+{
+public:
+    /*!
+     * Key type. Completely describes (excepting p-refinement) a libMesh
+     * quadrature rule.
+     */
+    using key_type = std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>;
+
+    /*!
+     * Constructor.
+     */
+    Tri6Mapping(const key_type quad_key, const FEUpdateFlags update_flags);
+
+    virtual void reinit(const libMesh::Elem* elem) override;
+
+protected:
+    /*!
+     * TRI3 mapping that is used whenever the given elem is affine.
+     */
+    Tri3Mapping tri3_mapping;
+
+    /*!
+     * Utility function that determines if the element is affine (i.e., all
+     * nodes at edge midpoints are averages of corners)
+     */
+    static bool elem_is_affine(const libMesh::Elem* elem);
+
+    friend class Tri6SurfaceMapping;
+};
+
+/*!
+ * Specialization for QUAD8 elements with codimension zero. Since, for most
+ * applications and in the reference configuration, most QUAD8 elements are
+ * actually bilinear this class tries to use the QUAD4 mapping whenever
+ * possible.
+ */
+class Quad8Mapping : public LagrangeMapping<2, 2, 8>
+{
+public:
+    /*!
+     * Key type. Completely describes (excepting p-refinement) a libMesh
+     * quadrature rule.
+     */
+    using key_type = std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>;
+
+    /*!
+     * Constructor.
+     */
+    Quad8Mapping(const key_type quad_key, const FEUpdateFlags update_flags);
+
+    virtual void reinit(const libMesh::Elem* elem) override;
+
+protected:
+    /*!
+     * QUAD4 mapping that is used whenever the given elem is bilinear.
+     */
+    Quad4Mapping quad4_mapping;
+
+    /*!
+     * Utility function that determines if the element is bilinear (i.e., all
+     * nodes at edge midpoints are averages of corners)
+     */
+    static bool elem_is_bilinear(const libMesh::Elem* elem);
+};
+
 /*!
  * Specialization for TET4 elements.
  */
@@ -487,6 +567,67 @@ protected:
     static bool elem_is_affine(const libMesh::Elem* elem);
 };
 
+/*!
+ * Specialization for HEX8 elements. If the element is a parallelepiped then
+ * the mapping is affine and the transforms are only computed once.
+ */
+class Hex8Mapping : public NodalMapping<3, 3, 8>
+{
+public:
+    /**
+     * Explicitly use the base class' constructor (this class does not require
+     * any additional setup).
+     */
+    using NodalMapping<3, 3, 8>::NodalMapping;
+
+protected:
+    virtual void fillTransforms(const libMesh::Elem* elem) override;
+
+    virtual bool isAffine() const override;
+
+    /*!
+     * Whether or not the mapping for the current element is affine.
+     */
+    bool d_elem_is_affine = false;
+
+    friend class Hex20Mapping;
+    friend class Hex27Mapping;
+};
+
+/*!
+ * Specialization for HEX20 elements. Since, for most applications and in the
+ * reference configuration, most HEX20 elements are actually trilinear, this
+ * class tries use the HEX8 mapping whenever possible.
+ */
+class Hex20Mapping : public LagrangeMapping<3, 3, 20>
+{
+public:
+    /*!
+     * Key type. Completely describes (excepting p-refinement) a libMesh
+     * quadrature rule.
+     */
+    using key_type = std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>;
+
+    /*!
+     * Constructor.
+     */
+    Hex20Mapping(const key_type quad_key, const FEUpdateFlags update_flags);
+
+    virtual void reinit(const libMesh::Elem* elem) override;
+
+protected:
+    /*!
+     * HEX8 mapping that is used whenever the given elem is trilinear.
+     */
+    Hex8Mapping hex8_mapping;
+
+    /*!
+     * Utility function that determines if the element is trilinear (i.e., all
+     * nodes at edge midpoints are averages of corners)
+     */
+    static bool elem_is_trilinear(const libMesh::Elem* elem);
+};
+
 /*!
  * Specialization for HEX27 elements. Since, for most applications and in the
  * reference configuration, most HEX27 elements are actually trilinear, this
@@ -512,7 +653,7 @@ protected:
     /*!
      * HEX8 mapping that is used whenever the given elem is trilinear.
      */
-    LagrangeMapping<3, 3, 8> hex8_mapping;
+    Hex8Mapping hex8_mapping;
 
     /*!
      * Utility function that determines if the element is trilinear (i.e., all
@@ -521,6 +662,160 @@ protected:
     static bool elem_is_trilinear(const libMesh::Elem* elem);
 };
 
+/*!
+ * Specialization for PRISM6 elements. If the two triangular faces of the
+ * element are translates of each other then the mapping is affine and the
+ * transforms are only computed once.
+ */
+class Prism6Mapping : public NodalMapping<3, 3, 6>
+{
+public:
+    /**
+     * Explicitly use the base class' constructor (this class does not require
+     * any additional setup).
+     */
+    using NodalMapping<3, 3, 6>::NodalMapping;
+
+protected:
+    virtual void fillTransforms(const libMesh::Elem* elem) override;
+
+    virtual bool isAffine() const override;
+
+    /*!
+     * Whether or not the mapping for the current element is affine.
+     */
+    bool d_elem_is_affine = false;
+
+    friend class Prism15Mapping;
+};
+
+/*!
+ * Specialization for PRISM15 elements. Since, for most applications and in
+ * the reference configuration, most PRISM15 elements are actually
+ * first-order, this class tries use the PRISM6 mapping whenever possible.
+ */
+class Prism15Mapping : public LagrangeMapping<3, 3, 15>
+{
+public:
+    /*!
+     * Key type. Completely describes (excepting p-refinement) a libMesh
+     * quadrature rule.
+     */
+    using key_type = std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>;
+
+    /*!
+     * Constructor.
+     */
+    Prism15Mapping(const key_type quad_key, const FEUpdateFlags update_flags);
+
+    virtual void reinit(const libMesh::Elem* elem) override;
+
+protected:
+    /*!
+     * PRISM6 mapping that is used whenever the given elem is first-order.
+     */
+    Prism6Mapping prism6_mapping;
+
+    /*!
+     * Utility function that determines if the element is first-order (i.e.,
+     * all nodes at edge midpoints are averages of corners)
+     */
+    static bool elem_is_first_order(const libMesh::Elem* elem);
+};
+
+/*!
+ * Specialization for EDGE2 elements embedded in two spatial dimensions (i.e.,
+ * codimension one).
+ */
+class Edge2Mapping : public NodalMapping<1, 2, 2>
+{
+public:
+    /**
+     * Explicitly use the base class' constructor (this class does not require
+     * any additional setup).
+     */
+    using NodalMapping<1, 2, 2>::NodalMapping;
+
+protected:
+    virtual void fillTransforms(const libMesh::Elem* elem) override;
+
+    virtual bool isAffine() const override;
+};
+
+/*!
+ * Specialization for TRI3 elements embedded in three spatial dimensions
+ * (i.e., codimension one).
+ */
+class Tri3SurfaceMapping : public NodalMapping<2, 3, 3>
+{
+public:
+    /**
+     * Explicitly use the base class' constructor (this class does not require
+     * any additional setup).
+     */
+    using NodalMapping<2, 3, 3>::NodalMapping;
+
+protected:
+    virtual void fillTransforms(const libMesh::Elem* elem) override;
+
+    virtual bool isAffine() const override;
+
+    friend class Tri6SurfaceMapping;
+};
+
+/*!
+ * Specialization for QUAD4 elements embedded in three spatial dimensions
+ * (i.e., codimension one). If the element is a parallelogram then the mapping
+ * is affine and the transforms are only computed once.
+ */
+class Quad4SurfaceMapping : public NodalMapping<2, 3, 4>
+{
+public:
+    /**
+     * Explicitly use the base class' constructor (this class does not require
+     * any additional setup).
+     */
+    using NodalMapping<2, 3, 4>::NodalMapping;
+
+protected:
+    virtual void fillTransforms(const libMesh::Elem* elem) override;
+
+    virtual bool isAffine() const override;
+
+    /*!
+     * Whether or not the mapping for the current element is affine.
+     */
+    bool d_elem_is_affine = false;
+};
+
+/*!
+ * Specialization for TRI6 elements embedded in three spatial dimensions
+ * (i.e., codimension one). This class uses the TRI3 surface mapping whenever
+ * the element is flat and affine.
+ */
+class Tri6SurfaceMapping : public LagrangeMapping<2, 3, 6>
+{
+public:
+    /*!
+     * Key type. Completely describes (excepting p-refinement) a libMesh
+     * quadrature rule.
+     */
+    using key_type = std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>;
+
+    /*!
+     * Constructor.
+     */
+    Tri6SurfaceMapping(const key_type quad_key, const FEUpdateFlags update_flags);
+
+    virtual void reinit(const libMesh::Elem* elem) override;
+
+protected:
+    /*!
+     * TRI3 surface mapping that is used whenever the given elem is affine.
+     */
+    Tri3SurfaceMapping tri3_mapping;
+};
+
 // Specialization of build for 2D
 template <>
 std::unique_ptr<Mapping<2, 2> > Mapping<2, 2>::build(const key_type key, const FEUpdateFlags update_flags);
@@ -529,6 +824,14 @@ std::unique_ptr<Mapping<2, 2> > Mapping<2, 2>::build(const key_type key, const F
 template <>
 std::unique_ptr<Mapping<3, 3> > Mapping<3, 3>::build(const key_type key, const FEUpdateFlags update_flags);
 
+// Specialization of build for curves in 2D
+template <>
+std::unique_ptr<Mapping<1, 2> > Mapping<1, 2>::build(const key_type key, const FEUpdateFlags update_flags);
+
+// Specialization of build for surfaces in 3D
+template <>
+std::unique_ptr<Mapping<2, 3> > Mapping<2, 3>::build(const key_type key, const FEUpdateFlags update_flags);
+
 } // namespace IBTK
 
 #endif //#ifndef included_IBTK_JacobianCalculator
@@ -16,6 +16,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <ibtk/HashedLRUCache.h>
 #include <ibtk/JacobianCalculator.h>
 #include <ibtk/libmesh_utilities.h>
 
@@ -24,7 +25,7 @@
 #include <libmesh/enum_quadrature_type.h>
 #include <libmesh/quadrature.h>
 
-#include <map>
+#include <cstddef>
 #include <memory>
 #include <tuple>
 
@@ -43,8 +44,10 @@ namespace IBTK
  * make this assumption, e.g., we will use data from two quadrature rules
  * assumed to be equal (by this metric) to initialize FEMap objects.
  *
- * This class essentially provides a wrapper around std::map to manage
- * IBTK::JacobianCalculator (and classes inheriting from it) objects.
+ * This class essentially provides a wrapper around a hash table to manage
+ * IBTK::JacobianCalculator (and classes inheriting from it) objects. The
+ * number of stored objects may optionally be bounded, in which case the least
+ * recently used object is discarded when a new one is needed.
  */
 class JacobianCalculatorCache
 {
@@ -59,8 +62,12 @@ public:
      *
      * @seealso libMesh::MeshBase::spatial_dimension() defines the spatial
      * dimension in the same way.
+     *
+     * The optional second argument is the maximum number of stored
+     * JacobianCalculator objects: zero (the default) means that the cache is
+     * unbounded.
      */
-    JacobianCalculatorCache(const int spatial_dimension);
+    JacobianCalculatorCache(const int spatial_dimension, const std::size_t max_size = 0);
 
     /**
      * Key type. Completely describes (excepting p-refinement) a libMesh
@@ -91,6 +98,23 @@ public:
         d_jacobian_calculators.clear();
     }
 
+    /**
+     * Set the maximum number of stored objects. Zero means that the cache is
+     * unbounded.
+     */
+    void setMaxSize(const std::size_t max_size)
+    {
+        d_jacobian_calculators.setMaxSize(max_size);
+    }
+
+    /**
+     * Return the hit, miss, and eviction counts of the cache.
+     */
+    const CacheStatistics& getStatistics() const
+    {
+        return d_jacobian_calculators.getStatistics();
+    }
+
 protected:
     /**
      * Spatial dimension of the mesh.
@@ -100,11 +124,11 @@ protected:
     /**
      * Managed libMesh::Quadrature objects.
      */
-    std::map<key_type, std::unique_ptr<JacobianCalculator> > d_jacobian_calculators;
+    HashedLRUCache<key_type, JacobianCalculator, QuadratureKeyHash> d_jacobian_calculators;
 };
 
-inline JacobianCalculatorCache::JacobianCalculatorCache(const int spatial_dimension)
-    : d_spatial_dimension(spatial_dimension)
+inline JacobianCalculatorCache::JacobianCalculatorCache(const int spatial_dimension, const std::size_t max_size)
+    : d_spatial_dimension(spatial_dimension), d_jacobian_calculators(max_size)
 {
     TBOX_ASSERT(0 < spatial_dimension && spatial_dimension <= 3);
 }
@@ -112,8 +136,8 @@ inline JacobianCalculatorCache::JacobianCalculatorCache(const int spatial_dimens
 inline JacobianCalculatorCache::value_type&
 JacobianCalculatorCache::operator[](const JacobianCalculatorCache::key_type& quad_key)
 {
-    auto it = d_jacobian_calculators.find(quad_key);
-    if (it == d_jacobian_calculators.end())
+    JacobianCalculator* cached_jacob = d_jacobian_calculators.find(quad_key);
+    if (cached_jacob == nullptr)
     {
         const libMesh::ElemType elem_type = std::get<0>(quad_key);
         const int dim = get_dim(elem_type);
@@ -128,6 +152,8 @@ JacobianCalculatorCache::operator[](const JacobianCalculatorCache::key_type& qua
             switch (elem_type)
             {
             case libMesh::EDGE2:
+                jac_calc.reset(new Edge2Mapping(quad_key, FEUpdateFlags::update_JxW));
+                break;
             case libMesh::EDGE3:
             case libMesh::EDGE4:
                 jac_calc.reset(new LagrangeMapping<1, 2>(quad_key, FEUpdateFlags::update_JxW));
@@ -139,8 +165,10 @@ JacobianCalculatorCache::operator[](const JacobianCalculatorCache::key_type& qua
                 jac_calc.reset(new Quad4Mapping(quad_key, FEUpdateFlags::update_JxW));
                 break;
             case libMesh::TRI6:
+                jac_calc.reset(new Tri6Mapping(quad_key, FEUpdateFlags::update_JxW));
+                break;
             case libMesh::QUAD8:
-                jac_calc.reset(new LagrangeMapping<2, 2>(quad_key, FEUpdateFlags::update_JxW));
+                jac_calc.reset(new Quad8Mapping(quad_key, FEUpdateFlags::update_JxW));
                 break;
             case libMesh::QUAD9:
                 jac_calc.reset(new Quad9Mapping(quad_key, FEUpdateFlags::update_JxW));
@@ -150,25 +178,57 @@ JacobianCalculatorCache::operator[](const JacobianCalculatorCache::key_type& qua
             }
             break;
         case 3:
-            if (dim == 1)
-                jac_calc.reset(new LagrangeMapping<1, 3>(quad_key, FEUpdateFlags::update_JxW));
-            else if (dim == 2)
-                jac_calc.reset(new LagrangeMapping<2, 3>(quad_key, FEUpdateFlags::update_JxW));
-            else if (elem_type == libMesh::TET4)
+            switch (elem_type)
+            {
+            case libMesh::TRI3:
+                jac_calc.reset(new Tri3SurfaceMapping(quad_key, FEUpdateFlags::update_JxW));
+                break;
+            case libMesh::TRI6:
+                jac_calc.reset(new Tri6SurfaceMapping(quad_key, FEUpdateFlags::update_JxW));
+                break;
+            case libMesh::QUAD4:
+                jac_calc.reset(new Quad4SurfaceMapping(quad_key, FEUpdateFlags::update_JxW));
+                break;
+            case libMesh::TET4:
                 jac_calc.reset(new Tet4Mapping(quad_key, FEUpdateFlags::update_JxW));
-            else
-                jac_calc.reset(new LagrangeMapping<3, 3>(quad_key, FEUpdateFlags::update_JxW));
+                break;
+            case libMesh::TET10:
+                jac_calc.reset(new Tet10Mapping(quad_key, FEUpdateFlags::update_JxW));
+                break;
+            case libMesh::HEX8:
+                jac_calc.reset(new Hex8Mapping(quad_key, FEUpdateFlags::update_JxW));
+                break;
+            case libMesh::HEX20:
+                jac_calc.reset(new Hex20Mapping(quad_key, FEUpdateFlags::update_JxW));
+                break;
+            case libMesh::HEX27:
+                jac_calc.reset(new Hex27Mapping(quad_key, FEUpdateFlags::update_JxW));
+                break;
+            case libMesh::PRISM6:
+                jac_calc.reset(new Prism6Mapping(quad_key, FEUpdateFlags::update_JxW));
+                break;
+            case libMesh::PRISM15:
+                jac_calc.reset(new Prism15Mapping(quad_key, FEUpdateFlags::update_JxW));
+                break;
+            default:
+                if (dim == 1)
+                    jac_calc.reset(new LagrangeMapping<1, 3>(quad_key, FEUpdateFlags::update_JxW));
+                else if (dim == 2)
+                    jac_calc.reset(new LagrangeMapping<2, 3>(quad_key, FEUpdateFlags::update_JxW));
+                else
+                    jac_calc.reset(new LagrangeMapping<3, 3>(quad_key, FEUpdateFlags::update_JxW));
+            }
             break;
         default:
             TBOX_ERROR("unimplemented spatial dimension");
         }
 
-        JacobianCalculator& new_jacob = *(*d_jacobian_calculators.emplace(quad_key, std::move(jac_calc)).first).second;
+        JacobianCalculator& new_jacob = d_jacobian_calculators.insert(quad_key, std::move(jac_calc));
         return new_jacob;
     }
     else
     {
-        return *(it->second);
+        return *cached_jacob;
     }
 }
 
@@ -75,6 +75,16 @@ public:
      */
     void setTimeInterval(double current_time, double new_time) override;
 
+    /*!
+     * \brief Update the solver to use new problem coefficients.
+     *
+     * The registered linear operator and preconditioner are updated via
+     * GeneralOperator::updateProblemCoefficients() and
+     * GeneralSolver::updateProblemCoefficients().  Returns false if either
+     * object cannot be updated.
+     */
+    bool updateProblemCoefficients() override;
+
     //\}
 
     /*!
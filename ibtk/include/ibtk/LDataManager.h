@@ -791,13 +791,33 @@ public:
      *
      *    workload(i) = 1 + beta_work*node_count(i)
      *
-     * in which alpha and beta are parameters that each default to the value 1.
+     * in which beta_work is a parameter that defaults to the value 1 (see
+     * setWorkloadNodeWeight()).
      */
     void addWorkloadEstimate(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                              const int workload_data_idx,
                              const int coarsest_ln = -1,
                              const int finest_ln = -1);
 
+    /*!
+     * \brief Set the cost of a single Lagrangian node relative to that of one
+     * Eulerian cell (i.e., beta_work in addWorkloadEstimate()).
+     *
+     * Since the work done by spreading and interpolation is proportional to
+     * the number of Eulerian cells in the support of the kernel function, if
+     * @p scale_by_kernel_width is true then @p node_weight is taken to be the
+     * cost of a node using a kernel with a four-cell wide stencil and is
+     * scaled by (w/4)^NDIM, in which w is the larger of the interpolation and
+     * spreading stencil widths.
+     */
+    void setWorkloadNodeWeight(double node_weight, bool scale_by_kernel_width = false);
+
+    /*!
+     * \brief Get the cost of a single Lagrangian node relative to that of one
+     * Eulerian cell.
+     */
+    double getWorkloadNodeWeight() const;
+
     /*!
      * \brief Update the count of nodes per cell.
      *
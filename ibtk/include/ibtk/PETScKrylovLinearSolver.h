@@ -82,7 +82,12 @@ namespace IBTK
  *   is provided to the class constructor, memory management of that object is
  *   \em NOT handled by the PETScKrylovLinearSolver.  In particular, it is the
  *   caller's responsibility to ensure that the supplied KSP object is properly
- *   destroyed via KSPDestroy().
+ *   destroyed via KSPDestroy().  \par
+ * - PETSc's pipelined Krylov methods (e.g., \p "pipecg", \p "pgmres", and \p
+ *   "pipefgmres") may be used to overlap global reductions with operator and
+ *   preconditioner applications; see class PETScSAMRAIVectorReal.  Classical
+ *   Gram-Schmidt refinement is disabled for the pipelined GMRES variants,
+ *   since it would require an additional blocking reduction per iteration.
  *
  * Sample parameters for initialization from database (and their default
  * values): \verbatim
@@ -94,8 +99,30 @@ namespace IBTK
  abs_residual_tol = 1.0e-50    // see setAbsoluteTolerance()
  max_iterations = 10000        // see setMaxIterations()
  enable_logging = FALSE        // see setLoggingEnabled()
+ recycle_subspace_dim = 0      // number of vectors retained between solves (0 disables
+ recycling)
  \endverbatim
  *
+ * When recycle_subspace_dim is positive, the solver retains a subspace
+ * \f$U\f$ and its image \f$C = AU\f$, with \f$C\f$ orthonormal, between
+ * solves, as in GCRO-type recycling methods.  Before each solve, the initial
+ * guess is corrected by \f$U C^T r_0\f$, which minimizes the residual over the
+ * retained subspace.  The Krylov method is then applied to the deflated system
+ * \f$(I - C C^T) A y = (I - C C^T) r_0\f$, so that it does not have to
+ * resolve the part of the spectrum captured by \f$U\f$, and the solution is
+ * recovered as \f$x = x_0 + (I - U C^T A) y\f$.  The correction computed by
+ * each solve is added to the subspace (replacing the oldest vector when the
+ * subspace is full).  Deflation costs a reduction of
+ * \f$\dim U\f$ inner products per operator application and one additional
+ * operator application per solve.  Because the deflated operator is not
+ * symmetric, recycling should be used with GMRES-type methods.  While the
+ * operator is deflated, the relative residual tolerance is converted into an
+ * absolute tolerance with respect to the norm of the original right-hand side.
+ * Recycling is effective when a sequence of systems with slowly varying
+ * operators and right-hand sides are solved, e.g., once per time step.  The
+ * subspace is discarded when the solver state is deallocated (e.g., following
+ * regridding) and \f$C\f$ is recomputed after updateProblemCoefficients().
+ *
  * PETSc is developed in the Mathematics and Computer Science (MCS) Division at
  * Argonne National Laboratory (ANL).  For more information about PETSc, see <A
  * HREF="http://www.mcs.anl.gov/petsc">http://www.mcs.anl.gov/petsc</A>.
@@ -183,6 +210,19 @@ public:
      */
     void setPreconditioner(SAMRAI::tbox::Pointer<LinearSolver> pc_solver = NULL) override;
 
+    /*!
+     * \brief Update the solver to use new problem coefficients.
+     *
+     * Any recycled subspace is retained, but its image under the updated
+     * operator is recomputed prior to the next solve.
+     */
+    bool updateProblemCoefficients() override;
+
+    /*!
+     * \brief Get the number of vectors in the recycled subspace.
+     */
+    int getRecycledSubspaceDimension() const;
+
     /*!
      * \brief Set the nullspace of the linear system.
      *
@@ -366,6 +406,49 @@ private:
      */
     void deallocateNullspaceData();
 
+    /*!
+     * \brief Correct the initial guess by minimizing the residual over the
+     * recycled subspace.
+     *
+     * If the subspace is nonempty, the corrected initial guess is stored in
+     * d_recycle_x0, the deflated residual is stored in d_recycle_r, \a x is
+     * set to zero, and \p true is returned to indicate that the Krylov method
+     * must solve the deflated system.
+     *
+     * \note The operator must be configured to use homogeneous boundary
+     * conditions and d_b must contain the right-hand side modified for
+     * inhomogeneous boundary conditions.
+     */
+    bool applyRecycledSubspace(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x);
+
+    /*!
+     * \brief Add the correction computed by the Krylov method to the recycled
+     * subspace.
+     *
+     * If \p deflated is \p true, \a x contains the solution of the deflated
+     * system on input and the solution of the original system on output.
+     */
+    void updateRecycledSubspace(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x, bool deflated);
+
+    /*!
+     * \brief Recompute the image of the recycled subspace under the current
+     * operator.
+     */
+    void refreshRecycledSubspace();
+
+    /*!
+     * \brief Orthonormalize the vector c against the recycled vectors
+     * d_recycle_C, applying the same transformation to u.  Returns \p false
+     * if c is (numerically) in the span of d_recycle_C.
+     */
+    bool orthonormalizeRecycledVector(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& u,
+                                      SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& c);
+
+    /*!
+     * \brief Free the recycled subspace and the associated scratch vectors.
+     */
+    void deallocateRecycledSubspace();
+
     /*!
      * \name Static functions for use by PETSc KSP and MatShell objects.
      */
@@ -403,6 +486,17 @@ private:
     Vec d_petsc_nullspace_constant_vec = nullptr;
     std::vector<Vec> d_petsc_nullspace_basis_vecs;
     bool d_solver_has_attached_nullspace = false;
+
+    /*!
+     * \name Data for recycling a subspace between solves.
+     */
+    //\{
+    int d_recycle_subspace_dim = 0;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_recycle_U, d_recycle_C;
+    SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_recycle_x0, d_recycle_r;
+    bool d_recycle_C_stale = false;
+    bool d_recycle_deflate = false;
+    //\}
 };
 } // namespace IBTK
 
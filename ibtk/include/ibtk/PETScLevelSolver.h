@@ -64,8 +64,25 @@ namespace IBTK
  abs_residual_tol = 1.0e-50    // see setAbsoluteTolerance()
  max_iterations = 10000        // see setMaxIterations()
  enable_logging = FALSE        // see setLoggingEnabled()
+ agglomeration_reduction_factor = 1  // factor by which to reduce the number of
+ processes that solve the level system (1 disables agglomeration)
+ agglomeration_pc_type = "lu"  // preconditioner used on the reduced set of
+ processes
  \endverbatim
  *
+ * When agglomeration_reduction_factor is larger than one, the level system is
+ * gathered onto a subcommunicator with that many times fewer processes (via
+ * the PETSc PCTELESCOPE preconditioner), solved there, and the solution is
+ * scattered back.  This avoids a solve that is dominated by communication
+ * when the level has only a few unknowns per process, as is typical of the
+ * coarsest level of a multigrid solver.  The solver used on the
+ * subcommunicator is a single application of agglomeration_pc_type, and may be
+ * modified via the command-line options with prefix
+ * "-<options_prefix>telescope_".  Note that "lu" requires a parallel direct
+ * solver package (e.g., MUMPS) unless the system is gathered onto a single
+ * process.  Because agglomeration replaces the KSP preconditioner, pc_type may
+ * not be set (except to "telescope") when it is enabled.
+ *
  * PETSc is developed at the Argonne National Laboratory Mathematics and
  * Computer Science Division.  For more information about \em PETSc, see <A
  * HREF="http://www.mcs.anl.gov/petsc">http://www.mcs.anl.gov/petsc</A>.
@@ -215,6 +232,20 @@ public:
      */
     void deallocateSolverState() override;
 
+    /*!
+     * \brief Update the solver to use new problem coefficients.
+     *
+     * The matrix values are reset by updateSolverStateSpecialized(), after
+     * which the numerical setup of the preconditioner is recomputed.  The
+     * matrix nonzero structure, DOF indexing, subdomain index sets, and
+     * communication schedules are reused.
+     *
+     * \note Subclasses of class PETScLevelSolver should \em not override this
+     * method.  Instead, they should override the protected method
+     * updateSolverStateSpecialized().
+     */
+    bool updateProblemCoefficients() override;
+
     //\}
 
 protected:
@@ -247,6 +278,16 @@ protected:
      */
     virtual void deallocateSolverStateSpecialized() = 0;
 
+    /*!
+     * \brief Reset the values of the matrices computed by
+     * initializeSolverStateSpecialized() to correspond to the current problem
+     * coefficients, without modifying their nonzero structure.
+     *
+     * \return true if the matrices were updated, or false if the solver must
+     * instead be reinitialized.  The default implementation returns false.
+     */
+    virtual bool updateSolverStateSpecialized();
+
     /*!
      * \brief Copy a generic vector to the PETSc representation.
      */
@@ -295,6 +336,8 @@ protected:
     //\{
     std::string d_ksp_type = KSPGMRES, d_pc_type = PCILU, d_shell_pc_type;
     std::string d_options_prefix;
+    int d_agglomeration_reduction_factor = 1;
+    std::string d_agglomeration_pc_type = PCLU;
     KSP d_petsc_ksp = nullptr;
     Mat d_petsc_mat = nullptr, d_petsc_pc = nullptr;
     MatNullSpace d_petsc_nullsp;
@@ -344,6 +387,12 @@ private:
      */
     PETScLevelSolver& operator=(const PETScLevelSolver& that) = delete;
 
+    /*!
+     * \brief Configure the KSP preconditioner to gather the level system onto a
+     * subcommunicator and solve it there.
+     */
+    void setupAgglomeration();
+
     /*!
      * \brief Apply the preconditioner to \a x and store the result in \a y.
      */
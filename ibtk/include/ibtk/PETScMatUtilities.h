@@ -102,6 +102,38 @@ public:
                                                int dof_index_idx,
                                                SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
 
+    /*!
+     * \brief Reset the values of a PETSc Mat object previously constructed by
+     * constructPatchLevelCCLaplaceOp() to correspond to new problem
+     * coefficients.
+     *
+     * The nonzero structure of the matrix is not modified, so the patch level
+     * and DOF indexing must be the same as when the matrix was constructed.
+     */
+    static void updatePatchLevelCCLaplaceOp(Mat& mat,
+                                            const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+                                            const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                            double data_time,
+                                            const std::vector<int>& num_dofs_per_proc,
+                                            int dof_index_idx,
+                                            SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+
+    /*!
+     * \brief Reset the values of a PETSc Mat object previously constructed by
+     * constructPatchLevelSCLaplaceOp() to correspond to new problem
+     * coefficients.
+     *
+     * The nonzero structure of the matrix is not modified, so the patch level
+     * and DOF indexing must be the same as when the matrix was constructed.
+     */
+    static void updatePatchLevelSCLaplaceOp(Mat& mat,
+                                            const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+                                            const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                            double data_time,
+                                            const std::vector<int>& num_dofs_per_proc,
+                                            int dof_index_idx,
+                                            SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+
     /*!
      * \brief Construct a parallel PETSc Mat object corresponding to the
      * side-centered viscous operator of a side-centered velocity variable
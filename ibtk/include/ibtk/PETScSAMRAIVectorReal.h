@@ -49,6 +49,15 @@ namespace IBTK
  * through the static member functions that create and destroy PETSc vector
  * objects.
  *
+ * In addition to the standard (blocking) reductions, this class provides the
+ * process-local dot product, norm, and multiple dot product operations that
+ * PETSc uses to implement split-phase reductions (VecDotBegin()/VecDotEnd(),
+ * VecNormBegin()/VecNormEnd(), and VecMDotBegin()/VecMDotEnd()).  PETSc
+ * combines the local values from all operations that are started before the
+ * first matching "End" call into a single non-blocking (MPI_Iallreduce())
+ * reduction, which allows pipelined Krylov methods to overlap the reduction
+ * with other work.
+ *
  * Finally, we remark that PETSc allows vectors with complex-valued entries.
  * This class and the class SAMRAI::solv::SAMRAIVectorReal assume real-values
  * vectors, i.e., data of type \p double or \p float.  The (currently
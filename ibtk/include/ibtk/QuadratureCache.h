@@ -16,6 +16,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <ibtk/HashedLRUCache.h>
 #include <ibtk/libmesh_utilities.h>
 
 #include <libmesh/enum_elem_type.h>
@@ -23,7 +24,7 @@
 #include <libmesh/enum_quadrature_type.h>
 #include <libmesh/quadrature.h>
 
-#include <map>
+#include <cstddef>
 #include <memory>
 #include <tuple>
 
@@ -38,8 +39,12 @@ namespace IBTK
  * make this assumption, e.g., we will use data from two quadrature rules
  * assumed to be equal (by this metric) to initialize FEMap objects.
  *
- * This class essentially provides a wrapper around std::map to manage
- * libMesh::QBase (and classes inheriting from it) objects.
+ * This class essentially provides a wrapper around a hash table to manage
+ * libMesh::QBase (and classes inheriting from it) objects. The number of
+ * stored rules may optionally be bounded, in which case the least recently
+ * used rule is discarded when a new one is needed: references returned by
+ * <code>operator[]</code> are only valid until the next call that may create
+ * a new rule.
  */
 class QuadratureCache
 {
@@ -61,8 +66,11 @@ public:
      *
      * @param dim The topological dimension of the relevant libMesh::Mesh: see
      * libMesh::MeshBase::mesh_dimension() for more information.
+     *
+     * @param max_size The maximum number of stored quadrature rules. Zero
+     * (the default) means that the cache is unbounded.
      */
-    QuadratureCache(const unsigned int dim);
+    QuadratureCache(const unsigned int dim, const std::size_t max_size = 0);
 
     /**
      * Return a reference to a Quadrature object that matches the specified
@@ -81,6 +89,23 @@ public:
         d_quadratures.clear();
     }
 
+    /**
+     * Set the maximum number of stored quadrature rules. Zero means that
+     * the cache is unbounded.
+     */
+    void setMaxSize(const std::size_t max_size)
+    {
+        d_quadratures.setMaxSize(max_size);
+    }
+
+    /**
+     * Return the hit, miss, and eviction counts of the cache.
+     */
+    const CacheStatistics& getStatistics() const
+    {
+        return d_quadratures.getStatistics();
+    }
+
 protected:
     /**
      * Topological dimension of the FE mesh.
@@ -90,10 +115,11 @@ protected:
     /**
      * Managed libMesh::Quadrature objects.
      */
-    std::map<key_type, std::unique_ptr<libMesh::QBase> > d_quadratures;
+    HashedLRUCache<key_type, libMesh::QBase, QuadratureKeyHash> d_quadratures;
 };
 
-inline QuadratureCache::QuadratureCache(const unsigned int dim) : d_dim(dim)
+inline QuadratureCache::QuadratureCache(const unsigned int dim, const std::size_t max_size)
+    : d_dim(dim), d_quadratures(max_size)
 {
 }
 
@@ -101,21 +127,20 @@ inline QuadratureCache::value_type&
 QuadratureCache::operator[](const QuadratureCache::key_type& quad_key)
 {
     TBOX_ASSERT(static_cast<unsigned int>(get_dim(std::get<0>(quad_key))) == d_dim);
-    auto it = d_quadratures.find(quad_key);
-    if (it == d_quadratures.end())
+    libMesh::QBase* quad = d_quadratures.find(quad_key);
+    if (quad == nullptr)
     {
         const libMesh::ElemType elem_type = std::get<0>(quad_key);
         const libMesh::QuadratureType quad_type = std::get<1>(quad_key);
         const libMesh::Order order = std::get<2>(quad_key);
 
-        libMesh::QBase& new_quad =
-            *(*d_quadratures.emplace(quad_key, libMesh::QBase::build(quad_type, d_dim, order)).first).second;
+        libMesh::QBase& new_quad = d_quadratures.insert(quad_key, libMesh::QBase::build(quad_type, d_dim, order));
         new_quad.init(elem_type);
         return new_quad;
     }
     else
     {
-        return *(it->second);
+        return *quad;
     }
 }
 } // namespace IBTK
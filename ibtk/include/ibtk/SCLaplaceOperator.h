@@ -117,6 +117,14 @@ public:
      */
     void deallocateOperatorState() override;
 
+    /*!
+     * \brief Update the operator to use new problem coefficients.
+     *
+     * The problem coefficients are only used when the operator is applied, so
+     * this function only requires that the operator state is initialized.
+     */
+    bool updateProblemCoefficients() override;
+
     //\}
 
 protected:
@@ -105,8 +105,18 @@ namespace IBTK
  skip_relax = 1                 // see hypre User's Manual (only used by SysPFMG solver or
  preconditioner)
  two_norm = 1                   // see hypre User's Manual (only used by PCG solver)
+ setup_reuse_tol = -1.0         // relative change in C and D below which the hypre solver
+ setup is reused (negative values disable reuse)
  \endverbatim
  *
+ * The hypre grid, graph, matrix, and vector objects are retained when the
+ * solver state is deallocated.  If initializeSolverState() is subsequently
+ * called on a patch level with the same boxes and processor mapping, these
+ * objects are reused and only the matrix values are recomputed.  The hypre
+ * solver setup is recomputed as well unless \f$C\f$ and \f$D\f$ differ from
+ * the values used in the last setup by less than setup_reuse_tol (relative to
+ * those values).
+ *
  * \em hypre is developed in the Center for Applied Scientific Computing (CASC)
  * at Lawrence Livermore National Laboratory (LLNL).  For more information about
  * \em hypre, see <A
@@ -234,6 +244,14 @@ public:
      */
     void deallocateSolverState() override;
 
+    /*!
+     * \brief Update the solver to use new problem coefficients.
+     *
+     * The hypre grid, stencil, matrix, and vector objects are reused; only the
+     * matrix values and the hypre solver setup are recomputed.
+     */
+    bool updateProblemCoefficients() override;
+
     //\}
 
 private:
@@ -281,6 +299,12 @@ private:
     void destroyHypreSolver();
     void deallocateHypreData();
 
+    /*!
+     * \brief Determine whether the current hypre solver setup may be used with
+     * the current problem coefficients.
+     */
+    bool canReuseHypreSolverSetup() const;
+
     /*!
      * \brief Associated hierarchy.
      */
@@ -319,6 +343,19 @@ private:
     int d_skip_relax = 1;
     int d_two_norm = 1;
     //\}
+
+    /*!
+     * \name Data used to reuse hypre objects across reinitializations.
+     */
+    //\{
+    bool d_hypre_data_allocated = false;
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hypre_hierarchy;
+    int d_hypre_level_num = IBTK::invalid_level_number;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_hypre_level_boxes;
+    std::vector<int> d_hypre_level_mapping;
+    double d_setup_reuse_tol = -1.0;
+    double d_setup_C = 0.0, d_setup_D = 0.0;
+    //\}
 };
 } // namespace IBTK
 
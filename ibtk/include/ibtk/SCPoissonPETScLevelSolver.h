@@ -85,6 +85,8 @@ namespace IBTK
  rel_residual_tol = 1.0e-6      // see setRelativeTolerance()
  enable_logging = FALSE         // see setLoggingEnabled()
  options_prefix = ""            // see setOptionsPrefix()
+ agglomeration_reduction_factor = 1  // see PETScLevelSolver
+ agglomeration_pc_type = "lu"   // see PETScLevelSolver
  \endverbatim
  *
  * PETSc is developed at the Argonne National Laboratory Mathematics and
@@ -134,6 +136,12 @@ protected:
      */
     void deallocateSolverStateSpecialized() override;
 
+    /*!
+     * \brief Reset the matrix values to correspond to the current problem
+     * coefficients.
+     */
+    bool updateSolverStateSpecialized() override;
+
     /*!
      * \brief Copy a generic vector to the PETSc representation.
      */
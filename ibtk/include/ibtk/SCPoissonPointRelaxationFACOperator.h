@@ -188,6 +188,14 @@ public:
                          int coarsest_level_num,
                          int finest_level_num) override;
 
+    /*!
+     * \brief Update the operator to use new problem coefficients.
+     *
+     * The smoothers and the residual computation use the problem coefficients
+     * directly, so only the coarse level solver needs to be updated.
+     */
+    bool updateProblemCoefficients() override;
+
     //\}
 
 protected:
@@ -17,6 +17,9 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <Box.h>
+#include <Patch.h>
+#include <PatchLevel.h>
+#include <tbox/Pointer.h>
 
 #include <vector>
 
@@ -29,6 +32,29 @@ namespace IBTK
  * their longest edges.
  */
 std::vector<SAMRAI::hier::Box<NDIM> > merge_boxes_by_longest_edge(const std::vector<SAMRAI::hier::Box<NDIM> >& boxes);
+
+/**
+ * Get the boxes of the patch level @p level and the processor to which each
+ * box is assigned. Two patch levels with equal boxes and mappings have the same
+ * parallel layout, so that objects laid out on one (e.g., hypre grids) may be
+ * reused for the other.
+ */
+void get_level_layout(const SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> >& level,
+                      std::vector<SAMRAI::hier::Box<NDIM> >& boxes,
+                      std::vector<int>& mapping);
+
+/**
+ * Get the patches of the patch level @p level that are owned by this
+ * processor.
+ *
+ * Reference counting in SAMRAI::tbox::Pointer is not thread-safe, so a
+ * thread-parallel loop over patches should iterate over the pointers returned
+ * by this function (which are all copied before the loop starts) and should
+ * only copy pointers to objects that belong to a single patch (the patch
+ * itself, its geometry, and its patch data) within the loop body.
+ */
+std::vector<SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > >
+get_local_patches(const SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> >& level);
 } // namespace IBTK
 
 #endif
@@ -175,6 +175,41 @@ enum_to_string<VCInterpType>(VCInterpType val)
     return "UNKNOWN_VC_INTERP_TYPE";
 } // enum_to_string
 
+/*!
+ * \brief Enumerated type for different ways of solving the mass matrix system
+ * in an L2 projection with a consistent mass matrix.
+ */
+enum L2ProjectionSolverType
+{
+    L2_PROJECTION_KRYLOV,
+    L2_PROJECTION_CHOLESKY,
+    L2_PROJECTION_CHEBYSHEV,
+    UNKNOWN_L2_PROJECTION_SOLVER_TYPE = -1
+};
+
+template <>
+inline L2ProjectionSolverType
+string_to_enum<L2ProjectionSolverType>(const std::string& val)
+{
+    if (strcasecmp(val.c_str(), "KRYLOV") == 0) return L2_PROJECTION_KRYLOV;
+    if (strcasecmp(val.c_str(), "L2_PROJECTION_KRYLOV") == 0) return L2_PROJECTION_KRYLOV;
+    if (strcasecmp(val.c_str(), "CHOLESKY") == 0) return L2_PROJECTION_CHOLESKY;
+    if (strcasecmp(val.c_str(), "L2_PROJECTION_CHOLESKY") == 0) return L2_PROJECTION_CHOLESKY;
+    if (strcasecmp(val.c_str(), "CHEBYSHEV") == 0) return L2_PROJECTION_CHEBYSHEV;
+    if (strcasecmp(val.c_str(), "L2_PROJECTION_CHEBYSHEV") == 0) return L2_PROJECTION_CHEBYSHEV;
+    return UNKNOWN_L2_PROJECTION_SOLVER_TYPE;
+} // string_to_enum
+
+template <>
+inline std::string
+enum_to_string<L2ProjectionSolverType>(L2ProjectionSolverType val)
+{
+    if (val == L2_PROJECTION_KRYLOV) return "L2_PROJECTION_KRYLOV";
+    if (val == L2_PROJECTION_CHOLESKY) return "L2_PROJECTION_CHOLESKY";
+    if (val == L2_PROJECTION_CHEBYSHEV) return "L2_PROJECTION_CHEBYSHEV";
+    return "UNKNOWN_L2_PROJECTION_SOLVER_TYPE";
+} // enum_to_string
+
 } // namespace IBTK
 
 //////////////////////////////////////////////////////////////////////////////
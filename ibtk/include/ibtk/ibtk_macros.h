@@ -49,4 +49,14 @@ _Pragma("GCC diagnostic ignored \"-Wunneeded-internal-declaration\"")
 
 #endif // #ifdef IBTK_HAVE_PRAGMA_KEYWORD
 
+// IBTK_OMP(directive) expands to "#pragma omp directive" when the library is
+// compiled with OpenMP enabled (i.e., configured with --enable-openmp), and to
+// nothing otherwise, so that the annotated loops run serially.
+#if defined(_OPENMP) && defined(IBTK_HAVE_PRAGMA_KEYWORD)
+#define IBTK_OMP_PRAGMA(...) _Pragma(#__VA_ARGS__)
+#define IBTK_OMP(...) IBTK_OMP_PRAGMA(omp __VA_ARGS__)
+#else
+#define IBTK_OMP(...)
+#endif
+
 #endif // #ifndef included_IBTK_ibtk_macros
@@ -30,6 +30,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <algorithm>
 #include <array>
 #include <utility>
+#include <vector>
 
 /////////////////////////////// MACRO DEFINITIONS ////////////////////////////
 
@@ -169,6 +170,25 @@ level_can_be_refined(int level_number, int max_levels)
     return level_number < finest_level_number;
 }
 
+/*!
+ * Compute the weights with which to combine data given at the (distinct) times @p times to evaluate the Lagrange
+ * interpolating polynomial of those data at time @p t. When @p t lies outside of the range of @p times, these are
+ * extrapolation weights.
+ */
+inline std::vector<double>
+lagrange_interpolation_weights(const std::vector<double>& times, const double t)
+{
+    std::vector<double> weights(times.size(), 1.0);
+    for (std::size_t i = 0; i < times.size(); ++i)
+    {
+        for (std::size_t j = 0; j < times.size(); ++j)
+        {
+            if (j != i) weights[i] *= (t - times[j]) / (times[i] - times[j]);
+        }
+    }
+    return weights;
+} // lagrange_interpolation_weights
+
 /*!
  * Convert a Voigt notation index to the corresponding symmetric tensor index. This function only returns the upper
  * triangular index.
@@ -32,6 +32,8 @@
 #include "libmesh/dof_map.h"
 #include "libmesh/dof_object.h"
 #include "libmesh/edge.h"
+#include "libmesh/enum_xdr_mode.h"
+#include "libmesh/equation_systems.h"
 #include "libmesh/face.h"
 #include "libmesh/fe.h"
 #include "libmesh/petsc_vector.h"
@@ -442,6 +444,27 @@ getQuadratureKey(const libMesh::QuadratureType quad_type,
                  const boost::multi_array<double, 2>& X_node,
                  const double dx_min);
 
+/**
+ * Function object computing a hash of a quadrature key (see
+ * getQuadratureKey). The three enumeration values are packed into a single
+ * integer which is then mixed so that the low bits, which are used to index
+ * open-addressing hash tables, depend on every component of the key.
+ */
+struct QuadratureKeyHash
+{
+    inline std::size_t
+    operator()(const std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>& quad_key) const
+    {
+        std::uint64_t h = static_cast<std::uint64_t>(std::get<0>(quad_key));
+        h = (h << 16) ^ static_cast<std::uint64_t>(std::get<1>(quad_key));
+        h = (h << 16) ^ static_cast<std::uint64_t>(std::get<2>(quad_key));
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return static_cast<std::size_t>(h);
+    }
+};
+
 /**
  * Populate @p U_node with the finite element solution coefficients on the
  * current element. This particular overload is for scalar finite elements.
@@ -1458,6 +1481,53 @@ void write_elem_partitioning(const std::string& file_name, const libMesh::System
  */
 void write_node_partitioning(const std::string& file_name, const libMesh::System& position_system);
 
+/*!
+ * Get the libMesh::XdrMODE used to read (if @p write is <code>false</code>) or
+ * write (if @p write is <code>true</code>) files with the given extension.
+ * The extension <code>xdr</code> corresponds to binary files and
+ * <code>xda</code> to ASCII files. libMesh can only compress ASCII files, so
+ * <code>xda</code> may be followed by one of the compression suffixes
+ * <code>.gz</code>, <code>.bz2</code>, or <code>.xz</code>. An error is
+ * raised for any other extension.
+ */
+libMesh::XdrMODE get_xdr_mode(const std::string& extension, bool write);
+
+/*!
+ * Write the solution and all additional vectors of every system of @p
+ * equation_systems to the single file @p file_name. The file is written
+ * collectively (with MPI-IO if PETSc supports it) and the entries of each
+ * vector are stored in an order that only depends on the ids of the nodes
+ * and elements of the mesh, so the file can be read by
+ * read_equation_systems_data() with any partitioning of the same mesh on any
+ * number of processors. The definitions of the systems are not written: they
+ * should be written separately, e.g., by libMesh::EquationSystems::write()
+ * without libMesh::EquationSystems::WRITE_DATA.
+ *
+ * @note This is a collective operation. The mesh must be replicated and the
+ * systems may not contain SCALAR variables.
+ */
+void write_equation_systems_data(libMesh::EquationSystems& equation_systems, const std::string& file_name);
+
+/*!
+ * Read data written by write_equation_systems_data() into the systems of @p
+ * equation_systems, which must have the same systems, variables, and vectors
+ * as the ones that were written (e.g., because they were read from the
+ * libMesh file written alongside the data file).
+ *
+ * @note This is a collective operation.
+ */
+void read_equation_systems_data(libMesh::EquationSystems& equation_systems, const std::string& file_name);
+
+/*!
+ * Compute the largest difference between corresponding entries of @p X_vec
+ * and @p X_ref_vec. If @p X_ref_vec is <code>nullptr</code> or the two
+ * vectors do not have the same parallel layout, then the largest
+ * representable double is returned instead.
+ *
+ * @note This is a collective operation on the communicator of @p X_vec.
+ */
+double max_norm_difference(libMesh::PetscVector<double>& X_vec, libMesh::PetscVector<double>* X_ref_vec);
+
 /**
  * Compute bounding boxes based on where an elements quadrature points
  * are. See getQuadratureKey for descriptions of the last five arguments.
@@ -0,0 +1,149 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_patch_smoothers
+#define included_IBTK_patch_smoothers
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <IBTK_config.h>
+
+#include "ArrayData.h"
+#include "Box.h"
+#include "EdgeData.h"
+#include "NodeData.h"
+#include "SideData.h"
+
+/////////////////////////////// FUNCTION DEFINITIONS /////////////////////////
+
+// Gauss-Seidel smoothers for the patch-local problems solved by the point
+// relaxation FAC operators.  Each function performs a single sweep (or a single
+// "red" or "black" half-sweep) over the cells (or sides) in the index box
+// @p box and updates the solution in place.  The sweep visits the box tile by
+// tile; the tiles cover axes 0 and 1, and in three spatial dimensions each tile
+// is swept along axis 2.  Tiles are visited in lexicographic order, and cells
+// within a tile are visited in lexicographic order, so that each sweep gives
+// the same result as a lexicographic sweep over the whole box.  "Red" cells are
+// those whose index sum is even, and "black" cells are those whose index sum is
+// odd.
+namespace IBTK
+{
+/*!
+ * Perform a single Gauss-Seidel sweep for F = alpha div grad U + beta U on the
+ * index box @p box for data depth @p depth.  If @p mask is non-null, U is left
+ * unmodified at the degrees of freedom at which the mask is nonzero.
+ */
+void gs_smooth(SAMRAI::pdat::ArrayData<NDIM, double>& U,
+               const SAMRAI::pdat::ArrayData<NDIM, double>& F,
+               int depth,
+               const SAMRAI::hier::Box<NDIM>& box,
+               double alpha,
+               double beta,
+               const double* dx,
+               const SAMRAI::pdat::ArrayData<NDIM, int>* mask = nullptr);
+
+/*!
+ * Perform a single "red" (@p red_or_black == 0) or "black" (@p red_or_black ==
+ * 1) Gauss-Seidel half-sweep for F = alpha div grad U + beta U.
+ *
+ * @see gs_smooth()
+ */
+void rb_gs_smooth(SAMRAI::pdat::ArrayData<NDIM, double>& U,
+                  const SAMRAI::pdat::ArrayData<NDIM, double>& F,
+                  int depth,
+                  const SAMRAI::hier::Box<NDIM>& box,
+                  double alpha,
+                  double beta,
+                  const double* dx,
+                  int red_or_black,
+                  const SAMRAI::pdat::ArrayData<NDIM, int>* mask = nullptr);
+
+/*!
+ * Perform a single Gauss-Seidel sweep for F = div alpha grad U + beta U, in
+ * which U and F are cell-centered and alpha is side-centered.
+ */
+void vc_cell_gs_smooth(SAMRAI::pdat::ArrayData<NDIM, double>& U,
+                       const SAMRAI::pdat::SideData<NDIM, double>& alpha,
+                       double beta,
+                       const SAMRAI::pdat::ArrayData<NDIM, double>& F,
+                       int depth,
+                       const SAMRAI::hier::Box<NDIM>& box,
+                       const double* dx);
+
+/*!
+ * Perform a single "red" or "black" Gauss-Seidel half-sweep for F = div alpha
+ * grad U + beta U.
+ *
+ * @see vc_cell_gs_smooth()
+ */
+void vc_cell_rb_gs_smooth(SAMRAI::pdat::ArrayData<NDIM, double>& U,
+                          const SAMRAI::pdat::SideData<NDIM, double>& alpha,
+                          double beta,
+                          const SAMRAI::pdat::ArrayData<NDIM, double>& F,
+                          int depth,
+                          const SAMRAI::hier::Box<NDIM>& box,
+                          const double* dx,
+                          int red_or_black);
+
+#if (NDIM == 2)
+using ViscosityPatchData = SAMRAI::pdat::NodeData<NDIM, double>;
+#endif
+#if (NDIM == 3)
+using ViscosityPatchData = SAMRAI::pdat::EdgeData<NDIM, double>;
+#endif
+
+/*!
+ * Perform a single Gauss-Seidel sweep for F = alpha div mu (grad U + grad U^T)
+ * + beta C U, in which U, F, and C are side-centered and the viscosity mu is
+ * node-centered in two spatial dimensions and edge-centered in three spatial
+ * dimensions.  @p box is the cell-centered patch box.  The components of U are
+ * updated one after another.  If @p C is null, C = 1 is used.  If @p mask is
+ * non-null, U is left unmodified at the degrees of freedom at which the mask is
+ * nonzero.  The cell-centered viscosity is interpolated either harmonically or
+ * arithmetically from its nearest values.
+ */
+void vc_side_gs_smooth(SAMRAI::pdat::SideData<NDIM, double>& U,
+                       const SAMRAI::pdat::SideData<NDIM, double>& F,
+                       const SAMRAI::pdat::SideData<NDIM, int>* mask,
+                       const SAMRAI::pdat::SideData<NDIM, double>* C,
+                       const ViscosityPatchData& mu,
+                       int depth,
+                       double alpha,
+                       double beta,
+                       const SAMRAI::hier::Box<NDIM>& box,
+                       const double* dx,
+                       bool use_harmonic_interp);
+
+/*!
+ * Perform a single "red" or "black" Gauss-Seidel half-sweep for F = alpha div
+ * mu (grad U + grad U^T) + beta C U.
+ *
+ * @see vc_side_gs_smooth()
+ */
+void vc_side_rb_gs_smooth(SAMRAI::pdat::SideData<NDIM, double>& U,
+                          const SAMRAI::pdat::SideData<NDIM, double>& F,
+                          const SAMRAI::pdat::SideData<NDIM, int>* mask,
+                          const SAMRAI::pdat::SideData<NDIM, double>* C,
+                          const ViscosityPatchData& mu,
+                          int depth,
+                          double alpha,
+                          double beta,
+                          const SAMRAI::hier::Box<NDIM>& box,
+                          const double* dx,
+                          bool use_harmonic_interp,
+                          int red_or_black);
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_patch_smoothers
@@ -0,0 +1 @@
+../../m4/configure_openmp.m4
\ No newline at end of file
@@ -20,6 +20,7 @@
 #include "libmesh/compare_types.h"
 #include "libmesh/dof_map.h"
 #include "libmesh/equation_systems.h"
+#include "libmesh/petsc_vector.h"
 #include "libmesh/quadrature.h"
 #include "libmesh/system.h"
 #include "libmesh/type_vector.h"
@@ -383,7 +384,39 @@ FEDataInterpolation::collectDataForInterpolation(const Elem* const elem)
         NumericVector<double>* system_vec = d_system_vecs[system_idx];
         const auto& dof_indices = system_dof_map_cache->dof_indices(d_current_elem);
         boost::multi_array<double, 2>& elem_data = d_system_elem_data[system_idx];
-        get_values_for_interpolation(elem_data, *system_vec, dof_indices);
+        if (system_idx < d_system_local_solns.size())
+        {
+            // The vector type was checked in setLocalSolutionArrays().
+            get_values_for_interpolation(elem_data,
+                                         *static_cast<const PetscVector<double>*>(system_vec),
+                                         d_system_local_solns[system_idx],
+                                         dof_indices);
+        }
+        else
+        {
+            get_values_for_interpolation(elem_data, *system_vec, dof_indices);
+        }
+    }
+    return;
+}
+
+void
+FEDataInterpolation::setLocalSolutionArrays(const std::map<const NumericVector<double>*, const double*>& local_solns)
+{
+    TBOX_ASSERT(d_initialized);
+    const size_t num_systems = d_systems.size();
+    d_system_local_solns.resize(num_systems);
+    for (size_t system_idx = 0; system_idx < num_systems; ++system_idx)
+    {
+        const NumericVector<double>* const system_vec = d_system_vecs[system_idx];
+        const auto it = local_solns.find(system_vec);
+        if (it == local_solns.end() || !dynamic_cast<const PetscVector<double>*>(system_vec))
+        {
+            TBOX_ERROR("FEDataInterpolation::setLocalSolutionArrays():\n"
+                       << "  no local array was provided for the vector of system " << d_systems[system_idx]->name()
+                       << ", or the vector is not a PetscVector" << std::endl);
+        }
+        d_system_local_solns[system_idx] = it->second;
     }
     return;
 }
@@ -18,6 +18,7 @@
 #include "ibtk/FECache.h"
 #include "ibtk/FEDataManager.h"
 #include "ibtk/FEProjector.h"
+#include "ibtk/FEValues.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/JacobianCalculator.h"
@@ -242,7 +243,7 @@ FEData::setEquationSystems(EquationSystems* const equation_systems, const int le
 
     // Now that we have the EquationSystems object we know the dimensionality
     // of the mesh.
-    d_quadrature_cache = QuadratureCache(d_es->get_mesh().mesh_dimension());
+    d_quadrature_cache = QuadratureCache(d_es->get_mesh().mesh_dimension(), d_cache_max_size);
     return;
 } // setEquationSystems
 
@@ -252,6 +253,20 @@ FEData::getEquationSystems() const
     return d_es;
 } // getEquationSystems
 
+void
+FEData::setCacheMaxSize(const std::size_t max_size)
+{
+    d_cache_max_size = max_size;
+    d_quadrature_cache.setMaxSize(max_size);
+    return;
+} // setCacheMaxSize
+
+std::size_t
+FEData::getCacheMaxSize() const
+{
+    return d_cache_max_size;
+} // getCacheMaxSize
+
 FEData::SystemDofMapCache*
 FEData::getDofMapCache(const std::string& system_name)
 {
@@ -729,6 +744,139 @@ sum_weighted_elem_solution(const int n_vars,
     return;
 }
 
+namespace
+{
+/*
+ * Compute the JxW values of a patch's elements in the reference
+ * configuration. Elements of the same type that use the same quadrature rule
+ * are processed together, FEValuesBatch::batch_width at a time, so that the
+ * mapping computations vectorize across elements. Elements that
+ * FEValuesBatch cannot handle use a JacobianCalculator instead.
+ *
+ * Each batched evaluator owns its quadrature rule since entries of a bounded
+ * QuadratureCache may be evicted while the evaluator still refers to them.
+ */
+class PatchJxWCalculator
+{
+public:
+    using key_type = QuadratureCache::key_type;
+
+    PatchJxWCalculator(const MeshBase& mesh, const std::size_t cache_max_size)
+        : d_dim(mesh.mesh_dimension()),
+          d_use_batches(mesh.spatial_dimension() == NDIM && (d_dim == NDIM || d_dim == NDIM - 1)),
+          d_jacobian_calculator_cache(mesh.spatial_dimension(), cache_max_size)
+    {
+    }
+
+    /*
+     * Set JxW[e] to the JxW values of elems[e] for the quadrature rule with
+     * key quad_keys[e].
+     */
+    void compute(const std::vector<Elem*>& elems,
+                 const std::vector<key_type>& quad_keys,
+                 std::vector<std::vector<double> >& JxW)
+    {
+        TBOX_ASSERT(elems.size() == quad_keys.size());
+        JxW.resize(elems.size());
+        for (auto& elem_idxs : d_elem_idxs) elem_idxs.second.clear();
+        for (unsigned int e_idx = 0; e_idx < elems.size(); ++e_idx)
+        {
+            const Elem* const elem = elems[e_idx];
+            if (d_use_batches && elem->dim() == d_dim && elem->p_level() == 0 &&
+                is_batchable(std::get<0>(quad_keys[e_idx])))
+            {
+                d_elem_idxs[quad_keys[e_idx]].push_back(e_idx);
+            }
+            else
+            {
+                JxW[e_idx] = d_jacobian_calculator_cache[quad_keys[e_idx]].get_JxW(elem);
+            }
+        }
+        for (const auto& elem_idxs : d_elem_idxs)
+        {
+            if (elem_idxs.second.empty()) continue;
+            if (d_dim == NDIM)
+                computeBatches(d_batches, elem_idxs.first, elem_idxs.second, elems, JxW);
+            else
+                computeBatches(d_codim_batches, elem_idxs.first, elem_idxs.second, elems, JxW);
+        }
+    }
+
+private:
+    static bool is_batchable(const libMesh::ElemType elem_type)
+    {
+        switch (elem_type)
+        {
+        case libMesh::EDGE2:
+        case libMesh::EDGE3:
+        case libMesh::EDGE4:
+        case libMesh::TRI3:
+        case libMesh::TRI6:
+        case libMesh::QUAD4:
+        case libMesh::QUAD8:
+        case libMesh::QUAD9:
+        case libMesh::TET4:
+        case libMesh::TET10:
+        case libMesh::HEX8:
+        case libMesh::HEX27:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    template <int dim>
+    struct BatchData
+    {
+        std::unique_ptr<libMesh::QBase> qrule;
+        std::unique_ptr<FEValuesBatch<dim, NDIM> > fe_values;
+    };
+
+    template <int dim>
+    void computeBatches(std::map<key_type, BatchData<dim> >& batches,
+                        const key_type& key,
+                        const std::vector<unsigned int>& elem_idxs,
+                        const std::vector<Elem*>& elems,
+                        std::vector<std::vector<double> >& JxW)
+    {
+        BatchData<dim>& batch_data = batches[key];
+        if (!batch_data.fe_values)
+        {
+            batch_data.qrule = libMesh::QBase::build(std::get<1>(key), dim, std::get<2>(key));
+            batch_data.fe_values.reset(new FEValuesBatch<dim, NDIM>(batch_data.qrule.get(), update_JxW));
+        }
+        FEValuesBatch<dim, NDIM>& fe_batch = *batch_data.fe_values;
+        constexpr unsigned int width = FEValuesBatch<dim, NDIM>::batch_width;
+        std::array<const Elem*, width> batch_elems;
+        for (std::size_t k = 0; k < elem_idxs.size(); k += width)
+        {
+            const unsigned int n_elems = std::min<std::size_t>(width, elem_idxs.size() - k);
+            for (unsigned int lane = 0; lane < n_elems; ++lane) batch_elems[lane] = elems[elem_idxs[k + lane]];
+            fe_batch.reinit(batch_elems.data(), n_elems);
+            const std::vector<typename FEValuesBatch<dim, NDIM>::LaneArray>& batch_JxW = fe_batch.getJxW();
+            for (unsigned int lane = 0; lane < n_elems; ++lane)
+            {
+                std::vector<double>& elem_JxW = JxW[elem_idxs[k + lane]];
+                elem_JxW.resize(batch_JxW.size());
+                for (unsigned int qp = 0; qp < batch_JxW.size(); ++qp) elem_JxW[qp] = batch_JxW[qp][lane];
+            }
+        }
+    }
+
+    const unsigned int d_dim;
+    const bool d_use_batches;
+    JacobianCalculatorCache d_jacobian_calculator_cache;
+
+    // Batched evaluators for elements of the mesh dimension and of one less
+    // (i.e., surface meshes).
+    std::map<key_type, BatchData<NDIM> > d_batches;
+    std::map<key_type, BatchData<NDIM - 1> > d_codim_batches;
+
+    // Indices of the elements that use each quadrature rule.
+    std::map<key_type, std::vector<unsigned int> > d_elem_idxs;
+};
+} // namespace
+
 void
 FEDataManager::spread(const int f_data_idx,
                       NumericVector<double>& F_vec,
@@ -791,9 +939,11 @@ FEDataManager::spread(const int f_data_idx,
 
     // convenience alias for the quadrature key type used by FECache and JacobianCalculatorCache
     using quad_key_type = std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>;
-    FECache F_fe_cache(dim, F_fe_type, FEUpdateFlags::update_phi);
-    FECache X_fe_cache(dim, X_fe_type, FEUpdateFlags::update_phi);
-    JacobianCalculatorCache jacobian_calculator_cache(mesh.spatial_dimension());
+    const std::size_t cache_max_size = d_fe_data->d_cache_max_size;
+    FECache F_fe_cache(dim, F_fe_type, FEUpdateFlags::update_phi, cache_max_size);
+    FECache X_fe_cache(dim, X_fe_type, FEUpdateFlags::update_phi, cache_max_size);
+    PatchJxWCalculator patch_JxW_calculator(mesh, cache_max_size);
+    std::vector<std::vector<double> > JxW_patch;
 
     // Check to see if we are using nodal quadrature.
     const bool use_nodal_quadrature = spread_spec.use_nodal_quadrature;
@@ -954,6 +1104,7 @@ FEDataManager::spread(const int f_data_idx,
                 n_qp_patch += qrule.n_points();
             }
             if (!n_qp_patch) continue;
+            patch_JxW_calculator.compute(patch_elems, quad_keys, JxW_patch);
             F_JxW_qp.resize(n_vars * n_qp_patch);
             X_qp.resize(NDIM * n_qp_patch);
 
@@ -968,11 +1119,10 @@ FEDataManager::spread(const int f_data_idx,
                 const quad_key_type& key = quad_keys[e_idx];
                 const FEBase& X_fe = X_fe_cache(key, elem);
                 const FEBase& F_fe = F_fe_cache(key, elem);
-                JacobianCalculator& jacobian_calculator = jacobian_calculator_cache[key];
                 const QBase& qrule = d_fe_data->d_quadrature_cache[key];
 
                 // JxW depends on the element
-                const std::vector<double>& JxW_F = jacobian_calculator.get_JxW(elem);
+                const std::vector<double>& JxW_F = JxW_patch[e_idx];
                 const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
                 const std::vector<std::vector<double> >& phi_X = X_fe.get_phi();
 
@@ -1516,9 +1666,11 @@ FEDataManager::interpWeighted(const int f_data_idx,
 
     // convenience alias for the quadrature key type used by FECache and JacobianCalculatorCache
     using quad_key_type = std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>;
-    FECache F_fe_cache(dim, F_fe_type, FEUpdateFlags::update_phi);
-    FECache X_fe_cache(dim, X_fe_type, FEUpdateFlags::update_phi);
-    JacobianCalculatorCache jacobian_calculator_cache(mesh.spatial_dimension());
+    const std::size_t cache_max_size = d_fe_data->d_cache_max_size;
+    FECache F_fe_cache(dim, F_fe_type, FEUpdateFlags::update_phi, cache_max_size);
+    FECache X_fe_cache(dim, X_fe_type, FEUpdateFlags::update_phi, cache_max_size);
+    PatchJxWCalculator patch_JxW_calculator(mesh, cache_max_size);
+    std::vector<std::vector<double> > JxW_patch;
 
     // Communicate any unsynchronized ghost data.
     for (const auto& f_refine_sched : f_refine_scheds)
@@ -1721,6 +1873,7 @@ FEDataManager::interpWeighted(const int f_data_idx,
                 quad_keys[e_idx] = key;
             }
             if (!n_qp_patch) continue;
+            patch_JxW_calculator.compute(patch_elems, quad_keys, JxW_patch);
             F_qp.resize(n_vars * n_qp_patch);
             X_qp.resize(NDIM * n_qp_patch);
             std::fill(F_qp.begin(), F_qp.end(), 0.0);
@@ -1783,10 +1936,9 @@ FEDataManager::interpWeighted(const int f_data_idx,
                 const quad_key_type& key = quad_keys[e_idx];
                 const FEBase& F_fe = F_fe_cache(key, elem);
                 const QBase& qrule = d_fe_data->d_quadrature_cache[key];
-                JacobianCalculator& jacobian_calculator = jacobian_calculator_cache[key];
 
                 // JxW depends on the element
-                const std::vector<double>& JxW_F = jacobian_calculator.get_JxW(elem);
+                const std::vector<double>& JxW_F = JxW_patch[e_idx];
                 const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
 
                 const unsigned int n_qp = qrule.n_points();
@@ -2155,6 +2307,13 @@ FEDataManager::computeL2Projection(NumericVector<double>& U_vec,
                                                max_its);
 } // computeL2Projection
 
+void
+FEDataManager::setL2ProjectionSolverType(const L2ProjectionSolverType solver_type)
+{
+    d_fe_projector->setL2ProjectionSolverType(solver_type);
+    return;
+} // setL2ProjectionSolverType
+
 bool
 FEDataManager::updateQuadratureRule(std::unique_ptr<QBase>& qrule,
                                     QuadratureType type,
@@ -2235,6 +2394,15 @@ FEDataManager::addWorkloadEstimate(Pointer<PatchHierarchy<NDIM> > hierarchy,
     return;
 } // addWorkloadEstimate
 
+double
+FEDataManager::computeTotalQuadPointWorkload()
+{
+    const int ln = d_fe_data->d_level_number;
+    updateQuadPointCountData(ln, ln);
+    HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(d_hierarchy, ln, ln);
+    return d_default_workload_spec.q_point_weight * hier_cc_data_ops.L1Norm(d_qp_count_idx);
+} // computeTotalQuadPointWorkload
+
 void
 FEDataManager::applyGradientDetector(const Pointer<BasePatchHierarchy<NDIM> > hierarchy,
                                      const int level_number,
@@ -2279,7 +2447,7 @@ FEDataManager::applyGradientDetector(const Pointer<BasePatchHierarchy<NDIM> > hi
             TBOX_ASSERT(X_dof_map.variable_type(d) == fe_type);
         }
         using quad_key_type = std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>;
-        FECache X_fe_cache(dim, fe_type, FEUpdateFlags::update_phi);
+        FECache X_fe_cache(dim, fe_type, FEUpdateFlags::update_phi, d_fe_data->d_cache_max_size);
 
         // Setup and extract the underlying solution data.
         NumericVector<double>* X_vec = getCoordsVector();
@@ -2551,6 +2719,28 @@ FEDataManager::getLoggingEnabled() const
     return d_enable_logging;
 } // getLoggingEnabled
 
+void
+FEDataManager::setWorkloadSpec(const FEDataManager::WorkloadSpec& workload_spec)
+{
+    TBOX_ASSERT(workload_spec.q_point_weight >= 0.0);
+    for (const auto& pair : workload_spec.elem_type_q_point_weights) TBOX_ASSERT(pair.second > 0.0);
+    d_default_workload_spec = workload_spec;
+    return;
+} // setWorkloadSpec
+
+void
+FEDataManager::setCacheMaxSize(const std::size_t max_size)
+{
+    d_fe_data->setCacheMaxSize(max_size);
+    return;
+} // setCacheMaxSize
+
+const FEDataManager::WorkloadSpec&
+FEDataManager::getWorkloadSpec() const
+{
+    return d_default_workload_spec;
+} // getWorkloadSpec
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
@@ -2585,7 +2775,7 @@ FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_
 
         // convenience alias for the quadrature key type used by FECache and JacobianCalculatorCache
         using quad_key_type = std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>;
-        FECache X_fe_cache(dim, fe_type, FEUpdateFlags::update_phi);
+        FECache X_fe_cache(dim, fe_type, FEUpdateFlags::update_phi, d_fe_data->d_cache_max_size);
 
         // Extract the underlying solution data.
         NumericVector<double>* X_ghost_vec = buildGhostedCoordsVector();
@@ -2593,7 +2783,9 @@ FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_
         const double* const X_local_soln = X_petsc_vec->get_array_read();
 
         // Determine the number of element quadrature points associated with
-        // each Cartesian grid cell.
+        // each Cartesian grid cell, weighted by their relative costs.
+        const std::map<libMesh::ElemType, double>& elem_type_q_point_weights =
+            d_default_workload_spec.elem_type_q_point_weights;
         boost::multi_array<double, 2> X_node;
         int local_patch_num = 0;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
@@ -2654,6 +2846,15 @@ FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_
                     const std::vector<std::vector<double> >& X_phi = X_fe.get_phi();
                     TBOX_ASSERT(qrule.n_points() == X_phi[0].size());
 
+                    // Quadrature points on some element types may be more
+                    // expensive than on others.
+                    double qp_weight = 1.0;
+                    if (!elem_type_q_point_weights.empty())
+                    {
+                        const auto weight_it = elem_type_q_point_weights.find(elem->type());
+                        if (weight_it != elem_type_q_point_weights.end()) qp_weight = weight_it->second;
+                    }
+
                     Point X_qp;
                     for (unsigned int qp = 0; qp < qrule.n_points(); ++qp)
                     {
@@ -2661,7 +2862,7 @@ FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_
                         const hier::Index<NDIM> i = IndexUtilities::getCellIndex(X_qp, grid_geom, ratio);
                         if (patch_box.contains(i))
                         {
-                            (*qp_count_data)(i) += 1.0;
+                            (*qp_count_data)(i) += qp_weight;
                             ++n_local_q_points;
                         }
                     }
@@ -26,6 +26,12 @@
 #include <libmesh/dof_map.h>
 #include <libmesh/elem.h>
 
+#include <Eigen/Dense>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBTK
@@ -209,6 +215,34 @@ FEProjector::buildL2ProjectionSolver(const std::string& system_name)
 
         // Setup the solver.
         solver->reuse_preconditioner(true);
+        if (d_solver_type == L2_PROJECTION_CHOLESKY)
+        {
+            // The mass matrix only changes with the mesh, so we factor it once
+            // and reuse the factorization for every projection.
+            int ierr;
+            ierr = KSPSetType(solver->ksp(), KSPPREONLY);
+            IBTK_CHKERRQ(ierr);
+            PC pc;
+            ierr = KSPGetPC(solver->ksp(), &pc);
+            IBTK_CHKERRQ(ierr);
+            ierr = PCSetType(pc, PCCHOLESKY);
+            IBTK_CHKERRQ(ierr);
+            if (comm.size() > 1)
+            {
+#if defined(PETSC_HAVE_MUMPS)
+#if PETSC_VERSION_GE(3, 9, 0)
+                ierr = PCFactorSetMatSolverType(pc, MATSOLVERMUMPS);
+#else
+                ierr = PCFactorSetMatSolverPackage(pc, MATSOLVERMUMPS);
+#endif
+                IBTK_CHKERRQ(ierr);
+#else
+                TBOX_ERROR("FEProjector::buildL2ProjectionSolver():\n"
+                           << "  parallel Cholesky factorizations of the mass matrix require PETSc to be "
+                              "configured with MUMPS.\n");
+#endif
+            }
+        }
 
         // Store the solver, mass matrix, and configuration options.
         d_L2_proj_solver[system_name] = std::move(solver);
@@ -366,7 +400,11 @@ FEProjector::computeL2Projection(PetscVector<double>& U_vec,
     if (close_F) F_vec.close();
     const System& system = d_fe_data->getEquationSystems()->get_system(system_name);
     const DofMap& dof_map = system.get_dof_map();
-    if (consistent_mass_matrix)
+    if (consistent_mass_matrix && d_solver_type == L2_PROJECTION_CHEBYSHEV)
+    {
+        converged = solveChebyshev(U_vec, F_vec, system_name, tol, max_its);
+    }
+    else if (consistent_mass_matrix)
     {
         std::pair<PetscLinearSolver<double>*, PetscMatrix<double>*> proj_solver_components =
             buildL2ProjectionSolver(system_name);
@@ -403,6 +441,29 @@ FEProjector::computeL2Projection(PetscVector<double>& U_vec,
     return converged;
 }
 
+void
+FEProjector::setL2ProjectionSolverType(const L2ProjectionSolverType solver_type)
+{
+    if (solver_type == UNKNOWN_L2_PROJECTION_SOLVER_TYPE)
+    {
+        TBOX_ERROR("FEProjector::setL2ProjectionSolverType():\n"
+                   << "  unknown L2 projection solver type.\n");
+    }
+    if (solver_type == d_solver_type) return;
+    d_solver_type = solver_type;
+
+    // The solvers are configured when they are built, so existing ones must be
+    // discarded.
+    d_L2_proj_solver.clear();
+    d_L2_proj_matrix.clear();
+}
+
+L2ProjectionSolverType
+FEProjector::getL2ProjectionSolverType() const
+{
+    return d_solver_type;
+}
+
 void
 FEProjector::setLoggingEnabled(const bool enable_logging)
 {
@@ -419,6 +480,191 @@ FEProjector::getLoggingEnabled() const
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+std::pair<double, double>
+FEProjector::getLumpedMassEigenvalueBounds(const std::string& system_name)
+{
+    if (!d_L2_proj_eigenvalue_bounds.count(system_name))
+    {
+        // Extract the mesh.
+        const MeshBase& mesh = d_fe_data->getEquationSystems()->get_mesh();
+        const unsigned int dim = mesh.mesh_dimension();
+
+        // Extract the FE system and DOF map, and setup the FE object.
+        System& system = d_fe_data->getEquationSystems()->get_system(system_name);
+        DofMap& dof_map = system.get_dof_map();
+        FEType fe_type = dof_map.variable_type(0);
+        std::unique_ptr<QBase> qrule = fe_type.default_quadrature_rule(dim);
+        std::unique_ptr<FEBase> fe(FEBase::build(dim, fe_type));
+        fe->attach_quadrature_rule(qrule.get());
+        const std::vector<double>& JxW = fe->get_JxW();
+        const std::vector<std::vector<double> >& phi = fe->get_phi();
+
+        // The Rayleigh quotient of the assembled matrices is a ratio of sums of
+        // element Rayleigh quotients, so the extreme eigenvalues of the
+        // element problems M_e v = lambda D_e v bound those of the global one.
+        // Rows corresponding to Dirichlet boundary conditions are identity
+        // rows in both matrices and have eigenvalue 1.
+        double lambda_min = 1.0, lambda_max = 1.0;
+        Eigen::MatrixXd M_e, D_e;
+        const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
+        const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
+        for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+        {
+            const Elem* const elem = *el_it;
+            fe->reinit(elem);
+            const size_t n_basis = phi.size();
+            const unsigned int n_qp = qrule->n_points();
+            M_e.setZero(n_basis, n_basis);
+            for (unsigned int i = 0; i < n_basis; ++i)
+            {
+                for (unsigned int j = 0; j < n_basis; ++j)
+                {
+                    for (unsigned int qp = 0; qp < n_qp; ++qp)
+                    {
+                        M_e(i, j) += (phi[i][qp] * phi[j][qp]) * JxW[qp];
+                    }
+                }
+            }
+
+            // This is the same lumping used in buildDiagonalL2MassMatrix().
+            const double vol = elem->volume();
+            const double tr_M = M_e.trace();
+            D_e.setZero(n_basis, n_basis);
+            for (unsigned int i = 0; i < n_basis; ++i) D_e(i, i) = vol * M_e(i, i) / tr_M;
+
+            Eigen::GeneralizedSelfAdjointEigenSolver<Eigen::MatrixXd> eig(M_e, D_e, Eigen::EigenvaluesOnly);
+            lambda_min = std::min(lambda_min, eig.eigenvalues().minCoeff());
+            lambda_max = std::max(lambda_max, eig.eigenvalues().maxCoeff());
+        }
+        mesh.comm().min(lambda_min);
+        mesh.comm().max(lambda_max);
+        d_L2_proj_eigenvalue_bounds[system_name] = std::make_pair(lambda_min, lambda_max);
+
+        if (d_enable_logging)
+        {
+            plog << "FEProjector::getLumpedMassEigenvalueBounds(): eigenvalue bounds for system: " << system_name
+                 << " are [" << lambda_min << ", " << lambda_max << "]\n";
+        }
+    }
+    return d_L2_proj_eigenvalue_bounds[system_name];
+}
+
+bool
+FEProjector::solveChebyshev(PetscVector<double>& U_vec,
+                            PetscVector<double>& F_vec,
+                            const std::string& system_name,
+                            const double tol,
+                            const unsigned int max_its)
+{
+    int ierr;
+    Mat M = buildL2ProjectionSolver(system_name).second->mat();
+    Vec D = buildDiagonalL2MassMatrix(system_name)->vec();
+    Vec U = U_vec.vec();
+    Vec F = F_vec.vec();
+    const std::pair<double, double> bounds = getLumpedMassEigenvalueBounds(system_name);
+    const double lambda_min = bounds.first;
+    const double lambda_max = bounds.second;
+
+    Vec r, d, z;
+    ierr = VecDuplicate(F, &r);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDuplicate(F, &d);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDuplicate(F, &z);
+    IBTK_CHKERRQ(ierr);
+
+    // Start from the lumped mass solution. If the preconditioned matrix is a
+    // multiple of the identity then we only need to rescale it.
+    ierr = VecPointwiseDivide(U, F, D);
+    IBTK_CHKERRQ(ierr);
+    unsigned int n_its = 0;
+    if (lambda_max - lambda_min <= std::numeric_limits<double>::epsilon() * lambda_max)
+    {
+        ierr = VecScale(U, 1.0 / lambda_max);
+        IBTK_CHKERRQ(ierr);
+    }
+    else
+    {
+        // After k iterations the residual is p_k(M D^{-1}) (I - M D^{-1}) F,
+        // in which the scaled Chebyshev polynomial p_k is bounded by 2 * rho^k
+        // on [lambda_min, lambda_max] with rho = (sqrt(kappa) - 1) /
+        // (sqrt(kappa) + 1). Hence the D^{-1}-norm of the residual relative to
+        // that of F is at most 2 * rho^k * max |1 - lambda|, so we can
+        // determine the number of iterations needed to reach the requested
+        // tolerance in advance.
+        const double sqrt_kappa = std::sqrt(lambda_max / lambda_min);
+        const double rho_bound = (sqrt_kappa - 1.0) / (sqrt_kappa + 1.0);
+        const double initial_bound = std::max(std::abs(1.0 - lambda_min), std::abs(1.0 - lambda_max));
+        const double n_its_bound = std::ceil(std::log(0.5 * tol / initial_bound) / std::log(rho_bound));
+        n_its = n_its_bound <= 1.0 ? 1u : std::min(max_its, static_cast<unsigned int>(n_its_bound));
+
+        // See, e.g., Algorithm 12.1 in Saad, Iterative Methods for Sparse
+        // Linear Systems (2nd edition).
+        const double theta = 0.5 * (lambda_max + lambda_min);
+        const double delta = 0.5 * (lambda_max - lambda_min);
+        const double sigma = theta / delta;
+        double rho = 1.0 / sigma;
+        ierr = MatMult(M, U, r);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecAYPX(r, -1.0, F);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecPointwiseDivide(d, r, D);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecScale(d, 1.0 / theta);
+        IBTK_CHKERRQ(ierr);
+        for (unsigned int k = 0; k < n_its; ++k)
+        {
+            ierr = VecAXPY(U, 1.0, d);
+            IBTK_CHKERRQ(ierr);
+            if (k + 1 == n_its) break;
+            ierr = MatMult(M, d, z);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecAXPY(r, -1.0, z);
+            IBTK_CHKERRQ(ierr);
+            const double rho_new = 1.0 / (2.0 * sigma - rho);
+            ierr = VecPointwiseDivide(z, r, D);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecAXPBY(d, 2.0 * rho_new / delta, rho_new * rho, z);
+            IBTK_CHKERRQ(ierr);
+            rho = rho_new;
+        }
+    }
+
+    // The iteration count may have been limited by max_its and the bound does
+    // not account for round-off, so check the actual residual (in the same
+    // D^{-1}-norm) once at the end.
+    ierr = MatMult(M, U, r);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecAYPX(r, -1.0, F);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecPointwiseDivide(z, r, D);
+    IBTK_CHKERRQ(ierr);
+    double r_norm_sq, F_norm_sq;
+    ierr = VecDot(r, z, &r_norm_sq);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecPointwiseDivide(z, F, D);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDot(F, z, &F_norm_sq);
+    IBTK_CHKERRQ(ierr);
+    const double r_norm = std::sqrt(std::abs(r_norm_sq));
+    const double F_norm = std::sqrt(std::abs(F_norm_sq));
+    const bool converged = r_norm <= tol * F_norm;
+    if (d_enable_logging)
+    {
+        plog << "FEProjector::solveChebyshev(): system: " << system_name << " performed " << n_its
+             << " iterations with relative residual norm "
+             << (F_norm > 0.0 ? r_norm / F_norm : r_norm) << (converged ? "" : " (not converged)") << "\n";
+    }
+
+    ierr = VecDestroy(&r);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&d);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&z);
+    IBTK_CHKERRQ(ierr);
+    return converged;
+}
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
@@ -31,6 +31,9 @@
 #include <libmesh/point.h>
 #include <libmesh/quadrature.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <map>
 #include <vector>
 
@@ -40,6 +43,67 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Compute the determinants and inverses of 1x1, 2x2, or 3x3 matrices stored
+// in lane-parallel form (i.e., each entry contains the values of that entry
+// for every element in a batch).
+template <std::size_t width>
+inline void
+lane_inverse(const std::array<std::array<std::array<double, width>, 1>, 1>& A,
+             std::array<double, width>& det,
+             std::array<std::array<std::array<double, width>, 1>, 1>& A_inv)
+{
+    for (std::size_t l = 0; l < width; ++l)
+    {
+        det[l] = A[0][0][l];
+        A_inv[0][0][l] = 1.0 / det[l];
+    }
+}
+
+template <std::size_t width>
+inline void
+lane_inverse(const std::array<std::array<std::array<double, width>, 2>, 2>& A,
+             std::array<double, width>& det,
+             std::array<std::array<std::array<double, width>, 2>, 2>& A_inv)
+{
+    for (std::size_t l = 0; l < width; ++l)
+    {
+        det[l] = A[0][0][l] * A[1][1][l] - A[0][1][l] * A[1][0][l];
+        const double det_inv = 1.0 / det[l];
+        A_inv[0][0][l] = A[1][1][l] * det_inv;
+        A_inv[0][1][l] = -A[0][1][l] * det_inv;
+        A_inv[1][0][l] = -A[1][0][l] * det_inv;
+        A_inv[1][1][l] = A[0][0][l] * det_inv;
+    }
+}
+
+template <std::size_t width>
+inline void
+lane_inverse(const std::array<std::array<std::array<double, width>, 3>, 3>& A,
+             std::array<double, width>& det,
+             std::array<std::array<std::array<double, width>, 3>, 3>& A_inv)
+{
+    for (std::size_t l = 0; l < width; ++l)
+    {
+        const double c00 = A[1][1][l] * A[2][2][l] - A[1][2][l] * A[2][1][l];
+        const double c01 = A[1][2][l] * A[2][0][l] - A[1][0][l] * A[2][2][l];
+        const double c02 = A[1][0][l] * A[2][1][l] - A[1][1][l] * A[2][0][l];
+        det[l] = A[0][0][l] * c00 + A[0][1][l] * c01 + A[0][2][l] * c02;
+        const double det_inv = 1.0 / det[l];
+        A_inv[0][0][l] = c00 * det_inv;
+        A_inv[1][0][l] = c01 * det_inv;
+        A_inv[2][0][l] = c02 * det_inv;
+        A_inv[0][1][l] = (A[0][2][l] * A[2][1][l] - A[0][1][l] * A[2][2][l]) * det_inv;
+        A_inv[1][1][l] = (A[0][0][l] * A[2][2][l] - A[0][2][l] * A[2][0][l]) * det_inv;
+        A_inv[2][1][l] = (A[0][1][l] * A[2][0][l] - A[0][0][l] * A[2][1][l]) * det_inv;
+        A_inv[0][2][l] = (A[0][1][l] * A[1][2][l] - A[0][2][l] * A[1][1][l]) * det_inv;
+        A_inv[1][2][l] = (A[0][2][l] * A[1][0][l] - A[0][0][l] * A[1][2][l]) * det_inv;
+        A_inv[2][2][l] = (A[0][0][l] * A[1][1][l] - A[0][1][l] * A[1][0][l]) * det_inv;
+    }
+}
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 std::unique_ptr<FEValuesBase>
@@ -190,8 +254,222 @@ FEValues<dim, spacedim>::reinit(const libMesh::Elem* elem)
     d_last_elem_type = elem_type;
 }
 
+template <int dim, int spacedim, unsigned int width>
+FEValuesBatch<dim, spacedim, width>::FEValuesBatch(libMesh::QBase* qrule, const FEUpdateFlags update_flags)
+    : d_qrule(qrule), d_update_flags(update_flags)
+{
+    // set up update flag dependencies:
+    if (d_update_flags & update_dphi) d_update_flags |= update_covariants;
+    if (d_update_flags & update_JxW) d_update_flags |= update_jacobians;
+    if (d_update_flags & update_jacobians) d_update_flags |= update_contravariants;
+    if (d_update_flags & update_covariants) d_update_flags |= update_contravariants;
+}
+
+template <int dim, int spacedim, unsigned int width>
+void
+FEValuesBatch<dim, spacedim, width>::reinit(const libMesh::Elem* const* elems, const unsigned int n_elems)
+{
+    TBOX_ASSERT(0 < n_elems && n_elems <= width);
+    const libMesh::ElemType elem_type = elems[0]->type();
+    for (unsigned int e = 0; e < n_elems; ++e)
+    {
+        // some things are not yet implemented
+        TBOX_ASSERT(elems[e]->p_level() == 0);
+        // dim is only available at runtime with libMesh
+        TBOX_ASSERT(elems[e]->dim() == dim);
+        TBOX_ASSERT(elems[e]->type() == elem_type);
+    }
+    if (elem_type != d_elem_type) reinitReferenceValues(elem_type);
+    d_n_elems = n_elems;
+
+    const unsigned int n_nodes = d_shape_values.size();
+    const unsigned int n_q_points = d_JxW.size();
+    const std::vector<double>& weights = d_qrule->get_weights();
+
+    // Gather the nodal coordinates. Unused lanes get copies of the last
+    // element so that every lane contains valid data.
+    for (unsigned int l = 0; l < width; ++l)
+    {
+        const libMesh::Elem* const elem = elems[std::min(l, n_elems - 1)];
+        for (unsigned int n = 0; n < n_nodes; ++n)
+        {
+            const libMesh::Point& p = elem->point(n);
+            for (unsigned int d = 0; d < spacedim; ++d) d_nodes[n][d][l] = p(d);
+        }
+    }
+
+    if (d_update_flags & update_quadrature_points)
+    {
+        for (unsigned int q = 0; q < n_q_points; ++q)
+        {
+            for (unsigned int d = 0; d < spacedim; ++d)
+            {
+                LaneArray& x = d_quadrature_points[q][d];
+                x.fill(0.0);
+                for (unsigned int n = 0; n < n_nodes; ++n)
+                {
+                    const double phi = d_shape_values[n][q];
+                    const LaneArray& x_n = d_nodes[n][d];
+                    for (unsigned int l = 0; l < width; ++l) x[l] += phi * x_n[l];
+                }
+            }
+        }
+    }
+
+    if (d_update_flags & update_contravariants)
+    {
+        for (unsigned int q = 0; q < n_q_points; ++q)
+        {
+            for (unsigned int i = 0; i < spacedim; ++i)
+            {
+                for (unsigned int j = 0; j < dim; ++j)
+                {
+                    LaneArray& contravariant = d_contravariants[q][i][j];
+                    contravariant.fill(0.0);
+                    for (unsigned int n = 0; n < n_nodes; ++n)
+                    {
+                        const double dphi = d_reference_shape_gradients[n][q][j];
+                        const LaneArray& x_n = d_nodes[n][i];
+                        for (unsigned int l = 0; l < width; ++l) contravariant[l] += dphi * x_n[l];
+                    }
+                }
+            }
+        }
+    }
+
+    if (d_update_flags & update_jacobians || d_update_flags & update_covariants)
+    {
+        // For nonzero codimension we work with the metric tensor C^T C: its
+        // determinant is the square of the Jacobian and the covariant is
+        // C (C^T C)^{-1}, which is C^{-T} when C is square.
+        using Matrix = std::array<std::array<LaneArray, dim>, dim>;
+        Matrix G, G_inv;
+        LaneArray det;
+        for (unsigned int q = 0; q < n_q_points; ++q)
+        {
+            for (unsigned int i = 0; i < dim; ++i)
+            {
+                for (unsigned int j = 0; j < dim; ++j)
+                {
+                    if (dim == spacedim)
+                    {
+                        G[i][j] = d_contravariants[q][i][j];
+                        continue;
+                    }
+                    G[i][j].fill(0.0);
+                    for (unsigned int k = 0; k < spacedim; ++k)
+                    {
+                        const LaneArray& C_ki = d_contravariants[q][k][i];
+                        const LaneArray& C_kj = d_contravariants[q][k][j];
+                        for (unsigned int l = 0; l < width; ++l) G[i][j][l] += C_ki[l] * C_kj[l];
+                    }
+                }
+            }
+            lane_inverse(G, det, G_inv);
+
+            if (d_update_flags & update_jacobians)
+            {
+                for (unsigned int l = 0; l < width; ++l)
+                {
+                    d_Jacobians[q][l] = dim == spacedim ? det[l] : std::sqrt(det[l]);
+                }
+#ifndef NDEBUG
+                for (unsigned int l = 0; l < width; ++l) TBOX_ASSERT(d_Jacobians[q][l] > 0.0);
+#endif
+            }
+
+            if (d_update_flags & update_covariants)
+            {
+                for (unsigned int i = 0; i < spacedim; ++i)
+                {
+                    for (unsigned int j = 0; j < dim; ++j)
+                    {
+                        LaneArray& covariant = d_covariants[q][i][j];
+                        if (dim == spacedim)
+                        {
+                            covariant = G_inv[j][i];
+                            continue;
+                        }
+                        covariant.fill(0.0);
+                        for (unsigned int k = 0; k < dim; ++k)
+                        {
+                            const LaneArray& C_ik = d_contravariants[q][i][k];
+                            const LaneArray& G_inv_kj = G_inv[k][j];
+                            for (unsigned int l = 0; l < width; ++l) covariant[l] += C_ik[l] * G_inv_kj[l];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if (d_update_flags & update_JxW)
+    {
+        for (unsigned int q = 0; q < n_q_points; ++q)
+        {
+            for (unsigned int l = 0; l < width; ++l) d_JxW[q][l] = weights[q] * d_Jacobians[q][l];
+        }
+    }
+
+    if (d_update_flags & update_dphi)
+    {
+        for (unsigned int n = 0; n < n_nodes; ++n)
+        {
+            for (unsigned int q = 0; q < n_q_points; ++q)
+            {
+                for (unsigned int d = 0; d < spacedim; ++d)
+                {
+                    LaneArray& shape_grad = d_shape_gradients[n][q][d];
+                    shape_grad.fill(0.0);
+                    for (unsigned int j = 0; j < dim; ++j)
+                    {
+                        const double ref_shape_grad = d_reference_shape_gradients[n][q][j];
+                        const LaneArray& covariant = d_covariants[q][d][j];
+                        for (unsigned int l = 0; l < width; ++l) shape_grad[l] += covariant[l] * ref_shape_grad;
+                    }
+                }
+            }
+        }
+    }
+}
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+template <int dim, int spacedim, unsigned int width>
+void
+FEValuesBatch<dim, spacedim, width>::reinitReferenceValues(const libMesh::ElemType elem_type)
+{
+    d_qrule->init(elem_type);
+    const unsigned int n_nodes = get_n_nodes(elem_type);
+    const unsigned int n_q_points = d_qrule->n_points();
+    const auto order = get_default_order(elem_type);
+
+    using FE = libMesh::FE<dim, libMesh::LAGRANGE>;
+    d_shape_values.resize(n_nodes);
+    d_reference_shape_gradients.resize(boost::extents[n_nodes][n_q_points][dim]);
+    for (unsigned int n = 0; n < n_nodes; ++n)
+    {
+        d_shape_values[n].resize(n_q_points);
+        for (unsigned int q = 0; q < n_q_points; ++q)
+        {
+            d_shape_values[n][q] = FE::shape(elem_type, order, n, d_qrule->qp(q));
+            for (unsigned int d = 0; d < dim; ++d)
+            {
+                d_reference_shape_gradients[n][q][d] = FE::shape_deriv(elem_type, order, n, d, d_qrule->qp(q));
+            }
+        }
+    }
+
+    d_nodes.resize(boost::extents[n_nodes][spacedim]);
+    d_contravariants.resize(boost::extents[n_q_points][spacedim][dim]);
+    d_covariants.resize(boost::extents[n_q_points][spacedim][dim]);
+    d_Jacobians.resize(n_q_points);
+    d_JxW.resize(n_q_points);
+    d_quadrature_points.resize(boost::extents[n_q_points][spacedim]);
+    if (d_update_flags & update_dphi) d_shape_gradients.resize(boost::extents[n_nodes][n_q_points][spacedim]);
+    d_elem_type = elem_type;
+}
+
 template <int dim, int spacedim>
 FEValues<dim, spacedim>::ReferenceValues::ReferenceValues(const libMesh::QBase& quadrature)
     : d_elem_type(quadrature.get_elem_type())
@@ -238,6 +516,19 @@ template class FEValues<1, 3>;
 template class FEValues<2, 2>;
 template class FEValues<2, 3>;
 template class FEValues<3, 3>;
+
+template class FEValuesBatch<1, 1>;
+template class FEValuesBatch<1, 2>;
+template class FEValuesBatch<1, 3>;
+template class FEValuesBatch<2, 2>;
+template class FEValuesBatch<2, 3>;
+template class FEValuesBatch<3, 3>;
+template class FEValuesBatch<1, 1, 8>;
+template class FEValuesBatch<1, 2, 8>;
+template class FEValuesBatch<1, 3, 8>;
+template class FEValuesBatch<2, 2, 8>;
+template class FEValuesBatch<2, 3, 8>;
+template class FEValuesBatch<3, 3, 8>;
 } // namespace IBTK
 
 /////////////////////////////////////////////////////////////////////////////
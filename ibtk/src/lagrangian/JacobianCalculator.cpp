@@ -130,9 +130,11 @@ Mapping<2, 2>::build(const key_type key, const FEUpdateFlags update_flags)
     case libMesh::ElemType::TRI3:
         return std::unique_ptr<Mapping<2, 2> >(new Tri3Mapping(key, update_flags));
     case libMesh::ElemType::TRI6:
-        return std::unique_ptr<Mapping<2, 2> >(new LagrangeMapping<2, 2, 6>(key, update_flags));
+        return std::unique_ptr<Mapping<2, 2> >(new Tri6Mapping(key, update_flags));
     case libMesh::ElemType::QUAD4:
         return std::unique_ptr<Mapping<2, 2> >(new Quad4Mapping(key, update_flags));
+    case libMesh::ElemType::QUAD8:
+        return std::unique_ptr<Mapping<2, 2> >(new Quad8Mapping(key, update_flags));
     case libMesh::ElemType::QUAD9:
         return std::unique_ptr<Mapping<2, 2> >(new Quad9Mapping(key, update_flags));
     default:
@@ -153,9 +155,15 @@ Mapping<3, 3>::build(const key_type key, const FEUpdateFlags update_flags)
     case libMesh::ElemType::TET10:
         return std::unique_ptr<Mapping<3, 3> >(new Tet10Mapping(key, update_flags));
     case libMesh::ElemType::HEX8:
-        return std::unique_ptr<Mapping<3, 3> >(new LagrangeMapping<3, 3, 8>(key, update_flags));
+        return std::unique_ptr<Mapping<3, 3> >(new Hex8Mapping(key, update_flags));
+    case libMesh::ElemType::HEX20:
+        return std::unique_ptr<Mapping<3, 3> >(new Hex20Mapping(key, update_flags));
     case libMesh::ElemType::HEX27:
         return std::unique_ptr<Mapping<3, 3> >(new Hex27Mapping(key, update_flags));
+    case libMesh::ElemType::PRISM6:
+        return std::unique_ptr<Mapping<3, 3> >(new Prism6Mapping(key, update_flags));
+    case libMesh::ElemType::PRISM15:
+        return std::unique_ptr<Mapping<3, 3> >(new Prism15Mapping(key, update_flags));
     default:
         return std::unique_ptr<Mapping<3, 3> >(new LagrangeMapping<3, 3>(key, update_flags));
     }
@@ -163,6 +171,40 @@ Mapping<3, 3>::build(const key_type key, const FEUpdateFlags update_flags)
     return {};
 }
 
+template <>
+std::unique_ptr<Mapping<1, 2> >
+Mapping<1, 2>::build(const key_type key, const FEUpdateFlags update_flags)
+{
+    switch (std::get<0>(key))
+    {
+    case libMesh::ElemType::EDGE2:
+        return std::unique_ptr<Mapping<1, 2> >(new Edge2Mapping(key, update_flags));
+    default:
+        return std::unique_ptr<Mapping<1, 2> >(new LagrangeMapping<1, 2>(key, update_flags));
+    }
+
+    return {};
+}
+
+template <>
+std::unique_ptr<Mapping<2, 3> >
+Mapping<2, 3>::build(const key_type key, const FEUpdateFlags update_flags)
+{
+    switch (std::get<0>(key))
+    {
+    case libMesh::ElemType::TRI3:
+        return std::unique_ptr<Mapping<2, 3> >(new Tri3SurfaceMapping(key, update_flags));
+    case libMesh::ElemType::TRI6:
+        return std::unique_ptr<Mapping<2, 3> >(new Tri6SurfaceMapping(key, update_flags));
+    case libMesh::ElemType::QUAD4:
+        return std::unique_ptr<Mapping<2, 3> >(new Quad4SurfaceMapping(key, update_flags));
+    default:
+        return std::unique_ptr<Mapping<2, 3> >(new LagrangeMapping<2, 3>(key, update_flags));
+    }
+
+    return {};
+}
+
 template <int dim, int spacedim>
 std::unique_ptr<Mapping<dim, spacedim> >
 Mapping<dim, spacedim>::build(const key_type key, const FEUpdateFlags update_flags)
@@ -362,7 +404,9 @@ void
 Tri3Mapping::fillTransforms(const libMesh::Elem* elem)
 {
     TBOX_ASSERT(this->d_update_flags & FEUpdateFlags::update_contravariants);
-    TBOX_ASSERT(elem->type() == std::get<0>(this->d_quad_key));
+    // also permit TRI6
+    const auto type = elem->type();
+    TBOX_ASSERT(type == libMesh::TRI3 || type == libMesh::TRI6);
 
     const libMesh::Point p0 = elem->point(0);
     const libMesh::Point p1 = elem->point(1);
@@ -398,7 +442,9 @@ void
 Quad4Mapping::fillTransforms(const libMesh::Elem* elem)
 {
     TBOX_ASSERT(this->d_update_flags & FEUpdateFlags::update_contravariants);
-    TBOX_ASSERT(elem->type() == std::get<0>(this->d_quad_key));
+    // also permit QUAD8 and QUAD9
+    const auto type = elem->type();
+    TBOX_ASSERT(type == libMesh::QUAD4 || type == libMesh::QUAD8 || type == libMesh::QUAD9);
 
     // calculate constants in Jacobians here
     const libMesh::Point p0 = elem->point(0);
@@ -561,6 +607,103 @@ Quad9Mapping::fillTransforms(const libMesh::Elem* elem)
     return;
 }
 
+//
+// Tri6Mapping
+//
+
+Tri6Mapping::Tri6Mapping(const key_type quad_key, const FEUpdateFlags update_flags)
+    : LagrangeMapping<2, 2, 6>(quad_key, update_flags),
+      tri3_mapping(std::make_tuple(libMesh::TRI3, std::get<1>(quad_key), std::get<2>(quad_key)), update_flags)
+{
+}
+
+void
+Tri6Mapping::reinit(const libMesh::Elem* elem)
+{
+    if (elem_is_affine(elem))
+    {
+        tri3_mapping.reinit(elem);
+        // If we ever add more fields to the mapping classes we will need to
+        // duplicate them here
+        std::swap(d_contravariants, tri3_mapping.d_contravariants);
+        std::swap(d_covariants, tri3_mapping.d_covariants);
+        std::swap(d_Jacobians, tri3_mapping.d_Jacobians);
+        std::swap(d_JxW, tri3_mapping.d_JxW);
+        std::swap(d_quadrature_points, tri3_mapping.d_quadrature_points);
+    }
+    else
+        LagrangeMapping<2, 2, 6>::reinit(elem);
+}
+
+bool
+Tri6Mapping::elem_is_affine(const libMesh::Elem* elem)
+{
+    std::array<libMesh::Point, 6> nodes;
+    for (unsigned int n = 0; n < nodes.size(); ++n) nodes[n] = elem->node_ref(n);
+
+    // try to determine the size of the coordinates to use as the tolerance.
+    double characteristic_point_size = 0.0;
+    for (int d = 0; d < LIBMESH_DIM; ++d)
+    {
+        characteristic_point_size += std::abs(nodes[0](d));
+        characteristic_point_size += std::abs(nodes[2](d));
+    }
+    const double tol = 1e-16 * characteristic_point_size;
+
+    return nodes[3].absolute_fuzzy_equals(0.5 * (nodes[0] + nodes[1]), tol) &&
+           nodes[4].absolute_fuzzy_equals(0.5 * (nodes[1] + nodes[2]), tol) &&
+           nodes[5].absolute_fuzzy_equals(0.5 * (nodes[0] + nodes[2]), tol);
+}
+
+//
+// Quad8Mapping
+//
+
+Quad8Mapping::Quad8Mapping(const key_type quad_key, const FEUpdateFlags update_flags)
+    : LagrangeMapping<2, 2, 8>(quad_key, update_flags),
+      quad4_mapping(std::make_tuple(libMesh::QUAD4, std::get<1>(quad_key), std::get<2>(quad_key)), update_flags)
+{
+}
+
+void
+Quad8Mapping::reinit(const libMesh::Elem* elem)
+{
+    if (elem_is_bilinear(elem))
+    {
+        quad4_mapping.reinit(elem);
+        // If we ever add more fields to the mapping classes we will need to
+        // duplicate them here
+        std::swap(d_contravariants, quad4_mapping.d_contravariants);
+        std::swap(d_covariants, quad4_mapping.d_covariants);
+        std::swap(d_Jacobians, quad4_mapping.d_Jacobians);
+        std::swap(d_JxW, quad4_mapping.d_JxW);
+        std::swap(d_quadrature_points, quad4_mapping.d_quadrature_points);
+    }
+    else
+        LagrangeMapping<2, 2, 8>::reinit(elem);
+}
+
+bool
+Quad8Mapping::elem_is_bilinear(const libMesh::Elem* elem)
+{
+    std::array<libMesh::Point, 8> nodes;
+    for (unsigned int n = 0; n < nodes.size(); ++n) nodes[n] = elem->node_ref(n);
+
+    // try to determine the size of the coordinates to use as the tolerance.
+    double characteristic_point_size = 0.0;
+    for (int d = 0; d < LIBMESH_DIM; ++d)
+    {
+        characteristic_point_size += std::abs(nodes[0](d));
+        characteristic_point_size += std::abs(nodes[2](d));
+    }
+    const double tol = 1e-16 * characteristic_point_size;
+
+    return nodes[4].absolute_fuzzy_equals(0.5 * (nodes[0] + nodes[1]), tol) &&
+           nodes[5].absolute_fuzzy_equals(0.5 * (nodes[1] + nodes[2]), tol) &&
+           nodes[6].absolute_fuzzy_equals(0.5 * (nodes[2] + nodes[3]), tol) &&
+           nodes[7].absolute_fuzzy_equals(0.5 * (nodes[0] + nodes[3]), tol);
+}
+
 //
 // Tet4Mapping
 //
@@ -657,6 +800,155 @@ Tet10Mapping::elem_is_affine(const libMesh::Elem* elem)
            nodes[9].absolute_fuzzy_equals(0.5 * (nodes[2] + nodes[3]), tol);
 }
 
+//
+// Hex8Mapping
+//
+
+void
+Hex8Mapping::fillTransforms(const libMesh::Elem* elem)
+{
+    TBOX_ASSERT(this->d_update_flags & FEUpdateFlags::update_contravariants);
+    // also permit HEX20 and HEX27
+    const auto type = elem->type();
+    TBOX_ASSERT(type == libMesh::HEX8 || type == libMesh::HEX20 || type == libMesh::HEX27);
+
+    // The trilinear mapping is
+    //
+    //     x = a + a_xi xi + a_eta eta + a_zeta zeta + a_xi_eta xi eta
+    //           + a_eta_zeta eta zeta + a_xi_zeta xi zeta + a_xi_eta_zeta xi eta zeta
+    //
+    // in which the coefficients are linear combinations of the vertices with
+    // weights given by the reference coordinates of the vertices.
+    constexpr double xi_n[8] = { -1.0, 1.0, 1.0, -1.0, -1.0, 1.0, 1.0, -1.0 };
+    constexpr double eta_n[8] = { -1.0, -1.0, 1.0, 1.0, -1.0, -1.0, 1.0, 1.0 };
+    constexpr double zeta_n[8] = { -1.0, -1.0, -1.0, -1.0, 1.0, 1.0, 1.0, 1.0 };
+    Eigen::Vector3d a_xi = Eigen::Vector3d::Zero(), a_eta = Eigen::Vector3d::Zero(),
+                    a_zeta = Eigen::Vector3d::Zero(), a_xi_eta = Eigen::Vector3d::Zero(),
+                    a_eta_zeta = Eigen::Vector3d::Zero(), a_xi_zeta = Eigen::Vector3d::Zero(),
+                    a_xi_eta_zeta = Eigen::Vector3d::Zero();
+    double characteristic_point_size = 0.0;
+    for (unsigned int n = 0; n < 8; ++n)
+    {
+        const libMesh::Point p = elem->point(n);
+        const Eigen::Vector3d x(0.125 * p(0), 0.125 * p(1), 0.125 * p(2));
+        a_xi += xi_n[n] * x;
+        a_eta += eta_n[n] * x;
+        a_zeta += zeta_n[n] * x;
+        a_xi_eta += xi_n[n] * eta_n[n] * x;
+        a_eta_zeta += eta_n[n] * zeta_n[n] * x;
+        a_xi_zeta += xi_n[n] * zeta_n[n] * x;
+        a_xi_eta_zeta += xi_n[n] * eta_n[n] * zeta_n[n] * x;
+        if (n == 0 || n == 6) characteristic_point_size += std::abs(p(0)) + std::abs(p(1)) + std::abs(p(2));
+    }
+
+    // The mapping is affine if the element is a parallelepiped.
+    const double tol = 1e-16 * characteristic_point_size;
+    d_elem_is_affine = a_xi_eta.lpNorm<Eigen::Infinity>() <= tol && a_eta_zeta.lpNorm<Eigen::Infinity>() <= tol &&
+                       a_xi_zeta.lpNorm<Eigen::Infinity>() <= tol && a_xi_eta_zeta.lpNorm<Eigen::Infinity>() <= tol;
+
+    if (d_elem_is_affine)
+    {
+        Eigen::Matrix<double, 3, 3> contravariant;
+        contravariant.col(0) = a_xi;
+        contravariant.col(1) = a_eta;
+        contravariant.col(2) = a_zeta;
+        std::fill(d_contravariants.begin(), d_contravariants.end(), contravariant);
+
+        if (this->d_update_flags & FEUpdateFlags::update_covariants)
+        {
+            const Eigen::Matrix<double, 3, 3> covariant = getCovariant(contravariant);
+            std::fill(this->d_covariants.begin(), this->d_covariants.end(), covariant);
+        }
+        return;
+    }
+
+    for (unsigned int q = 0; q < this->d_JxW.size(); ++q)
+    {
+        const double xi = d_quad_points[q](0);
+        const double eta = d_quad_points[q](1);
+        const double zeta = d_quad_points[q](2);
+
+        Eigen::Matrix<double, 3, 3>& contravariant = d_contravariants[q];
+        contravariant.col(0) = a_xi + eta * a_xi_eta + zeta * a_xi_zeta + (eta * zeta) * a_xi_eta_zeta;
+        contravariant.col(1) = a_eta + xi * a_xi_eta + zeta * a_eta_zeta + (xi * zeta) * a_xi_eta_zeta;
+        contravariant.col(2) = a_zeta + xi * a_xi_zeta + eta * a_eta_zeta + (xi * eta) * a_xi_eta_zeta;
+    }
+
+    if (this->d_update_flags & FEUpdateFlags::update_covariants)
+    {
+        for (unsigned int q = 0; q < this->d_JxW.size(); ++q)
+        {
+            const auto& contravariant = this->d_contravariants[q];
+            d_covariants[q] = getCovariant(contravariant);
+        }
+    }
+
+    return;
+}
+
+bool
+Hex8Mapping::isAffine() const
+{
+    return d_elem_is_affine;
+}
+
+//
+// Hex20Mapping
+//
+
+Hex20Mapping::Hex20Mapping(const key_type quad_key, const FEUpdateFlags update_flags)
+    : LagrangeMapping<3, 3, 20>(quad_key, update_flags),
+      hex8_mapping(std::make_tuple(libMesh::HEX8, std::get<1>(quad_key), std::get<2>(quad_key)), update_flags)
+{
+}
+
+void
+Hex20Mapping::reinit(const libMesh::Elem* elem)
+{
+    if (elem_is_trilinear(elem))
+    {
+        hex8_mapping.reinit(elem);
+        // If we ever add more fields to the mapping classes we will need to
+        // duplicate them here
+        std::swap(d_contravariants, hex8_mapping.d_contravariants);
+        std::swap(d_covariants, hex8_mapping.d_covariants);
+        std::swap(d_Jacobians, hex8_mapping.d_Jacobians);
+        std::swap(d_JxW, hex8_mapping.d_JxW);
+        std::swap(d_quadrature_points, hex8_mapping.d_quadrature_points);
+    }
+    else
+        LagrangeMapping<3, 3, 20>::reinit(elem);
+}
+
+bool
+Hex20Mapping::elem_is_trilinear(const libMesh::Elem* elem)
+{
+    std::array<libMesh::Point, 20> nodes;
+    for (unsigned int n = 0; n < nodes.size(); ++n) nodes[n] = elem->node_ref(n);
+
+    // try to determine the size of the coordinates to use as the tolerance.
+    double characteristic_point_size = 0.0;
+    for (int d = 0; d < LIBMESH_DIM; ++d)
+    {
+        characteristic_point_size += std::abs(nodes[0](d));
+        characteristic_point_size += std::abs(nodes[6](d));
+    }
+    const double tol = 1e-16 * characteristic_point_size;
+
+    return nodes[8].absolute_fuzzy_equals(0.5 * (nodes[0] + nodes[1]), tol) &&
+           nodes[9].absolute_fuzzy_equals(0.5 * (nodes[1] + nodes[2]), tol) &&
+           nodes[10].absolute_fuzzy_equals(0.5 * (nodes[2] + nodes[3]), tol) &&
+           nodes[11].absolute_fuzzy_equals(0.5 * (nodes[0] + nodes[3]), tol) &&
+           nodes[12].absolute_fuzzy_equals(0.5 * (nodes[0] + nodes[4]), tol) &&
+           nodes[13].absolute_fuzzy_equals(0.5 * (nodes[1] + nodes[5]), tol) &&
+           nodes[14].absolute_fuzzy_equals(0.5 * (nodes[2] + nodes[6]), tol) &&
+           nodes[15].absolute_fuzzy_equals(0.5 * (nodes[3] + nodes[7]), tol) &&
+           nodes[16].absolute_fuzzy_equals(0.5 * (nodes[4] + nodes[5]), tol) &&
+           nodes[17].absolute_fuzzy_equals(0.5 * (nodes[5] + nodes[6]), tol) &&
+           nodes[18].absolute_fuzzy_equals(0.5 * (nodes[6] + nodes[7]), tol) &&
+           nodes[19].absolute_fuzzy_equals(0.5 * (nodes[4] + nodes[7]), tol);
+}
+
 //
 // Hex27Mapping
 //
@@ -725,6 +1017,305 @@ Hex27Mapping::elem_is_trilinear(const libMesh::Elem* elem)
         nodes[26].absolute_fuzzy_equals(0.5 * (nodes[20] + nodes[25]), tol);
 }
 
+//
+// Prism6Mapping
+//
+
+void
+Prism6Mapping::fillTransforms(const libMesh::Elem* elem)
+{
+    TBOX_ASSERT(this->d_update_flags & FEUpdateFlags::update_contravariants);
+    // also permit PRISM15 and PRISM18
+    const auto type = elem->type();
+    TBOX_ASSERT(type == libMesh::PRISM6 || type == libMesh::PRISM15 || type == libMesh::PRISM18);
+
+    std::array<Eigen::Vector3d, 6> x;
+    for (unsigned int n = 0; n < x.size(); ++n)
+    {
+        const libMesh::Point p = elem->point(n);
+        x[n] = Eigen::Vector3d(p(0), p(1), p(2));
+    }
+
+    // The mapping is the tensor product of a linear map on the triangle and
+    // a linear map in the extruded direction. It is affine if the top
+    // triangle is a translate of the bottom triangle.
+    const Eigen::Vector3d bottom_xi = x[1] - x[0];
+    const Eigen::Vector3d bottom_eta = x[2] - x[0];
+    const Eigen::Vector3d top_xi = x[4] - x[3];
+    const Eigen::Vector3d top_eta = x[5] - x[3];
+    const double characteristic_point_size = x[0].cwiseAbs().sum() + x[5].cwiseAbs().sum();
+    const double tol = 1e-16 * characteristic_point_size;
+    d_elem_is_affine = (top_xi - bottom_xi).lpNorm<Eigen::Infinity>() <= tol &&
+                       (top_eta - bottom_eta).lpNorm<Eigen::Infinity>() <= tol;
+
+    if (d_elem_is_affine)
+    {
+        Eigen::Matrix<double, 3, 3> contravariant;
+        contravariant.col(0) = bottom_xi;
+        contravariant.col(1) = bottom_eta;
+        contravariant.col(2) = 0.5 * (x[3] - x[0]);
+        std::fill(d_contravariants.begin(), d_contravariants.end(), contravariant);
+
+        if (this->d_update_flags & FEUpdateFlags::update_covariants)
+        {
+            const Eigen::Matrix<double, 3, 3> covariant = getCovariant(contravariant);
+            std::fill(this->d_covariants.begin(), this->d_covariants.end(), covariant);
+        }
+        return;
+    }
+
+    for (unsigned int q = 0; q < this->d_JxW.size(); ++q)
+    {
+        const double xi = d_quad_points[q](0);
+        const double eta = d_quad_points[q](1);
+        const double zeta = d_quad_points[q](2);
+
+        Eigen::Matrix<double, 3, 3>& contravariant = d_contravariants[q];
+        contravariant.col(0) = 0.5 * (1.0 - zeta) * bottom_xi + 0.5 * (1.0 + zeta) * top_xi;
+        contravariant.col(1) = 0.5 * (1.0 - zeta) * bottom_eta + 0.5 * (1.0 + zeta) * top_eta;
+        contravariant.col(2) = 0.5 * ((1.0 - xi - eta) * (x[3] - x[0]) + xi * (x[4] - x[1]) + eta * (x[5] - x[2]));
+    }
+
+    if (this->d_update_flags & FEUpdateFlags::update_covariants)
+    {
+        for (unsigned int q = 0; q < this->d_JxW.size(); ++q)
+        {
+            const auto& contravariant = this->d_contravariants[q];
+            d_covariants[q] = getCovariant(contravariant);
+        }
+    }
+
+    return;
+}
+
+bool
+Prism6Mapping::isAffine() const
+{
+    return d_elem_is_affine;
+}
+
+//
+// Prism15Mapping
+//
+
+Prism15Mapping::Prism15Mapping(const key_type quad_key, const FEUpdateFlags update_flags)
+    : LagrangeMapping<3, 3, 15>(quad_key, update_flags),
+      prism6_mapping(std::make_tuple(libMesh::PRISM6, std::get<1>(quad_key), std::get<2>(quad_key)), update_flags)
+{
+}
+
+void
+Prism15Mapping::reinit(const libMesh::Elem* elem)
+{
+    if (elem_is_first_order(elem))
+    {
+        prism6_mapping.reinit(elem);
+        // If we ever add more fields to the mapping classes we will need to
+        // duplicate them here
+        std::swap(d_contravariants, prism6_mapping.d_contravariants);
+        std::swap(d_covariants, prism6_mapping.d_covariants);
+        std::swap(d_Jacobians, prism6_mapping.d_Jacobians);
+        std::swap(d_JxW, prism6_mapping.d_JxW);
+        std::swap(d_quadrature_points, prism6_mapping.d_quadrature_points);
+    }
+    else
+        LagrangeMapping<3, 3, 15>::reinit(elem);
+}
+
+bool
+Prism15Mapping::elem_is_first_order(const libMesh::Elem* elem)
+{
+    std::array<libMesh::Point, 15> nodes;
+    for (unsigned int n = 0; n < nodes.size(); ++n) nodes[n] = elem->node_ref(n);
+
+    // try to determine the size of the coordinates to use as the tolerance.
+    double characteristic_point_size = 0.0;
+    for (int d = 0; d < LIBMESH_DIM; ++d)
+    {
+        characteristic_point_size += std::abs(nodes[0](d));
+        characteristic_point_size += std::abs(nodes[5](d));
+    }
+    const double tol = 1e-16 * characteristic_point_size;
+
+    return nodes[6].absolute_fuzzy_equals(0.5 * (nodes[0] + nodes[1]), tol) &&
+           nodes[7].absolute_fuzzy_equals(0.5 * (nodes[1] + nodes[2]), tol) &&
+           nodes[8].absolute_fuzzy_equals(0.5 * (nodes[0] + nodes[2]), tol) &&
+           nodes[9].absolute_fuzzy_equals(0.5 * (nodes[0] + nodes[3]), tol) &&
+           nodes[10].absolute_fuzzy_equals(0.5 * (nodes[1] + nodes[4]), tol) &&
+           nodes[11].absolute_fuzzy_equals(0.5 * (nodes[2] + nodes[5]), tol) &&
+           nodes[12].absolute_fuzzy_equals(0.5 * (nodes[3] + nodes[4]), tol) &&
+           nodes[13].absolute_fuzzy_equals(0.5 * (nodes[4] + nodes[5]), tol) &&
+           nodes[14].absolute_fuzzy_equals(0.5 * (nodes[3] + nodes[5]), tol);
+}
+
+//
+// Edge2Mapping
+//
+
+void
+Edge2Mapping::fillTransforms(const libMesh::Elem* elem)
+{
+    TBOX_ASSERT(this->d_update_flags & FEUpdateFlags::update_contravariants);
+    TBOX_ASSERT(elem->type() == std::get<0>(this->d_quad_key));
+
+    const libMesh::Point p0 = elem->point(0);
+    const libMesh::Point p1 = elem->point(1);
+
+    // The reference element is [-1, 1].
+    Eigen::Matrix<double, 2, 1> contravariant;
+    contravariant(0, 0) = 0.5 * (p1(0) - p0(0));
+    contravariant(1, 0) = 0.5 * (p1(1) - p0(1));
+    std::fill(this->d_contravariants.begin(), this->d_contravariants.end(), contravariant);
+
+    if (this->d_update_flags & FEUpdateFlags::update_covariants)
+    {
+        const Eigen::Matrix<double, 2, 1> covariant = getCovariant(contravariant);
+        std::fill(this->d_covariants.begin(), this->d_covariants.end(), covariant);
+    }
+
+    return;
+}
+
+bool
+Edge2Mapping::isAffine() const
+{
+    return true;
+}
+
+//
+// Tri3SurfaceMapping
+//
+
+void
+Tri3SurfaceMapping::fillTransforms(const libMesh::Elem* elem)
+{
+    TBOX_ASSERT(this->d_update_flags & FEUpdateFlags::update_contravariants);
+    // also permit TRI6
+    const auto type = elem->type();
+    TBOX_ASSERT(type == libMesh::TRI3 || type == libMesh::TRI6);
+
+    const libMesh::Point p0 = elem->point(0);
+    const libMesh::Point p1 = elem->point(1);
+    const libMesh::Point p2 = elem->point(2);
+
+    Eigen::Matrix<double, 3, 2> contravariant;
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+        contravariant(d, 0) = p1(d) - p0(d);
+        contravariant(d, 1) = p2(d) - p0(d);
+    }
+    std::fill(this->d_contravariants.begin(), this->d_contravariants.end(), contravariant);
+
+    if (this->d_update_flags & FEUpdateFlags::update_covariants)
+    {
+        const Eigen::Matrix<double, 3, 2> covariant = getCovariant(contravariant);
+        std::fill(this->d_covariants.begin(), this->d_covariants.end(), covariant);
+    }
+
+    return;
+}
+
+bool
+Tri3SurfaceMapping::isAffine() const
+{
+    return true;
+}
+
+//
+// Quad4SurfaceMapping
+//
+
+void
+Quad4SurfaceMapping::fillTransforms(const libMesh::Elem* elem)
+{
+    TBOX_ASSERT(this->d_update_flags & FEUpdateFlags::update_contravariants);
+    TBOX_ASSERT(elem->type() == std::get<0>(this->d_quad_key));
+
+    // calculate constants in Jacobians here
+    const libMesh::Point p0 = elem->point(0);
+    const libMesh::Point p1 = elem->point(1);
+    const libMesh::Point p2 = elem->point(2);
+    const libMesh::Point p3 = elem->point(3);
+
+    Eigen::Vector3d a, b, c;
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+        a[d] = 0.25 * (-p0(d) + p1(d) + p2(d) - p3(d));
+        b[d] = 0.25 * (-p0(d) - p1(d) + p2(d) + p3(d));
+        c[d] = 0.25 * (p0(d) - p1(d) + p2(d) - p3(d));
+    }
+
+    // The mapping is affine if the element is a parallelogram.
+    double characteristic_point_size = 0.0;
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+        characteristic_point_size += std::abs(p0(d));
+        characteristic_point_size += std::abs(p2(d));
+    }
+    d_elem_is_affine = c.lpNorm<Eigen::Infinity>() <= 1e-16 * characteristic_point_size;
+
+    for (unsigned int i = 0; i < this->d_JxW.size(); i++)
+    {
+        // calculate Jacobians here
+        const double x = d_elem_is_affine ? 0.0 : d_quad_points[i](0);
+        const double y = d_elem_is_affine ? 0.0 : d_quad_points[i](1);
+
+        Eigen::Matrix<double, 3, 2>& contravariant = d_contravariants[i];
+        contravariant.col(0) = a + c * y;
+        contravariant.col(1) = b + c * x;
+    }
+
+    if (this->d_update_flags & FEUpdateFlags::update_covariants)
+    {
+        for (unsigned int q = 0; q < this->d_JxW.size(); ++q)
+        {
+            if (d_elem_is_affine && q > 0)
+            {
+                d_covariants[q] = d_covariants[0];
+                continue;
+            }
+            const auto& contravariant = this->d_contravariants[q];
+            d_covariants[q] = getCovariant(contravariant);
+        }
+    }
+
+    return;
+}
+
+bool
+Quad4SurfaceMapping::isAffine() const
+{
+    return d_elem_is_affine;
+}
+
+//
+// Tri6SurfaceMapping
+//
+
+Tri6SurfaceMapping::Tri6SurfaceMapping(const key_type quad_key, const FEUpdateFlags update_flags)
+    : LagrangeMapping<2, 3, 6>(quad_key, update_flags),
+      tri3_mapping(std::make_tuple(libMesh::TRI3, std::get<1>(quad_key), std::get<2>(quad_key)), update_flags)
+{
+}
+
+void
+Tri6SurfaceMapping::reinit(const libMesh::Elem* elem)
+{
+    if (Tri6Mapping::elem_is_affine(elem))
+    {
+        tri3_mapping.reinit(elem);
+        // If we ever add more fields to the mapping classes we will need to
+        // duplicate them here
+        std::swap(d_contravariants, tri3_mapping.d_contravariants);
+        std::swap(d_covariants, tri3_mapping.d_covariants);
+        std::swap(d_Jacobians, tri3_mapping.d_Jacobians);
+        std::swap(d_JxW, tri3_mapping.d_JxW);
+        std::swap(d_quadrature_points, tri3_mapping.d_quadrature_points);
+    }
+    else
+        LagrangeMapping<2, 3, 6>::reinit(elem);
+}
+
 //
 // Instantiations
 //
@@ -750,9 +1341,25 @@ template class LagrangeMapping<2, 2>;
 template class LagrangeMapping<2, 3>;
 template class LagrangeMapping<3, 3>;
 
+template class NodalMapping<1, 2, 2>;
 template class NodalMapping<2, 2, 3>;
 template class NodalMapping<2, 2, 4>;
+template class NodalMapping<2, 2, 6>;
+template class NodalMapping<2, 2, 8>;
 template class NodalMapping<2, 2, 9>;
+template class NodalMapping<2, 3, 3>;
+template class NodalMapping<2, 3, 4>;
+template class NodalMapping<2, 3, 6>;
 template class NodalMapping<3, 3, 4>;
+template class NodalMapping<3, 3, 6>;
+template class NodalMapping<3, 3, 8>;
+template class NodalMapping<3, 3, 15>;
+template class NodalMapping<3, 3, 20>;
+
+template class LagrangeMapping<2, 2, 6>;
+template class LagrangeMapping<2, 2, 8>;
+template class LagrangeMapping<2, 3, 6>;
+template class LagrangeMapping<3, 3, 15>;
+template class LagrangeMapping<3, 3, 20>;
 
 } // namespace IBTK
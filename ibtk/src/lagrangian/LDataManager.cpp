@@ -1976,6 +1976,26 @@ LDataManager::addWorkloadEstimate(Pointer<PatchHierarchy<NDIM> > hierarchy,
     return;
 } // addWorkloadEstimate
 
+void
+LDataManager::setWorkloadNodeWeight(const double node_weight, const bool scale_by_kernel_width)
+{
+    TBOX_ASSERT(node_weight >= 0.0);
+    d_beta_work = node_weight;
+    if (scale_by_kernel_width)
+    {
+        const int stencil_width = std::max(LEInteractor::getStencilSize(d_default_interp_kernel_fcn),
+                                           LEInteractor::getStencilSize(d_default_spread_kernel_fcn));
+        d_beta_work *= std::pow(static_cast<double>(stencil_width) / 4.0, NDIM);
+    }
+    return;
+} // setWorkloadNodeWeight
+
+double
+LDataManager::getWorkloadNodeWeight() const
+{
+    return d_beta_work;
+} // getWorkloadNodeWeight
+
 void
 LDataManager::updateNodeCountData(const int coarsest_ln_in, const int finest_ln_in)
 {
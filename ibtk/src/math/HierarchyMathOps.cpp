@@ -19,7 +19,9 @@
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/PatchMathOps.h"
 #include "ibtk/SAMRAIDataCache.h"
+#include "ibtk/box_utilities.h"
 #include "ibtk/ibtk_enums.h"
+#include "ibtk/ibtk_macros.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
 #include "ArrayDataBasicOps.h"
@@ -400,9 +402,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -438,9 +443,12 @@ HierarchyMathOps::curl(const int dst_idx,
             {
                 Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+                const int num_patches = static_cast<int>(patches.size());
+                IBTK_OMP(parallel for schedule(dynamic))
+                for (int k = 0; k < num_patches; ++k)
                 {
-                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    const Pointer<Patch<NDIM> >& patch = patches[k];
 
                     Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
                     Pointer<SideData<NDIM, double> > sc_data = patch->getPatchData(d_sc_idx);
@@ -584,9 +592,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -612,9 +623,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -640,9 +654,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -668,9 +685,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -700,9 +720,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -732,9 +755,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<EdgeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -931,9 +957,12 @@ HierarchyMathOps::div(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete divergence.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1011,9 +1040,12 @@ HierarchyMathOps::div(const int dst_idx,
 
         // Compute the discrete divergence and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1069,9 +1101,12 @@ HierarchyMathOps::div(const int dst_idx,
 
         // Compute the discrete divergence and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1119,9 +1154,12 @@ HierarchyMathOps::grad(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete gradient.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1218,9 +1256,12 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1277,9 +1318,12 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1483,9 +1527,12 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1580,9 +1627,12 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1670,9 +1720,12 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1718,9 +1771,12 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1766,9 +1822,12 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1817,9 +1876,12 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1861,9 +1923,12 @@ HierarchyMathOps::interp(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Interpolate.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1889,9 +1954,12 @@ HierarchyMathOps::interp(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Interpolate.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<EdgeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1918,9 +1986,12 @@ HierarchyMathOps::interp(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Interpolate.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1947,9 +2018,12 @@ HierarchyMathOps::interp(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Interpolate.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<EdgeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1982,9 +2056,12 @@ HierarchyMathOps::harmonic_interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -2027,9 +2104,12 @@ HierarchyMathOps::harmonic_interp(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Interpolate
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -2056,9 +2136,12 @@ HierarchyMathOps::harmonic_interp(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Interpolate.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<EdgeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -2131,9 +2214,12 @@ HierarchyMathOps::laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete Laplacian.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2348,9 +2434,12 @@ HierarchyMathOps::laplace(const int dst_idx,
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2374,9 +2463,12 @@ HierarchyMathOps::laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
@@ -104,6 +104,152 @@ get_shift(int dir, int shift)
     return iv;
 } // get_shift
 
+// Return the standard (2*NDIM+1)-point finite difference stencil.
+std::vector<hier::Index<NDIM> >
+get_laplace_op_stencil()
+{
+    static const int stencil_sz = 2 * NDIM + 1;
+    std::vector<hier::Index<NDIM> > stencil(stencil_sz, hier::Index<NDIM>(0));
+    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
+    {
+        for (int side = 0; side <= 1; ++side, ++stencil_index)
+        {
+            stencil[stencil_index](axis) = (side == 0 ? -1 : +1);
+        }
+    }
+    return stencil;
+} // get_laplace_op_stencil
+
+// Set the values of a cell-centered Laplacian matrix whose nonzero structure
+// has already been determined.
+void
+set_patch_level_cc_laplace_op_values(Mat& mat,
+                                     const PoissonSpecifications& poisson_spec,
+                                     const std::vector<RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                     const double data_time,
+                                     const std::vector<hier::Index<NDIM> >& stencil,
+                                     const int i_lower,
+                                     const int i_upper,
+                                     const int dof_index_idx,
+                                     Pointer<PatchLevel<NDIM> > patch_level)
+{
+    int ierr;
+    const int depth = static_cast<int>(bc_coefs.size());
+    const int stencil_sz = static_cast<int>(stencil.size());
+    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+
+        // Compute matrix coefficients.
+        const IntVector<NDIM> no_ghosts(0);
+        CellData<NDIM, double> matrix_coefs(patch_box, stencil_sz * depth, no_ghosts);
+        PoissonUtilities::computeMatrixCoefficients(matrix_coefs, patch, stencil, poisson_spec, bc_coefs, data_time);
+
+        // Copy matrix entries to the PETSc matrix structure.
+        Pointer<CellData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
+        std::vector<double> mat_vals(stencil_sz);
+        std::vector<int> mat_cols(stencil_sz);
+        for (Box<NDIM>::Iterator b(CellGeometry<NDIM>::toCellBox(patch_box)); b; b++)
+        {
+            const CellIndex<NDIM>& i = b();
+            for (int d = 0; d < depth; ++d)
+            {
+                const int dof_index = (*dof_index_data)(i, d);
+                if (i_lower <= dof_index && dof_index < i_upper)
+                {
+                    // Notice that the order in which values are set corresponds
+                    // to that of the stencil.
+                    const int offset = d * stencil_sz;
+                    mat_vals[0] = matrix_coefs(i, offset);
+                    mat_cols[0] = dof_index;
+                    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
+                    {
+                        for (int side = 0; side <= 1; ++side, ++stencil_index)
+                        {
+                            mat_vals[stencil_index] = matrix_coefs(i, offset + stencil_index);
+                            mat_cols[stencil_index] = (*dof_index_data)(i + stencil[stencil_index], d);
+                        }
+                    }
+                    ierr = MatSetValues(mat, 1, &dof_index, stencil_sz, &mat_cols[0], &mat_vals[0], INSERT_VALUES);
+                    IBTK_CHKERRQ(ierr);
+                }
+            }
+        }
+    }
+
+    // Assemble the matrix.
+    ierr = MatAssemblyBegin(mat, MAT_FINAL_ASSEMBLY);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatAssemblyEnd(mat, MAT_FINAL_ASSEMBLY);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // set_patch_level_cc_laplace_op_values
+
+// Set the values of a side-centered Laplacian matrix whose nonzero structure
+// has already been determined.
+void
+set_patch_level_sc_laplace_op_values(Mat& mat,
+                                     const PoissonSpecifications& poisson_spec,
+                                     const std::vector<RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                     const double data_time,
+                                     const std::vector<hier::Index<NDIM> >& stencil,
+                                     const int i_lower,
+                                     const int i_upper,
+                                     const int dof_index_idx,
+                                     Pointer<PatchLevel<NDIM> > patch_level)
+{
+    int ierr;
+    const int stencil_sz = static_cast<int>(stencil.size());
+    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+
+        // Compute matrix coefficients.
+        const IntVector<NDIM> no_ghosts(0);
+        SideData<NDIM, double> matrix_coefs(patch_box, stencil_sz, no_ghosts);
+        PoissonUtilities::computeMatrixCoefficients(matrix_coefs, patch, stencil, poisson_spec, bc_coefs, data_time);
+
+        // Copy matrix entries to the PETSc matrix structure.
+        Pointer<SideData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
+        std::vector<double> mat_vals(stencil_sz);
+        std::vector<int> mat_cols(stencil_sz);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
+            {
+                const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
+                const int dof_index = (*dof_index_data)(i);
+                if (i_lower <= dof_index && dof_index < i_upper)
+                {
+                    // Notice that the order in which values are set corresponds
+                    // to that of the stencil.
+                    mat_vals[0] = matrix_coefs(i, 0);
+                    mat_cols[0] = dof_index;
+                    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
+                    {
+                        for (int side = 0; side <= 1; ++side, ++stencil_index)
+                        {
+                            mat_vals[stencil_index] = matrix_coefs(i, stencil_index);
+                            mat_cols[stencil_index] = (*dof_index_data)(i + stencil[stencil_index]);
+                        }
+                    }
+                    ierr = MatSetValues(mat, 1, &dof_index, stencil_sz, &mat_cols[0], &mat_vals[0], INSERT_VALUES);
+                    IBTK_CHKERRQ(ierr);
+                }
+            }
+        }
+    }
+
+    // Assemble the matrix.
+    ierr = MatAssemblyBegin(mat, MAT_FINAL_ASSEMBLY);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatAssemblyEnd(mat, MAT_FINAL_ASSEMBLY);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // set_patch_level_sc_laplace_op_values
+
 static const int LOWER = 0;
 static const int UPPER = 1;
 static const std::string CONSERVATIVE = "CONSERVATIVE";
@@ -153,15 +299,7 @@ PETScMatUtilities::constructPatchLevelCCLaplaceOp(Mat& mat,
     const int depth = static_cast<int>(bc_coefs.size());
 
     // Setup the finite difference stencil.
-    static const int stencil_sz = 2 * NDIM + 1;
-    std::vector<hier::Index<NDIM> > stencil(stencil_sz, hier::Index<NDIM>(0));
-    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
-    {
-        for (int side = 0; side <= 1; ++side, ++stencil_index)
-        {
-            stencil[stencil_index](axis) = (side == 0 ? -1 : +1);
-        }
-    }
+    const std::vector<hier::Index<NDIM> > stencil = get_laplace_op_stencil();
 
     // Determine the index ranges.
     const int mpi_rank = SAMRAI_MPI::getRank();
@@ -232,56 +370,31 @@ PETScMatUtilities::constructPatchLevelCCLaplaceOp(Mat& mat,
 
     // Set the matrix coefficients to correspond to the standard finite
     // difference approximation to the Laplacian.
-    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
-    {
-        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-
-        // Compute matrix coefficients.
-        const IntVector<NDIM> no_ghosts(0);
-        CellData<NDIM, double> matrix_coefs(patch_box, stencil_sz * depth, no_ghosts);
-        PoissonUtilities::computeMatrixCoefficients(matrix_coefs, patch, stencil, poisson_spec, bc_coefs, data_time);
-
-        // Copy matrix entries to the PETSc matrix structure.
-        Pointer<CellData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
-        std::vector<double> mat_vals(stencil_sz);
-        std::vector<int> mat_cols(stencil_sz);
-        for (Box<NDIM>::Iterator b(CellGeometry<NDIM>::toCellBox(patch_box)); b; b++)
-        {
-            const CellIndex<NDIM>& i = b();
-            for (int d = 0; d < depth; ++d)
-            {
-                const int dof_index = (*dof_index_data)(i, d);
-                if (i_lower <= dof_index && dof_index < i_upper)
-                {
-                    // Notice that the order in which values are set corresponds
-                    // to that of the stencil defined above.
-                    const int offset = d * stencil_sz;
-                    mat_vals[0] = matrix_coefs(i, offset);
-                    mat_cols[0] = dof_index;
-                    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
-                    {
-                        for (int side = 0; side <= 1; ++side, ++stencil_index)
-                        {
-                            mat_vals[stencil_index] = matrix_coefs(i, offset + stencil_index);
-                            mat_cols[stencil_index] = (*dof_index_data)(i + stencil[stencil_index], d);
-                        }
-                    }
-                    ierr = MatSetValues(mat, 1, &dof_index, stencil_sz, &mat_cols[0], &mat_vals[0], INSERT_VALUES);
-                    IBTK_CHKERRQ(ierr);
-                }
-            }
-        }
-    }
-
-    // Assemble the matrix.
-    ierr = MatAssemblyBegin(mat, MAT_FINAL_ASSEMBLY);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatAssemblyEnd(mat, MAT_FINAL_ASSEMBLY);
-    IBTK_CHKERRQ(ierr);
+    set_patch_level_cc_laplace_op_values(
+        mat, poisson_spec, bc_coefs, data_time, stencil, i_lower, i_upper, dof_index_idx, patch_level);
     return;
 } // constructPatchLevelCCLaplaceOp
 
+void
+PETScMatUtilities::updatePatchLevelCCLaplaceOp(Mat& mat,
+                                               const PoissonSpecifications& poisson_spec,
+                                               const std::vector<RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                               double data_time,
+                                               const std::vector<int>& num_dofs_per_proc,
+                                               const int dof_index_idx,
+                                               Pointer<PatchLevel<NDIM> > patch_level)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(mat);
+#endif
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int i_lower = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.begin() + mpi_rank, 0);
+    const int i_upper = i_lower + num_dofs_per_proc[mpi_rank];
+    set_patch_level_cc_laplace_op_values(
+        mat, poisson_spec, bc_coefs, data_time, get_laplace_op_stencil(), i_lower, i_upper, dof_index_idx, patch_level);
+    return;
+} // updatePatchLevelCCLaplaceOp
+
 void
 PETScMatUtilities::constructPatchLevelSCLaplaceOp(Mat& mat,
                                                   const PoissonSpecifications& poisson_spec,
@@ -303,15 +416,7 @@ PETScMatUtilities::constructPatchLevelSCLaplaceOp(Mat& mat,
     }
 
     // Setup the finite difference stencil.
-    static const int stencil_sz = 2 * NDIM + 1;
-    std::vector<hier::Index<NDIM> > stencil(stencil_sz, hier::Index<NDIM>(0));
-    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
-    {
-        for (int side = 0; side <= 1; ++side, ++stencil_index)
-        {
-            stencil[stencil_index](axis) = (side == 0 ? -1 : +1);
-        }
-    }
+    const std::vector<hier::Index<NDIM> > stencil = get_laplace_op_stencil();
 
     // Determine the index ranges.
     const int mpi_rank = SAMRAI_MPI::getRank();
@@ -378,55 +483,32 @@ PETScMatUtilities::constructPatchLevelSCLaplaceOp(Mat& mat,
 
     // Set the matrix coefficients to correspond to the standard finite
     // difference approximation to the Laplacian.
-    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
-    {
-        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-
-        // Compute matrix coefficients.
-        const IntVector<NDIM> no_ghosts(0);
-        SideData<NDIM, double> matrix_coefs(patch_box, stencil_sz, no_ghosts);
-        PoissonUtilities::computeMatrixCoefficients(matrix_coefs, patch, stencil, poisson_spec, bc_coefs, data_time);
-
-        // Copy matrix entries to the PETSc matrix structure.
-        Pointer<SideData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
-        std::vector<double> mat_vals(stencil_sz);
-        std::vector<int> mat_cols(stencil_sz);
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
-            {
-                const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
-                const int dof_index = (*dof_index_data)(i);
-                if (i_lower <= dof_index && dof_index < i_upper)
-                {
-                    // Notice that the order in which values are set corresponds
-                    // to that of the stencil defined above.
-                    mat_vals[0] = matrix_coefs(i, 0);
-                    mat_cols[0] = dof_index;
-                    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
-                    {
-                        for (int side = 0; side <= 1; ++side, ++stencil_index)
-                        {
-                            mat_vals[stencil_index] = matrix_coefs(i, stencil_index);
-                            mat_cols[stencil_index] = (*dof_index_data)(i + stencil[stencil_index]);
-                        }
-                    }
-                    ierr = MatSetValues(mat, 1, &dof_index, stencil_sz, &mat_cols[0], &mat_vals[0], INSERT_VALUES);
-                    IBTK_CHKERRQ(ierr);
-                }
-            }
-        }
-    }
-
-    // Assemble the matrix.
-    ierr = MatAssemblyBegin(mat, MAT_FINAL_ASSEMBLY);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatAssemblyEnd(mat, MAT_FINAL_ASSEMBLY);
-    IBTK_CHKERRQ(ierr);
+    set_patch_level_sc_laplace_op_values(
+        mat, poisson_spec, bc_coefs, data_time, stencil, i_lower, i_upper, dof_index_idx, patch_level);
     return;
 } // constructPatchLevelSCLaplaceOp
 
+void
+PETScMatUtilities::updatePatchLevelSCLaplaceOp(Mat& mat,
+                                               const PoissonSpecifications& poisson_spec,
+                                               const std::vector<RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                               double data_time,
+                                               const std::vector<int>& num_dofs_per_proc,
+                                               const int dof_index_idx,
+                                               Pointer<PatchLevel<NDIM> > patch_level)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(mat);
+    TBOX_ASSERT(bc_coefs.size() == NDIM);
+#endif
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int i_lower = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.begin() + mpi_rank, 0);
+    const int i_upper = i_lower + num_dofs_per_proc[mpi_rank];
+    set_patch_level_sc_laplace_op_values(
+        mat, poisson_spec, bc_coefs, data_time, get_laplace_op_stencil(), i_lower, i_upper, dof_index_idx, patch_level);
+    return;
+} // updatePatchLevelSCLaplaceOp
+
 void
 PETScMatUtilities::constructPatchLevelVCSCViscousOp(
     Mat& mat,
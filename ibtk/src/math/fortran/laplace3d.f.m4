@@ -18,290 +18,6 @@ include(SAMRAI_FORTDIR/pdat_m4arrdim3d.i)dnl
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Computes F = alpha div grad U.
-c
-c     Uses the seven point stencil to compute the discrete Laplacian of
-c     a variable U.
-c
-ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
-c
-      subroutine laplace3d(
-     &     F,F_gcw,
-     &     alpha,
-     &     U,U_gcw,
-     &     ilower0,iupper0,
-     &     ilower1,iupper1,
-     &     ilower2,iupper2,
-     &     dx)
-c
-      implicit none
-c
-c     Input.
-c
-      INTEGER ilower0,iupper0
-      INTEGER ilower1,iupper1
-      INTEGER ilower2,iupper2
-      INTEGER F_gcw,U_gcw
-
-      REAL alpha
-
-      REAL U(ilower0-U_gcw:iupper0+U_gcw,
-     &       ilower1-U_gcw:iupper1+U_gcw,
-     &       ilower2-U_gcw:iupper2+U_gcw)
-
-      REAL dx(0:NDIM-1)
-c
-c     Input/Output.
-c
-      REAL F(ilower0-F_gcw:iupper0+F_gcw,
-     &       ilower1-F_gcw:iupper1+F_gcw,
-     &       ilower2-F_gcw:iupper2+F_gcw)
-c
-c     Local variables.
-c
-      INTEGER i0,i1,i2
-      REAL    fac0,fac1,fac2
-c
-c     Compute the discrete Laplacian of U.
-c
-      fac0 = alpha/(dx(0)*dx(0))
-      fac1 = alpha/(dx(1)*dx(1))
-      fac2 = alpha/(dx(2)*dx(2))
-
-      do i2 = ilower2,iupper2
-         do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
-               F(i0,i1,i2) =
-     &              fac0*(U(i0-1,i1,i2)+U(i0+1,i1,i2)-2.d0*U(i0,i1,i2))+
-     &              fac1*(U(i0,i1-1,i2)+U(i0,i1+1,i2)-2.d0*U(i0,i1,i2))+
-     &              fac2*(U(i0,i1,i2-1)+U(i0,i1,i2+1)-2.d0*U(i0,i1,i2))
-            enddo
-         enddo
-      enddo
-c
-      return
-      end
-c
-ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
-c
-c     Computes F = alpha div grad U + beta V.
-c
-c     Uses the seven point stencil to compute the discrete Laplacian of
-c     a variable U.
-c
-ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
-c
-      subroutine laplaceadd3d(
-     &     F,F_gcw,
-     &     alpha,
-     &     U,U_gcw,
-     &     beta,
-     &     V,V_gcw,
-     &     ilower0,iupper0,
-     &     ilower1,iupper1,
-     &     ilower2,iupper2,
-     &     dx)
-c
-      implicit none
-c
-c     Input.
-c
-      INTEGER ilower0,iupper0
-      INTEGER ilower1,iupper1
-      INTEGER ilower2,iupper2
-      INTEGER F_gcw,U_gcw,V_gcw
-
-      REAL alpha
-
-      REAL U(ilower0-U_gcw:iupper0+U_gcw,
-     &       ilower1-U_gcw:iupper1+U_gcw,
-     &       ilower2-U_gcw:iupper2+U_gcw)
-
-      REAL beta
-
-      REAL V(ilower0-V_gcw:iupper0+V_gcw,
-     &       ilower1-V_gcw:iupper1+V_gcw,
-     &       ilower2-V_gcw:iupper2+V_gcw)
-
-      REAL dx(0:NDIM-1)
-c
-c     Input/Output.
-c
-      REAL F(ilower0-F_gcw:iupper0+F_gcw,
-     &       ilower1-F_gcw:iupper1+F_gcw,
-     &       ilower2-F_gcw:iupper2+F_gcw)
-c
-c     Local variables.
-c
-      INTEGER i0,i1,i2
-      REAL    fac0,fac1,fac2
-c
-c     Compute the discrete Laplacian of U.
-c
-      fac0 = alpha/(dx(0)*dx(0))
-      fac1 = alpha/(dx(1)*dx(1))
-      fac2 = alpha/(dx(2)*dx(2))
-
-      do i2 = ilower2,iupper2
-         do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
-               F(i0,i1,i2) =
-     &              fac0*(U(i0-1,i1,i2)+U(i0+1,i1,i2)-2.d0*U(i0,i1,i2))+
-     &              fac1*(U(i0,i1-1,i2)+U(i0,i1+1,i2)-2.d0*U(i0,i1,i2))+
-     &              fac2*(U(i0,i1,i2-1)+U(i0,i1,i2+1)-2.d0*U(i0,i1,i2))+
-     &              beta* V(i0,i1,i2)
-            enddo
-         enddo
-      enddo
-c
-      return
-      end
-c
-ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
-c
-c     Computes F = alpha div grad U + beta U.
-c
-c     Uses the seven point stencil to compute the damped discrete
-c     Laplacian of a variable U.
-c
-ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
-c
-      subroutine dampedlaplace3d(
-     &     F,F_gcw,
-     &     alpha,beta,
-     &     U,U_gcw,
-     &     ilower0,iupper0,
-     &     ilower1,iupper1,
-     &     ilower2,iupper2,
-     &     dx)
-c
-      implicit none
-c
-c     Input.
-c
-      INTEGER ilower0,iupper0
-      INTEGER ilower1,iupper1
-      INTEGER ilower2,iupper2
-      INTEGER F_gcw,U_gcw
-
-      REAL alpha,beta
-
-      REAL U(ilower0-U_gcw:iupper0+U_gcw,
-     &       ilower1-U_gcw:iupper1+U_gcw,
-     &       ilower2-U_gcw:iupper2+U_gcw)
-
-      REAL dx(0:NDIM-1)
-c
-c     Input/Output.
-c
-      REAL F(ilower0-F_gcw:iupper0+F_gcw,
-     &       ilower1-F_gcw:iupper1+F_gcw,
-     &       ilower2-F_gcw:iupper2+F_gcw)
-c
-c     Local variables.
-c
-      INTEGER i0,i1,i2
-      REAL    fac0,fac1,fac2
-c
-c     Compute the discrete Laplacian of U.
-c
-      fac0 = alpha/(dx(0)*dx(0))
-      fac1 = alpha/(dx(1)*dx(1))
-      fac2 = alpha/(dx(2)*dx(2))
-
-      do i2 = ilower2,iupper2
-         do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
-               F(i0,i1,i2) =
-     &              fac0*(U(i0-1,i1,i2)+U(i0+1,i1,i2)-2.d0*U(i0,i1,i2))+
-     &              fac1*(U(i0,i1-1,i2)+U(i0,i1+1,i2)-2.d0*U(i0,i1,i2))+
-     &              fac2*(U(i0,i1,i2-1)+U(i0,i1,i2+1)-2.d0*U(i0,i1,i2))+
-     &              beta* U(i0,i1,i2)
-            enddo
-         enddo
-      enddo
-c
-      return
-      end
-c
-ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
-c
-c     Computes F = alpha div grad U + beta U + gamma V.
-c
-c     Uses the seven point stencil to compute the damped discrete
-c     Laplacian of a variable U.
-c
-ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
-c
-      subroutine dampedlaplaceadd3d(
-     &     F,F_gcw,
-     &     alpha,beta,
-     &     U,U_gcw,
-     &     gamma,
-     &     V,V_gcw,
-     &     ilower0,iupper0,
-     &     ilower1,iupper1,
-     &     ilower2,iupper2,
-     &     dx)
-c
-      implicit none
-c
-c     Input.
-c
-      INTEGER ilower0,iupper0
-      INTEGER ilower1,iupper1
-      INTEGER ilower2,iupper2
-      INTEGER F_gcw,U_gcw,V_gcw
-
-      REAL alpha,beta
-
-      REAL U(ilower0-U_gcw:iupper0+U_gcw,
-     &       ilower1-U_gcw:iupper1+U_gcw,
-     &       ilower2-U_gcw:iupper2+U_gcw)
-
-      REAL gamma
-
-      REAL V(ilower0-V_gcw:iupper0+V_gcw,
-     &       ilower1-V_gcw:iupper1+V_gcw,
-     &       ilower2-V_gcw:iupper2+V_gcw)
-
-      REAL dx(0:NDIM-1)
-c
-c     Input/Output.
-c
-      REAL F(ilower0-F_gcw:iupper0+F_gcw,
-     &       ilower1-F_gcw:iupper1+F_gcw,
-     &       ilower2-F_gcw:iupper2+F_gcw)
-c
-c     Local variables.
-c
-      INTEGER i0,i1,i2
-      REAL    fac0,fac1,fac2
-c
-c     Compute the discrete Laplacian of U.
-c
-      fac0 = alpha/(dx(0)*dx(0))
-      fac1 = alpha/(dx(1)*dx(1))
-      fac2 = alpha/(dx(2)*dx(2))
-
-      do i2 = ilower2,iupper2
-         do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
-               F(i0,i1,i2) =
-     &              fac0*(U(i0-1,i1,i2)+U(i0+1,i1,i2)-2.d0*U(i0,i1,i2))+
-     &              fac1*(U(i0,i1-1,i2)+U(i0,i1+1,i2)-2.d0*U(i0,i1,i2))+
-     &              fac2*(U(i0,i1,i2-1)+U(i0,i1,i2+1)-2.d0*U(i0,i1,i2))+
-     &              beta* U(i0,i1,i2)                                  +
-     &              gamma*V(i0,i1,i2)
-            enddo
-         enddo
-      enddo
-c
-      return
-      end
-c
-ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
-c
 c     Computes F = div alpha grad U.
 c
 c     Uses a seven point stencil to compute the cell centered
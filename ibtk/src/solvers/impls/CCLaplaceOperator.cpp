@@ -266,6 +266,12 @@ CCLaplaceOperator::deallocateOperatorState()
     return;
 } // deallocateOperatorState
 
+bool
+CCLaplaceOperator::updateProblemCoefficients()
+{
+    return d_is_initialized;
+} // updateProblemCoefficients
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////
@@ -16,6 +16,7 @@
 #include "ibtk/CCPoissonHypreLevelSolver.h"
 #include "ibtk/GeneralSolver.h"
 #include "ibtk/PoissonUtilities.h"
+#include "ibtk/box_utilities.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
@@ -54,6 +55,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <mpi.h>
 
 #include <algorithm>
+#include <cmath>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -163,6 +165,8 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
         {
             if (input_db->keyExists("two_norm")) d_two_norm = input_db->getInteger("two_norm");
         }
+
+        if (input_db->keyExists("setup_reuse_tol")) d_setup_reuse_tol = input_db->getDouble("setup_reuse_tol");
     }
 
     // Setup Timers.
@@ -180,6 +184,11 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
 CCPoissonHypreLevelSolver::~CCPoissonHypreLevelSolver()
 {
     if (d_is_initialized) deallocateSolverState();
+    if (d_hypre_data_allocated)
+    {
+        destroyHypreSolver();
+        deallocateHypreData();
+    }
     return;
 } // ~CCPoissonHypreLevelSolver
 
@@ -292,35 +301,56 @@ CCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
         d_cf_boundary = new CoarseFineBoundary<NDIM>(*d_hierarchy, d_level_num, IntVector<NDIM>(1));
     }
 
-    // Allocate and initialize the hypre data structures.
+    // Determine the structure of the problem.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     const int x_idx = x.getComponentDescriptorIndex(0);
     Pointer<CellDataFactory<NDIM, double> > x_fac = var_db->getPatchDescriptor()->getPatchDataFactory(x_idx);
-    d_depth = x_fac->getDefaultDepth();
-    if (d_poisson_spec.dIsConstant())
+    const unsigned int depth = x_fac->getDefaultDepth();
+    bool grid_aligned_anisotropy = true;
+    if (!d_poisson_spec.dIsConstant())
     {
-        d_grid_aligned_anisotropy = true;
-    }
-    else
-    {
-        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
         Pointer<SideDataFactory<NDIM, double> > pdat_factory =
             var_db->getPatchDescriptor()->getPatchDataFactory(d_poisson_spec.getDPatchDataId());
 #if !defined(NDEBUG)
         TBOX_ASSERT(pdat_factory);
 #endif
-        d_grid_aligned_anisotropy = pdat_factory->getDefaultDepth() == 1;
+        grid_aligned_anisotropy = pdat_factory->getDefaultDepth() == 1;
     }
-    allocateHypreData();
-    if (d_grid_aligned_anisotropy)
+
+    // Reuse the hypre data structures retained from the previous
+    // initialization when the level layout and the problem structure are
+    // unchanged.  Otherwise, (re)allocate them.
+    std::vector<Box<NDIM> > level_boxes;
+    std::vector<int> level_mapping;
+    get_level_layout(d_level, level_boxes, level_mapping);
+    const bool reuse_hypre_data = d_hypre_data_allocated && d_hypre_hierarchy == d_hierarchy &&
+                                  d_hypre_level_num == d_level_num && d_depth == depth &&
+                                  d_grid_aligned_anisotropy == grid_aligned_anisotropy &&
+                                  d_hypre_level_boxes == level_boxes && d_hypre_level_mapping == level_mapping;
+    if (!reuse_hypre_data)
     {
-        setMatrixCoefficients_aligned();
+        if (d_hypre_data_allocated)
+        {
+            destroyHypreSolver();
+            deallocateHypreData();
+        }
+        d_depth = depth;
+        d_grid_aligned_anisotropy = grid_aligned_anisotropy;
+        allocateHypreData();
+        d_hypre_data_allocated = true;
+        d_hypre_hierarchy = d_hierarchy;
+        d_hypre_level_num = d_level_num;
+        d_hypre_level_boxes = level_boxes;
+        d_hypre_level_mapping = level_mapping;
     }
-    else
+
+    // Initialize the hypre data structures.
+    setMatrixCoefficients();
+    if (!reuse_hypre_data || !canReuseHypreSolverSetup())
     {
-        setMatrixCoefficients_nonaligned();
+        if (reuse_hypre_data) destroyHypreSolver();
+        setupHypreSolver();
     }
-    setupHypreSolver();
 
     // Indicate that the solver is initialized.
     d_is_initialized = true;
@@ -336,9 +366,9 @@ CCPoissonHypreLevelSolver::deallocateSolverState()
 
     IBTK_TIMER_START(t_deallocate_solver_state);
 
-    // Deallocate the hypre data structures.
-    destroyHypreSolver();
-    deallocateHypreData();
+    // The hypre data structures are retained so that they may be reused if
+    // the solver is reinitialized on a level with the same layout.  They are
+    // freed by the destructor or by a reinitialization on a different level.
 
     // Indicate that the solver is NOT initialized.
     d_is_initialized = false;
@@ -347,6 +377,19 @@ CCPoissonHypreLevelSolver::deallocateSolverState()
     return;
 } // deallocateSolverState
 
+bool
+CCPoissonHypreLevelSolver::updateProblemCoefficients()
+{
+    if (!d_is_initialized) return false;
+    setMatrixCoefficients();
+    if (!canReuseHypreSolverSetup())
+    {
+        destroyHypreSolver();
+        setupHypreSolver();
+    }
+    return true;
+} // updateProblemCoefficients
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -720,12 +763,32 @@ CCPoissonHypreLevelSolver::setMatrixCoefficients_nonaligned()
     return;
 } // setMatrixCoefficients_nonaligned
 
+void
+CCPoissonHypreLevelSolver::setMatrixCoefficients()
+{
+    if (d_grid_aligned_anisotropy)
+    {
+        setMatrixCoefficients_aligned();
+    }
+    else
+    {
+        setMatrixCoefficients_nonaligned();
+    }
+    return;
+} // setMatrixCoefficients
+
 void
 CCPoissonHypreLevelSolver::setupHypreSolver()
 {
     // Get the MPI communicator.
     MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
 
+    // Record the coefficients used to set up the solver.
+    d_setup_coefs_constant =
+        (d_poisson_spec.cIsZero() || d_poisson_spec.cIsConstant()) && d_poisson_spec.dIsConstant();
+    d_setup_C = d_poisson_spec.cIsConstant() ? d_poisson_spec.getCConstant() : 0.0;
+    d_setup_D = d_poisson_spec.dIsConstant() ? d_poisson_spec.getDConstant() : 0.0;
+
     d_solvers.resize(d_depth);
     d_preconds.resize(d_depth);
     for (unsigned int k = 0; k < d_depth; ++k)
@@ -1281,6 +1344,17 @@ CCPoissonHypreLevelSolver::deallocateHypreData()
     return;
 } // deallocateHypreData
 
+bool
+CCPoissonHypreLevelSolver::canReuseHypreSolverSetup() const
+{
+    if (d_setup_reuse_tol < 0.0 || !d_setup_coefs_constant) return false;
+    if (!(d_poisson_spec.cIsZero() || d_poisson_spec.cIsConstant()) || !d_poisson_spec.dIsConstant()) return false;
+    const double C = d_poisson_spec.cIsConstant() ? d_poisson_spec.getCConstant() : 0.0;
+    const double D = d_poisson_spec.getDConstant();
+    return std::abs(C - d_setup_C) <= d_setup_reuse_tol * std::abs(d_setup_C) &&
+           std::abs(D - d_setup_D) <= d_setup_reuse_tol * std::abs(d_setup_D);
+} // canReuseHypreSolverSetup
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
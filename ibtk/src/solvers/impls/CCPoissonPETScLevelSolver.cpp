@@ -149,6 +149,14 @@ CCPoissonPETScLevelSolver::deallocateSolverStateSpecialized()
     return;
 } // deallocateSolverStateSpecialized
 
+bool
+CCPoissonPETScLevelSolver::updateSolverStateSpecialized()
+{
+    PETScMatUtilities::updatePatchLevelCCLaplaceOp(
+        d_petsc_mat, d_poisson_spec, d_bc_coefs, d_solution_time, d_num_dofs_per_proc, d_dof_index_idx, d_level);
+    return true;
+} // updateSolverStateSpecialized
+
 void
 CCPoissonPETScLevelSolver::copyToPETScVec(Vec& petsc_x, SAMRAIVectorReal<NDIM, double>& x)
 {
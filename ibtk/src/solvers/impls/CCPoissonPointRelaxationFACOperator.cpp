@@ -22,6 +22,7 @@
 #include "ibtk/CartCellRobinPhysBdryOp.h"
 #include "ibtk/CellNoCornersFillPattern.h"
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
+#include "ibtk/ExtendedRobinBcCoefStrategy.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/LinearSolver.h"
@@ -30,12 +31,17 @@
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "ibtk/patch_smoothers.h"
 
 #include "ArrayData.h"
 #include "Box.h"
+#include "BoxArray.h"
+#include "BoxList.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
+#include "CellDataFactory.h"
+#include "CellVariable.h"
 #include "CoarsenOperator.h"
 #include "HierarchyCellDataOpsReal.h"
 #include "MultiblockDataTranslator.h"
@@ -45,8 +51,12 @@
 #include "PatchLevel.h"
 #include "PoissonSpecifications.h"
 #include "ProcessorMapping.h"
+#include "RefineAlgorithm.h"
+#include "RefineOperator.h"
+#include "RefineSchedule.h"
 #include "SideData.h"
 #include "Variable.h"
+#include "VariableContext.h"
 #include "VariableDatabase.h"
 #include "VariableFillPattern.h"
 #include "tbox/Array.h"
@@ -58,6 +68,8 @@
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
+#include <array>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -65,100 +77,6 @@
 #include <utility>
 #include <vector>
 
-// FORTRAN ROUTINES
-#if (NDIM == 2)
-#define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth2d, GSSMOOTH2D)
-#define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth2d, RBGSSMOOTH2D)
-#define VC_CELL_GS_SMOOTH_FC IBTK_FC_FUNC(vccellgssmooth2d, VCCELLGSSMOOTH2D)
-#define VC_CELL_RB_GS_SMOOTH_FC IBTK_FC_FUNC(vccellrbgssmooth2d, VCCELLRBGSSMOOTH2D)
-#endif
-#if (NDIM == 3)
-#define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth3d, GSSMOOTH3D)
-#define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth3d, RBGSSMOOTH3D)
-#define VC_CELL_GS_SMOOTH_FC IBTK_FC_FUNC(vccellgssmooth3d, VCCELLGSSMOOTH3D)
-#define VC_CELL_RB_GS_SMOOTH_FC IBTK_FC_FUNC(vccellrbgssmooth3d, VCCELLRBGSSMOOTH3D)
-#endif
-
-// Function interfaces
-extern "C"
-{
-    void GS_SMOOTH_FC(double* U,
-                      const int& U_gcw,
-                      const double& alpha,
-                      const double& beta,
-                      const double* F,
-                      const int& F_gcw,
-                      const int& ilower0,
-                      const int& iupper0,
-                      const int& ilower1,
-                      const int& iupper1,
-#if (NDIM == 3)
-                      const int& ilower2,
-                      const int& iupper2,
-#endif
-                      const double* dx);
-
-    void RB_GS_SMOOTH_FC(double* U,
-                         const int& U_gcw,
-                         const double& alpha,
-                         const double& beta,
-                         const double* F,
-                         const int& F_gcw,
-                         const int& ilower0,
-                         const int& iupper0,
-                         const int& ilower1,
-                         const int& iupper1,
-#if (NDIM == 3)
-                         const int& ilower2,
-                         const int& iupper2,
-#endif
-                         const double* dx,
-                         const int& red_or_black);
-
-    void VC_CELL_GS_SMOOTH_FC(double* U,
-                              const int& U_gcw,
-                              const double* alpha0,
-                              const double* alpha1,
-#if (NDIM == 3)
-                              const double* alpha2,
-#endif
-                              const int& alpha_gcw,
-                              const double& beta,
-                              const double* F,
-                              const int& F_gcw,
-                              const int& ilower0,
-                              const int& iupper0,
-                              const int& ilower1,
-                              const int& iupper1,
-#if (NDIM == 3)
-                              const int& ilower2,
-                              const int& iupper2,
-#endif
-                              const double* dx);
-
-    void VC_CELL_RB_GS_SMOOTH_FC(double* U,
-                                 const int& U_gcw,
-                                 const double* alpha0,
-                                 const double* alpha1,
-#if (NDIM == 3)
-                                 const double* alpha2,
-#endif
-                                 const int& alpha_gcw,
-                                 const double& beta,
-                                 const double* F,
-                                 const int& F_gcw,
-                                 const int& ilower0,
-                                 const int& iupper0,
-                                 const int& ilower1,
-                                 const int& iupper1,
-#if (NDIM == 3)
-                                 const int& ilower2,
-                                 const int& iupper2,
-#endif
-                                 const double* dx,
-                                 const int& red_or_black);
-}
-
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBTK
@@ -236,6 +154,128 @@ do_local_data_update(SmootherType smoother_type)
         return false;
     }
 } // do_local_data_update
+
+// Register a cell-centered scratch variable with the specified ghost cell
+// width, replacing any previously registered patch data index.
+int
+register_deep_halo_variable(const std::string& var_name,
+                            Pointer<VariableContext> context,
+                            const IntVector<NDIM>& ghosts)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<Variable<NDIM> > var;
+    if (var_db->checkVariableExists(var_name))
+    {
+        var = var_db->getVariable(var_name);
+        const int idx = var_db->mapVariableAndContextToIndex(var, context);
+        if (idx != IBTK::invalid_index) var_db->removePatchDataIndex(idx);
+    }
+    else
+    {
+        var = new CellVariable<NDIM, double>(var_name, DEFAULT_DATA_DEPTH);
+    }
+    return var_db->registerVariableAndContext(var, context, ghosts);
+} // register_deep_halo_variable
+
+// Perform num_half_sweeps alternating "red" and "black" Gauss-Seidel
+// half-sweeps, starting with color first_color ("red" = 0, "black" = 1).
+// Half-sweep s updates the cells in the box grown by (halo_width - s) cells,
+// so that when halo_width > 0 the ghost cell region is smoothed redundantly
+// with a width that shrinks by one cell per half-sweep.  Cell colors are
+// determined from global cell indices, so that sweeps over different
+// (possibly overlapping) boxes are consistent.
+//
+// The half-sweeps are fused with a wavefront along the slowest-varying axis:
+// at step t, half-sweep s updates plane t - s.  Because the cells updated by a
+// half-sweep only depend on cells of the other color, this ordering gives
+// exactly the same result as performing the half-sweeps one after another,
+// while only a window of num_half_sweeps + 2 planes needs to stay in cache.
+// Within each row, cells of one color are visited with a stride of two, and
+// the row loop has no loop-carried dependencies, so that it can be
+// vectorized.
+void
+rb_gs_smooth_fused(ArrayData<NDIM, double>& U,
+                   const ArrayData<NDIM, double>& F,
+                   const int depth,
+                   const Box<NDIM>& box,
+                   const int halo_width,
+                   const int num_half_sweeps,
+                   const int first_color,
+                   const double alpha,
+                   const double beta,
+                   const double* const dx)
+{
+    static const unsigned int wavefront_axis = NDIM - 1;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(halo_width + 1 >= num_half_sweeps);
+    TBOX_ASSERT(U.getBox().contains(Box<NDIM>::grow(box, halo_width + 1)));
+    TBOX_ASSERT(F.getBox().contains(Box<NDIM>::grow(box, halo_width)));
+#endif
+    const Box<NDIM>& U_box = U.getBox();
+    const Box<NDIM>& F_box = F.getBox();
+    std::array<int, NDIM> U_stride, F_stride;
+    U_stride[0] = F_stride[0] = 1;
+    for (unsigned int d = 1; d < NDIM; ++d)
+    {
+        U_stride[d] = U_stride[d - 1] * U_box.numberCells(d - 1);
+        F_stride[d] = F_stride[d - 1] * F_box.numberCells(d - 1);
+    }
+
+    std::array<double, NDIM> fac_axis;
+    double fac_sum = 0.0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        fac_axis[d] = alpha / (dx[d] * dx[d]);
+        fac_sum += fac_axis[d];
+    }
+    const double fac = 0.5 / (fac_sum - 0.5 * beta);
+
+    double* const U_ptr = U.getPointer(depth);
+    const double* const F_ptr = F.getPointer(depth);
+    for (int t = box.lower(wavefront_axis) - halo_width; t <= box.upper(wavefront_axis) + halo_width; ++t)
+    {
+        for (int s = 0; s < num_half_sweeps; ++s)
+        {
+            const Box<NDIM> sweep_box = Box<NDIM>::grow(box, halo_width - s);
+            const int j = t - s;
+            if (j < sweep_box.lower(wavefront_axis) || j > sweep_box.upper(wavefront_axis)) continue;
+            const int color = (first_color + s) % 2;
+
+            // Loop over the rows of plane j.
+            Box<NDIM> row_box = sweep_box;
+            row_box.lower(wavefront_axis) = j;
+            row_box.upper(wavefront_axis) = j;
+            row_box.upper(0) = row_box.lower(0);
+            for (Box<NDIM>::Iterator r(row_box); r; r++)
+            {
+                hier::Index<NDIM> i = r();
+                int i_sum = 0;
+                for (unsigned int d = 0; d < NDIM; ++d) i_sum += i(d);
+                if (((i_sum % 2) + 2) % 2 != color) i(0) += 1;
+                if (i(0) > sweep_box.upper(0)) continue;
+                int U_offset = 0, F_offset = 0;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    U_offset += (i(d) - U_box.lower(d)) * U_stride[d];
+                    F_offset += (i(d) - F_box.lower(d)) * F_stride[d];
+                }
+                double* u = U_ptr + U_offset;
+                const double* f = F_ptr + F_offset;
+                const int n_cells = (sweep_box.upper(0) - i(0)) / 2 + 1;
+                for (int k = 0; k < n_cells; ++k, u += 2, f += 2)
+                {
+                    double U_nbrs = fac_axis[0] * (u[-1] + u[1]);
+                    for (unsigned int d = 1; d < NDIM; ++d)
+                    {
+                        U_nbrs += fac_axis[d] * (u[-U_stride[d]] + u[U_stride[d]]);
+                    }
+                    *u = fac * (U_nbrs - *f);
+                }
+            }
+        }
+    }
+    return;
+} // rb_gs_smooth_fused
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -275,6 +315,8 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
             d_coarse_solver_abs_residual_tol = input_db->getDouble("coarse_solver_abs_residual_tol");
         if (input_db->keyExists("coarse_solver_max_iterations"))
             d_coarse_solver_max_iterations = input_db->getInteger("coarse_solver_max_iterations");
+        if (input_db->keyExists("ghost_fill_interval"))
+            setGhostFillInterval(input_db->getInteger("ghost_fill_interval"));
         if (input_db->keyExists("coarse_solver_prefix"))
             d_coarse_solver_default_options_prefix = input_db->getString("coarse_solver_prefix");
         if (input_db->isDatabase("coarse_solver_db"))
@@ -350,6 +392,29 @@ CCPoissonPointRelaxationFACOperator::setCoarseSolverType(const std::string& coar
     return;
 } // setCoarseSolverType
 
+void
+CCPoissonPointRelaxationFACOperator::setGhostFillInterval(const int ghost_fill_interval)
+{
+    if (d_is_initialized)
+    {
+        TBOX_ERROR(d_object_name << "::setGhostFillInterval():\n"
+                                 << "  cannot be called while operator state is initialized" << std::endl);
+    }
+    if (ghost_fill_interval < 1)
+    {
+        TBOX_ERROR(d_object_name << "::setGhostFillInterval():\n"
+                                 << "  ghost fill interval must be positive" << std::endl);
+    }
+    d_ghost_fill_interval = ghost_fill_interval;
+    if (d_ghost_fill_interval > 1)
+    {
+        const IntVector<NDIM> ghosts = d_ghost_fill_interval;
+        d_deep_error_idx = register_deep_halo_variable(d_object_name + "::deep_error", d_context, ghosts);
+        d_deep_residual_idx = register_deep_halo_variable(d_object_name + "::deep_residual", d_context, ghosts);
+    }
+    return;
+} // setGhostFillInterval
+
 void
 CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>& error,
                                                  const SAMRAIVectorReal<NDIM, double>& residual,
@@ -375,6 +440,14 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     const bool red_black_ordering = use_red_black_ordering(smoother_type);
     const bool update_local_data = do_local_data_update(smoother_type);
 
+    // Use the communication-avoiding smoother when it has been requested.
+    if (d_ghost_fill_interval > 1 && red_black_ordering && d_poisson_spec.dIsConstant())
+    {
+        smoothErrorWithDeepHalo(error, residual, level_num, num_sweeps);
+        IBTK_TIMER_STOP(t_smooth_error);
+        return;
+    }
+
     // Cache coarse-fine interface ghost cell values in the "scratch" data.
     if (level_num > d_coarsest_ln && num_sweeps > 1)
     {
@@ -496,106 +569,30 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             const double& beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
             for (int depth = 0; depth < error_data->getDepth(); ++depth)
             {
-                double* const U = error_data->getPointer(depth);
-                const int U_ghosts = (error_data->getGhostCellWidth()).max();
-                const double* const F = residual_data->getPointer(depth);
-                const int F_ghosts = (residual_data->getGhostCellWidth()).max();
+                ArrayData<NDIM, double>& U = error_data->getArrayData();
+                const ArrayData<NDIM, double>& F = residual_data->getArrayData();
                 if (D_is_constant)
                 {
                     if (red_black_ordering)
                     {
                         int red_or_black = isweep % 2; // "red" = 0, "black" = 1
-                        RB_GS_SMOOTH_FC(U,
-                                        U_ghosts,
-                                        alpha,
-                                        beta,
-                                        F,
-                                        F_ghosts,
-                                        patch_box.lower(0),
-                                        patch_box.upper(0),
-                                        patch_box.lower(1),
-                                        patch_box.upper(1),
-#if (NDIM == 3)
-                                        patch_box.lower(2),
-                                        patch_box.upper(2),
-#endif
-                                        dx,
-                                        red_or_black);
+                        rb_gs_smooth(U, F, depth, patch_box, alpha, beta, dx, red_or_black);
                     }
                     else
                     {
-                        GS_SMOOTH_FC(U,
-                                     U_ghosts,
-                                     alpha,
-                                     beta,
-                                     F,
-                                     F_ghosts,
-                                     patch_box.lower(0),
-                                     patch_box.upper(0),
-                                     patch_box.lower(1),
-                                     patch_box.upper(1),
-#if (NDIM == 3)
-                                     patch_box.lower(2),
-                                     patch_box.upper(2),
-#endif
-                                     dx);
+                        gs_smooth(U, F, depth, patch_box, alpha, beta, dx);
                     }
                 }
                 else
                 {
-                    const double* const alpha0 = alpha_data->getPointer(0, depth);
-                    const double* const alpha1 = alpha_data->getPointer(1, depth);
-#if (NDIM == 3)
-                    const double* const alpha2 = alpha_data->getPointer(2, depth);
-#endif
-                    const int alpha_ghosts = (alpha_data->getGhostCellWidth()).max();
                     if (red_black_ordering)
                     {
                         int red_or_black = isweep % 2; // "red" = 0, "black" = 1
-                        VC_CELL_RB_GS_SMOOTH_FC(U,
-                                                U_ghosts,
-                                                alpha0,
-                                                alpha1,
-#if (NDIM == 3)
-                                                alpha2,
-#endif
-                                                alpha_ghosts,
-                                                beta,
-                                                F,
-                                                F_ghosts,
-                                                patch_box.lower(0),
-                                                patch_box.upper(0),
-                                                patch_box.lower(1),
-                                                patch_box.upper(1),
-#if (NDIM == 3)
-                                                patch_box.lower(2),
-                                                patch_box.upper(2),
-#endif
-                                                dx,
-                                                red_or_black);
+                        vc_cell_rb_gs_smooth(U, *alpha_data, beta, F, depth, patch_box, dx, red_or_black);
                     }
                     else
                     {
-                        VC_CELL_GS_SMOOTH_FC(U,
-                                             U_ghosts,
-                                             alpha0,
-                                             alpha1,
-#if (NDIM == 3)
-                                             alpha2,
-#endif
-                                             alpha_ghosts,
-                                             beta,
-                                             F,
-                                             F_ghosts,
-                                             patch_box.lower(0),
-                                             patch_box.upper(0),
-                                             patch_box.lower(1),
-                                             patch_box.upper(1),
-#if (NDIM == 3)
-                                             patch_box.lower(2),
-                                             patch_box.upper(2),
-#endif
-                                             dx);
+                        vc_cell_gs_smooth(U, *alpha_data, beta, F, depth, patch_box, dx);
                     }
                 }
             }
@@ -704,6 +701,17 @@ CCPoissonPointRelaxationFACOperator::computeResidual(SAMRAIVectorReal<NDIM, doub
     return;
 } // computeResidual
 
+bool
+CCPoissonPointRelaxationFACOperator::updateProblemCoefficients()
+{
+    if (!d_is_initialized) return false;
+    if (!d_coarse_solver) return true;
+    d_coarse_solver->setSolutionTime(d_solution_time);
+    d_coarse_solver->setTimeInterval(d_current_time, d_new_time);
+    d_coarse_solver->setPoissonSpecifications(d_poisson_spec);
+    return d_coarse_solver->updateProblemCoefficients();
+} // updateProblemCoefficients
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 void
@@ -745,6 +753,15 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
     Pointer<CellDataFactory<NDIM, double> > scratch_pdat_fac =
         var_db->getPatchDescriptor()->getPatchDataFactory(d_scratch_idx);
     scratch_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
+    if (d_ghost_fill_interval > 1)
+    {
+        for (const int idx : { d_deep_error_idx, d_deep_residual_idx })
+        {
+            Pointer<CellDataFactory<NDIM, double> > deep_pdat_fac =
+                var_db->getPatchDescriptor()->getPatchDataFactory(idx);
+            deep_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
+        }
+    }
 
     // Initialize the coarse level solvers when needed.
     if (coarsest_reset_ln == d_coarsest_ln && d_coarse_solver)
@@ -820,19 +837,100 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
             }
         }
     }
+
+    // Setup data for the communication-avoiding smoother.
+    if (d_ghost_fill_interval > 1)
+    {
+        d_deep_error_fill_alg = new RefineAlgorithm<NDIM>();
+        d_deep_error_fill_alg->registerRefine(
+            d_deep_error_idx, d_deep_error_idx, d_deep_error_idx, Pointer<RefineOperator<NDIM> >());
+        d_deep_error_residual_fill_alg = new RefineAlgorithm<NDIM>();
+        d_deep_error_residual_fill_alg->registerRefine(
+            d_deep_error_idx, d_deep_error_idx, d_deep_error_idx, Pointer<RefineOperator<NDIM> >());
+        d_deep_error_residual_fill_alg->registerRefine(
+            d_deep_residual_idx, d_deep_residual_idx, d_deep_residual_idx, Pointer<RefineOperator<NDIM> >());
+
+        d_deep_error_fill_scheds.resize(d_finest_ln + 1);
+        d_deep_error_residual_fill_scheds.resize(d_finest_ln + 1);
+        d_patch_deep_halo_boxes.resize(d_finest_ln + 1);
+        d_patch_bdry_ghost_boxes.resize(d_finest_ln + 1);
+        d_patch_deep_halo_is_interior.resize(d_finest_ln + 1);
+        for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            if (!level->checkAllocated(d_deep_error_idx)) level->allocatePatchData(d_deep_error_idx);
+            if (!level->checkAllocated(d_deep_residual_idx)) level->allocatePatchData(d_deep_residual_idx);
+            d_deep_error_fill_scheds[ln] = d_deep_error_fill_alg->createSchedule(level, d_bc_op.getPointer());
+            d_deep_error_residual_fill_scheds[ln] =
+                d_deep_error_residual_fill_alg->createSchedule(level, d_bc_op.getPointer());
+
+            // Patches redundantly smooth the parts of their ghost cell regions
+            // that are covered by the level, except for cells adjacent to
+            // physical boundaries or coarse-fine interfaces, whose stencils
+            // involve ghost cell values that cannot be recomputed locally.  The
+            // coarse-fine interface ghost cells are those within the physical
+            // domain that are not covered by the level.
+            const BoxList<NDIM> level_boxes(level->getBoxes());
+            BoxList<NDIM> domain_boxes(geometry->getPhysicalDomain());
+            domain_boxes.refine(level->getRatio());
+            const int num_local_patches = level->getProcessorMapping().getLocalIndices().getSize();
+            d_patch_deep_halo_boxes[ln].resize(num_local_patches);
+            d_patch_bdry_ghost_boxes[ln].resize(num_local_patches);
+            d_patch_deep_halo_is_interior[ln].resize(num_local_patches);
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+
+                BoxList<NDIM> uncovered_boxes(Box<NDIM>::grow(patch_box, d_ghost_fill_interval));
+                uncovered_boxes.removeIntersections(level_boxes);
+                d_patch_deep_halo_is_interior[ln][patch_counter] = uncovered_boxes.isEmpty();
+                uncovered_boxes.grow(IntVector<NDIM>(1));
+                BoxList<NDIM>& halo_boxes = d_patch_deep_halo_boxes[ln][patch_counter];
+                halo_boxes = level_boxes;
+                halo_boxes.intersectBoxes(Box<NDIM>::grow(patch_box, d_ghost_fill_interval - 1));
+                halo_boxes.removeIntersections(patch_box);
+                halo_boxes.removeIntersections(uncovered_boxes);
+
+                BoxList<NDIM>& bdry_ghost_boxes = d_patch_bdry_ghost_boxes[ln][patch_counter];
+                bdry_ghost_boxes = BoxList<NDIM>(Box<NDIM>::grow(patch_box, 1));
+                bdry_ghost_boxes.removeIntersections(patch_box);
+                bdry_ghost_boxes.removeIntersections(level_boxes);
+                bdry_ghost_boxes.intersectBoxes(domain_boxes);
+            }
+        }
+    }
     return;
 } // initializeOperatorStateSpecialized
 
 void
-CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const int /*coarsest_reset_ln*/,
-                                                                        const int /*finest_reset_ln*/)
+CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const int coarsest_reset_ln,
+                                                                        const int finest_reset_ln)
 {
     if (!d_is_initialized) return;
 
+    if (d_ghost_fill_interval > 1)
+    {
+        for (int ln = coarsest_reset_ln; ln <= std::min(d_finest_ln, finest_reset_ln); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            if (level->checkAllocated(d_deep_error_idx)) level->deallocatePatchData(d_deep_error_idx);
+            if (level->checkAllocated(d_deep_residual_idx)) level->deallocatePatchData(d_deep_residual_idx);
+        }
+    }
+
     if (!d_in_initialize_operator_state)
     {
         d_patch_bc_box_overlap.clear();
         d_patch_neighbor_overlap.clear();
+        d_deep_error_fill_alg.setNull();
+        d_deep_error_residual_fill_alg.setNull();
+        d_deep_error_fill_scheds.clear();
+        d_deep_error_residual_fill_scheds.clear();
+        d_patch_deep_halo_boxes.clear();
+        d_patch_bdry_ghost_boxes.clear();
+        d_patch_deep_halo_is_interior.clear();
         if (d_coarse_solver) d_coarse_solver->deallocateSolverState();
     }
     return;
@@ -840,6 +938,160 @@ CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const in
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+CCPoissonPointRelaxationFACOperator::smoothErrorWithDeepHalo(SAMRAIVectorReal<NDIM, double>& error,
+                                                             const SAMRAIVectorReal<NDIM, double>& residual,
+                                                             const int level_num,
+                                                             const int num_sweeps)
+{
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
+    const IntVector<NDIM>& ratio = level->getRatioToCoarserLevel();
+    const IntVector<NDIM> bdry_ghosts = 1;
+    const double alpha = d_poisson_spec.getDConstant();
+    const double beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+
+    // Configure the boundary condition operators to act on the deep-halo
+    // copy of the error.
+    d_bc_op->setPatchDataIndex(d_deep_error_idx);
+    d_bc_op->setPhysicalBcCoefs(d_bc_coefs);
+    d_bc_op->setHomogeneousBc(true);
+    for (const auto& bc_coef : d_bc_coefs)
+    {
+        auto extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
+        if (extended_bc_coef)
+        {
+            extended_bc_coef->setTargetPatchDataIndex(d_deep_error_idx);
+            extended_bc_coef->setHomogeneousBc(true);
+        }
+    }
+    d_cf_bdry_op->setPatchDataIndex(d_deep_error_idx);
+
+    // Copy the error and residual into the deep-halo scratch data, and cache
+    // the coarse-fine interface ghost cell values in the "scratch" data.
+    int patch_counter = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+        Pointer<CellData<NDIM, double> > residual_data = residual.getComponentPatchData(0, *patch);
+        Pointer<CellData<NDIM, double> > deep_error_data = patch->getPatchData(d_deep_error_idx);
+        Pointer<CellData<NDIM, double> > deep_residual_data = patch->getPatchData(d_deep_residual_idx);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(error_data->getDepth() == deep_error_data->getDepth());
+        TBOX_ASSERT(residual_data->getDepth() == deep_residual_data->getDepth());
+#endif
+        deep_error_data->copy(*error_data);
+        deep_residual_data->copy(*residual_data);
+        if (level_num > d_coarsest_ln)
+        {
+            Pointer<CellData<NDIM, double> > scratch_data = patch->getPatchData(d_scratch_idx);
+            scratch_data->getArrayData().copy(
+                error_data->getArrayData(), d_patch_bdry_ghost_boxes[level_num][patch_counter], IntVector<NDIM>(0));
+        }
+    }
+
+    // Smooth the error by the specified number of red-black half-sweeps,
+    // exchanging ghost cell values once every d_ghost_fill_interval
+    // half-sweeps.
+    const int num_half_sweeps = 2 * num_sweeps;
+    for (int block_begin = 0; block_begin < num_half_sweeps; block_begin += d_ghost_fill_interval)
+    {
+        if (block_begin == 0)
+        {
+            d_deep_error_residual_fill_scheds[level_num]->fillData(d_solution_time);
+        }
+        else
+        {
+            d_deep_error_fill_scheds[level_num]->fillData(d_solution_time);
+        }
+        const int num_block_sweeps = std::min(d_ghost_fill_interval, num_half_sweeps - block_begin);
+
+        patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > deep_error_data = patch->getPatchData(d_deep_error_idx);
+            Pointer<CellData<NDIM, double> > deep_residual_data = patch->getPatchData(d_deep_residual_idx);
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const dx = pgeom->getDx();
+            ArrayData<NDIM, double>& U = deep_error_data->getArrayData();
+            const ArrayData<NDIM, double>& F = deep_residual_data->getArrayData();
+
+            // Patches whose deep ghost cell regions are entirely covered by the
+            // level do not have any boundary ghost cell values to recompute
+            // between half-sweeps, so all of the half-sweeps in the block are
+            // fused into a single pass over the patch data.
+            if (d_patch_deep_halo_is_interior[level_num][patch_counter])
+            {
+                for (int depth = 0; depth < deep_error_data->getDepth(); ++depth)
+                {
+                    rb_gs_smooth_fused(U,
+                                       F,
+                                       depth,
+                                       patch_box,
+                                       d_ghost_fill_interval - 1,
+                                       num_block_sweeps,
+                                       block_begin % 2,
+                                       alpha,
+                                       beta,
+                                       dx);
+                }
+                continue;
+            }
+
+            for (int block_sweep = 0; block_sweep < num_block_sweeps; ++block_sweep)
+            {
+                // Recompute the physical boundary and coarse-fine interface
+                // ghost cell values, which depend only on data local to the
+                // patch.
+                if (level_num > d_coarsest_ln)
+                {
+                    Pointer<CellData<NDIM, double> > scratch_data = patch->getPatchData(d_scratch_idx);
+                    U.copy(scratch_data->getArrayData(),
+                           d_patch_bdry_ghost_boxes[level_num][patch_counter],
+                           IntVector<NDIM>(0));
+                }
+                d_bc_op->setPhysicalBoundaryConditions(*patch, d_solution_time, bdry_ghosts);
+                if (level_num > d_coarsest_ln) d_cf_bdry_op->computeNormalExtension(*patch, ratio, bdry_ghosts);
+
+                // Smooth the patch interior along with the part of the ghost
+                // cell region that remains valid.
+                const int halo_width = d_ghost_fill_interval - 1 - block_sweep;
+                const Box<NDIM> halo_box = Box<NDIM>::grow(patch_box, halo_width);
+                const int red_or_black = (block_begin + block_sweep) % 2; // "red" = 0, "black" = 1
+                for (int depth = 0; depth < deep_error_data->getDepth(); ++depth)
+                {
+                    rb_gs_smooth_fused(U, F, depth, patch_box, 0, 1, red_or_black, alpha, beta, dx);
+                    if (halo_width == 0) continue;
+                    for (BoxList<NDIM>::Iterator bl(d_patch_deep_halo_boxes[level_num][patch_counter]); bl; bl++)
+                    {
+                        const Box<NDIM> box = bl() * halo_box;
+                        if (box.empty()) continue;
+                        rb_gs_smooth_fused(U, F, depth, box, 0, 1, red_or_black, alpha, beta, dx);
+                    }
+                }
+            }
+        }
+    }
+
+    // Copy the smoothed values back into the error.
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+        Pointer<CellData<NDIM, double> > deep_error_data = patch->getPatchData(d_deep_error_idx);
+        error_data->getArrayData().copy(deep_error_data->getArrayData(), patch->getBox());
+    }
+
+    for (const auto& bc_coef : d_bc_coefs)
+    {
+        auto extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
+        if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+    }
+    return;
+} // smoothErrorWithDeepHalo
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -218,6 +218,13 @@ FACPreconditioner::deallocateSolverState()
     return;
 } // deallocateSolverState
 
+bool
+FACPreconditioner::updateProblemCoefficients()
+{
+    if (!d_is_initialized) return false;
+    return d_fac_strategy->updateProblemCoefficients();
+} // updateProblemCoefficients
+
 void
 FACPreconditioner::setInitialGuessNonzero(bool initial_guess_nonzero)
 {
@@ -29,6 +29,7 @@
 #include "PatchHierarchy.h"
 #include "SAMRAIVectorReal.h"
 #include "tbox/Database.h"
+#include "tbox/PIO.h"
 #include "tbox/Pointer.h"
 #include "tbox/SAMRAI_MPI.h"
 #include "tbox/Timer.h"
@@ -44,7 +45,9 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
+#include <limits>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -62,6 +65,26 @@ namespace
 static Timer* t_solve_system;
 static Timer* t_initialize_solver_state;
 static Timer* t_deallocate_solver_state;
+
+// Determine whether or not the named KSP type is one of PETSc's pipelined
+// Krylov methods, which overlap their global reductions with other work via
+// split-phase (VecXXXBegin()/VecXXXEnd()) reductions.
+bool
+is_pipelined_ksp_type(const std::string& ksp_type)
+{
+    return ksp_type.compare(0, 4, "pipe") == 0 || ksp_type == KSPPGMRES || ksp_type == KSPGROPPCG;
+}
+
+// Deallocate the data of a cloned vector and free its components.
+void
+free_cloned_vector(Pointer<SAMRAIVectorReal<NDIM, double> >& vec)
+{
+    if (!vec) return;
+    vec->deallocateVectorData();
+    vec->freeVectorComponents();
+    vec.setNull();
+    return;
+}
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -92,6 +115,8 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(std::string object_name,
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+        if (input_db->keyExists("recycle_subspace_dim"))
+            d_recycle_subspace_dim = input_db->getInteger("recycle_subspace_dim");
     }
 
     // Common constructor functionality.
@@ -155,6 +180,7 @@ PETScKrylovLinearSolver::setOperator(Pointer<LinearOperator> A)
     KrylovLinearSolver::setOperator(A);
     d_user_provided_mat = true;
     resetKSPOperators();
+    d_recycle_C_stale = !d_recycle_U.empty();
     return;
 } // setOperator
 
@@ -201,10 +227,33 @@ PETScKrylovLinearSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVe
     d_A->setHomogeneousBc(d_homogeneous_bc);
     d_A->modifyRhsForBcs(*d_b);
     d_A->setHomogeneousBc(true);
+    const bool use_recycling = d_recycle_subspace_dim > 0;
+    const bool deflate = use_recycling && applyRecycledSubspace(x);
+    if (deflate)
+    {
+        // Measure convergence of the deflated system against the original
+        // right-hand side.
+        ierr = KSPSetTolerances(d_petsc_ksp,
+                                0.0,
+                                std::max(d_abs_residual_tol, d_rel_residual_tol * d_b->L2Norm()),
+                                PETSC_DEFAULT,
+                                d_max_iterations);
+        IBTK_CHKERRQ(ierr);
+    }
     PETScSAMRAIVectorReal::replaceSAMRAIVector(d_petsc_x, Pointer<SAMRAIVectorReal<NDIM, double> >(&x, false));
-    PETScSAMRAIVectorReal::replaceSAMRAIVector(d_petsc_b, d_b);
+    PETScSAMRAIVectorReal::replaceSAMRAIVector(d_petsc_b, deflate ? d_recycle_r : d_b);
+    d_recycle_deflate = deflate;
     ierr = KSPSolve(d_petsc_ksp, d_petsc_b, d_petsc_x);
+    d_recycle_deflate = false;
     IBTK_CHKERRQ(ierr);
+    if (use_recycling)
+    {
+        updateRecycledSubspace(x, deflate);
+        ierr = KSPSetInitialGuessNonzero(d_petsc_ksp, d_initial_guess_nonzero ? PETSC_TRUE : PETSC_FALSE);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetTolerances(d_petsc_ksp, d_rel_residual_tol, d_abs_residual_tol, PETSC_DEFAULT, d_max_iterations);
+        IBTK_CHKERRQ(ierr);
+    }
     d_A->setHomogeneousBc(d_homogeneous_bc);
     d_A->imposeSolBcs(x);
 
@@ -316,6 +365,13 @@ PETScKrylovLinearSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, doub
 
     // Allocate scratch data.
     d_b->allocateVectorData();
+    if (d_recycle_subspace_dim > 0)
+    {
+        d_recycle_x0 = d_x->cloneVector(d_x->getName());
+        d_recycle_x0->allocateVectorData();
+        d_recycle_r = d_x->cloneVector(d_x->getName());
+        d_recycle_r->allocateVectorData();
+    }
 
     // Initialize the linear operator and preconditioner objects.
     if (d_A) d_A->initializeOperatorState(*d_x, *d_b);
@@ -372,8 +428,10 @@ PETScKrylovLinearSolver::deallocateSolverState()
         if (d_A) d_A->deallocateOperatorState();
     }
 
-    // Dealocate scratch data.
+    // Dealocate scratch data.  The recycled subspace is discarded since it is
+    // not valid if the hierarchy configuration changes.
     d_b->deallocateVectorData();
+    deallocateRecycledSubspace();
 
     // Delete the solution and rhs vectors.
     PETScSAMRAIVectorReal::destroyPETScVector(d_petsc_x);
@@ -405,8 +463,204 @@ PETScKrylovLinearSolver::deallocateSolverState()
     return;
 } // deallocateSolverState
 
+bool
+PETScKrylovLinearSolver::updateProblemCoefficients()
+{
+    if (!KrylovLinearSolver::updateProblemCoefficients()) return false;
+    d_recycle_C_stale = !d_recycle_U.empty();
+    return true;
+} // updateProblemCoefficients
+
+int
+PETScKrylovLinearSolver::getRecycledSubspaceDimension() const
+{
+    return static_cast<int>(d_recycle_U.size());
+} // getRecycledSubspaceDimension
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+bool
+PETScKrylovLinearSolver::applyRecycledSubspace(SAMRAIVectorReal<NDIM, double>& x)
+{
+    Pointer<SAMRAIVectorReal<NDIM, double> > x_ptr(&x, false);
+    if (!d_initial_guess_nonzero) x.setToScalar(0.0, /*interior_only*/ false);
+    if (d_recycle_C_stale) refreshRecycledSubspace();
+    const int n = static_cast<int>(d_recycle_U.size());
+    int ierr;
+    if (n == 0)
+    {
+        d_recycle_x0->copyVector(x_ptr);
+        ierr = KSPSetInitialGuessNonzero(d_petsc_ksp, PETSC_TRUE);
+        IBTK_CHKERRQ(ierr);
+        return false;
+    }
+
+    // Compute the initial residual r0 = b - A x0.
+    if (d_initial_guess_nonzero)
+    {
+        d_A->apply(x, *d_recycle_r);
+        d_recycle_r->subtract(d_b, d_recycle_r);
+    }
+    else
+    {
+        d_recycle_r->copyVector(d_b);
+    }
+
+    // Set x0 := x0 + U C^T r0 and r1 := (I - C C^T) r0.  Because C is
+    // orthonormal, this minimizes the residual over x0 + span(U).
+    std::vector<double> alpha(n);
+    for (int k = 0; k < n; ++k) alpha[k] = d_recycle_r->dot(d_recycle_C[k], /*local_only*/ true);
+    SAMRAI_MPI::sumReduction(&alpha[0], n);
+    for (int k = 0; k < n; ++k)
+    {
+        x.axpy(alpha[k], d_recycle_U[k], x_ptr);
+        d_recycle_r->axpy(-alpha[k], d_recycle_C[k], d_recycle_r);
+    }
+    d_recycle_x0->copyVector(x_ptr);
+
+    // The Krylov method solves (I - C C^T) A y = r1 starting from y = 0.
+    x.setToScalar(0.0, /*interior_only*/ false);
+    ierr = KSPSetInitialGuessNonzero(d_petsc_ksp, PETSC_FALSE);
+    IBTK_CHKERRQ(ierr);
+    return true;
+} // applyRecycledSubspace
+
+void
+PETScKrylovLinearSolver::updateRecycledSubspace(SAMRAIVectorReal<NDIM, double>& x, const bool deflated)
+{
+    Pointer<SAMRAIVectorReal<NDIM, double> > x_ptr(&x, false);
+    if (deflated)
+    {
+        // Recover the solution x = x0 + (I - U C^T A) y of the original system
+        // from the solution y of the deflated system.  The image of the
+        // correction, (I - C C^T) A y, is kept in d_recycle_r.
+        d_A->apply(x, *d_recycle_r);
+        const int n = static_cast<int>(d_recycle_C.size());
+        std::vector<double> alpha(n);
+        for (int k = 0; k < n; ++k) alpha[k] = d_recycle_r->dot(d_recycle_C[k], /*local_only*/ true);
+        SAMRAI_MPI::sumReduction(&alpha[0], n);
+        for (int k = 0; k < n; ++k)
+        {
+            x.axpy(-alpha[k], d_recycle_U[k], x_ptr);
+            d_recycle_r->axpy(-alpha[k], d_recycle_C[k], d_recycle_r);
+        }
+        x.add(x_ptr, d_recycle_x0);
+    }
+
+    // Reuse the storage of the oldest vectors when the subspace is full.
+    Pointer<SAMRAIVectorReal<NDIM, double> > u, c;
+    if (static_cast<int>(d_recycle_U.size()) >= d_recycle_subspace_dim)
+    {
+        u = d_recycle_U.front();
+        c = d_recycle_C.front();
+        d_recycle_U.erase(d_recycle_U.begin());
+        d_recycle_C.erase(d_recycle_C.begin());
+    }
+    else
+    {
+        u = d_x->cloneVector(d_x->getName());
+        u->allocateVectorData();
+        c = d_x->cloneVector(d_x->getName());
+        c->allocateVectorData();
+    }
+
+    // Add the correction u = x - x0 computed by the Krylov method and its image
+    // c = A u to the subspace.
+    u->subtract(x_ptr, d_recycle_x0);
+    if (deflated)
+    {
+        c->copyVector(d_recycle_r);
+    }
+    else
+    {
+        d_A->apply(*u, *c);
+    }
+    if (orthonormalizeRecycledVector(*u, *c))
+    {
+        d_recycle_U.push_back(u);
+        d_recycle_C.push_back(c);
+    }
+    else
+    {
+        free_cloned_vector(u);
+        free_cloned_vector(c);
+    }
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::solveSystem(): recycled subspace dimension = " << d_recycle_U.size() << "\n";
+    }
+    return;
+} // updateRecycledSubspace
+
+void
+PETScKrylovLinearSolver::refreshRecycledSubspace()
+{
+    std::vector<Pointer<SAMRAIVectorReal<NDIM, double> > > U, C;
+    U.swap(d_recycle_U);
+    C.swap(d_recycle_C);
+    for (unsigned int k = 0; k < U.size(); ++k)
+    {
+        d_A->apply(*U[k], *C[k]);
+        if (orthonormalizeRecycledVector(*U[k], *C[k]))
+        {
+            d_recycle_U.push_back(U[k]);
+            d_recycle_C.push_back(C[k]);
+        }
+        else
+        {
+            free_cloned_vector(U[k]);
+            free_cloned_vector(C[k]);
+        }
+    }
+    d_recycle_C_stale = false;
+    return;
+} // refreshRecycledSubspace
+
+bool
+PETScKrylovLinearSolver::orthonormalizeRecycledVector(SAMRAIVectorReal<NDIM, double>& u,
+                                                      SAMRAIVectorReal<NDIM, double>& c)
+{
+    Pointer<SAMRAIVectorReal<NDIM, double> > u_ptr(&u, false), c_ptr(&c, false);
+    const double c_norm_initial = c.L2Norm();
+    if (c_norm_initial == 0.0) return false;
+
+    // Use classical Gram-Schmidt with one step of reorthogonalization, so that
+    // each pass requires a single reduction.
+    const int n = static_cast<int>(d_recycle_C.size());
+    if (n > 0)
+    {
+        std::vector<double> alpha(n);
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            for (int k = 0; k < n; ++k) alpha[k] = c.dot(d_recycle_C[k], /*local_only*/ true);
+            SAMRAI_MPI::sumReduction(&alpha[0], n);
+            for (int k = 0; k < n; ++k)
+            {
+                c.axpy(-alpha[k], d_recycle_C[k], c_ptr);
+                u.axpy(-alpha[k], d_recycle_U[k], u_ptr);
+            }
+        }
+    }
+    const double c_norm = c.L2Norm();
+    if (c_norm <= std::sqrt(std::numeric_limits<double>::epsilon()) * c_norm_initial) return false;
+    c.scale(1.0 / c_norm, c_ptr);
+    u.scale(1.0 / c_norm, u_ptr);
+    return true;
+} // orthonormalizeRecycledVector
+
+void
+PETScKrylovLinearSolver::deallocateRecycledSubspace()
+{
+    for (auto& u : d_recycle_U) free_cloned_vector(u);
+    for (auto& c : d_recycle_C) free_cloned_vector(c);
+    d_recycle_U.clear();
+    d_recycle_C.clear();
+    free_cloned_vector(d_recycle_x0);
+    free_cloned_vector(d_recycle_r);
+    d_recycle_C_stale = false;
+    return;
+} // deallocateRecycledSubspace
+
 void
 PETScKrylovLinearSolver::common_ctor()
 {
@@ -564,7 +818,11 @@ PETScKrylovLinearSolver::resetKSPOptions()
     std::string ksp_type_name(ksp_type);
     if (ksp_type_name.find("gmres") != std::string::npos)
     {
-        ierr = KSPGMRESSetCGSRefinementType(d_petsc_ksp, KSP_GMRES_CGS_REFINE_IFNEEDED);
+        // Conditional refinement requires an additional blocking reduction in
+        // each iteration, which defeats the purpose of the pipelined variants.
+        const KSPGMRESCGSRefinementType refinement_type =
+            is_pipelined_ksp_type(ksp_type_name) ? KSP_GMRES_CGS_REFINE_NEVER : KSP_GMRES_CGS_REFINE_IFNEEDED;
+        ierr = KSPGMRESSetCGSRefinementType(d_petsc_ksp, refinement_type);
         IBTK_CHKERRQ(ierr);
     }
     PetscBool initial_guess_nonzero = (d_initial_guess_nonzero ? PETSC_TRUE : PETSC_FALSE);
@@ -780,6 +1038,16 @@ PETScKrylovLinearSolver::MatVecMult_SAMRAI(Mat A, Vec x, Vec y)
     PETScSAMRAIVectorReal::getSAMRAIVectorRead(x, &samrai_x);
     PETScSAMRAIVectorReal::getSAMRAIVector(y, &samrai_y);
     krylov_solver->d_A->apply(*samrai_x, *samrai_y);
+    if (krylov_solver->d_recycle_deflate)
+    {
+        // Apply the deflated operator (I - C C^T) A.
+        const std::vector<Pointer<SAMRAIVectorReal<NDIM, double> > >& C = krylov_solver->d_recycle_C;
+        const int n = static_cast<int>(C.size());
+        std::vector<double> alpha(n);
+        for (int k = 0; k < n; ++k) alpha[k] = samrai_y->dot(C[k], /*local_only*/ true);
+        SAMRAI_MPI::sumReduction(&alpha[0], n);
+        for (int k = 0; k < n; ++k) samrai_y->axpy(-alpha[k], C[k], samrai_y);
+    }
     PETScSAMRAIVectorReal::restoreSAMRAIVectorRead(x, &samrai_x);
     PETScSAMRAIVectorReal::restoreSAMRAIVector(y, &samrai_y);
     PetscFunctionReturn(0);
@@ -346,6 +346,12 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
     PCType pc_type = d_pc_type.c_str();
     ierr = PCSetType(ksp_pc, pc_type);
     IBTK_CHKERRQ(ierr);
+    if (d_agglomeration_reduction_factor > 1)
+    {
+        const int reduction_factor = std::min(d_agglomeration_reduction_factor, SAMRAI_MPI::getNodes());
+        ierr = PCTelescopeSetReductionFactor(ksp_pc, reduction_factor);
+        IBTK_CHKERRQ(ierr);
+    }
     if (d_options_prefix != "")
     {
         ierr = KSPSetOptionsPrefix(d_petsc_ksp, d_options_prefix.c_str());
@@ -364,6 +370,10 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
     // Set the nullspace.
     if (d_nullspace_contains_constant_vec || !d_nullspace_basis_vecs.empty()) setupNullspace();
 
+    // Configure the solver used on the subcommunicator.  This must follow the
+    // setup of the nullspace, which PCTELESCOPE passes on to the reduced system.
+    if (d_pc_type == PCTELESCOPE) setupAgglomeration();
+
     // Setup the preconditioner.
     if (d_pc_type == "asm")
     {
@@ -731,6 +741,82 @@ PETScLevelSolver::deallocateSolverState()
     return;
 } // deallocateSolverState
 
+bool
+PETScLevelSolver::updateProblemCoefficients()
+{
+    if (!d_is_initialized) return false;
+    if (!updateSolverStateSpecialized()) return false;
+
+    // Reset the subdomain matrices used by the shell preconditioners.  Because
+    // the nonzero structure of the matrix is unchanged, the submatrices are
+    // extracted in place.
+    int ierr;
+    if (d_pc_type == "shell")
+    {
+#if PETSC_VERSION_GE(3, 8, 0)
+        ierr = MatCreateSubMatrices(
+            d_petsc_mat, d_n_local_subdomains, &d_overlap_is[0], &d_overlap_is[0], MAT_REUSE_MATRIX, &d_sub_mat);
+#else
+        ierr = MatGetSubMatrices(
+            d_petsc_mat, d_n_local_subdomains, &d_overlap_is[0], &d_overlap_is[0], MAT_REUSE_MATRIX, &d_sub_mat);
+#endif
+        IBTK_CHKERRQ(ierr);
+        if (d_shell_pc_type == "multiplicative")
+        {
+            PetscInt n_lo, n_hi;
+            ierr = VecGetOwnershipRange(d_petsc_x, &n_lo, &n_hi);
+            IBTK_CHKERRQ(ierr);
+            IS local_idx;
+            ierr = ISCreateStride(PETSC_COMM_WORLD, n_hi - n_lo, n_lo, 1, &local_idx);
+            IBTK_CHKERRQ(ierr);
+            std::vector<IS> local_idxs(d_n_local_subdomains, local_idx);
+#if PETSC_VERSION_GE(3, 8, 0)
+            ierr = MatCreateSubMatrices(d_petsc_mat,
+                                        d_n_local_subdomains,
+                                        d_n_local_subdomains ? &d_overlap_is[0] : nullptr,
+                                        d_n_local_subdomains ? &local_idxs[0] : nullptr,
+                                        MAT_REUSE_MATRIX,
+                                        &d_sub_bc_mat);
+#else
+            ierr = MatGetSubMatrices(d_petsc_mat,
+                                     d_n_local_subdomains,
+                                     d_n_local_subdomains ? &d_overlap_is[0] : nullptr,
+                                     d_n_local_subdomains ? &local_idxs[0] : nullptr,
+                                     MAT_REUSE_MATRIX,
+                                     &d_sub_bc_mat);
+#endif
+            IBTK_CHKERRQ(ierr);
+            for (int i = 0; i < d_n_local_subdomains; ++i)
+            {
+                ierr = MatScale(d_sub_bc_mat[i], -1.0);
+                IBTK_CHKERRQ(ierr);
+            }
+            ierr = ISDestroy(&local_idx);
+            IBTK_CHKERRQ(ierr);
+        }
+        for (int i = 0; i < d_n_local_subdomains; ++i)
+        {
+            ierr = KSPSetReusePreconditioner(d_sub_ksp[i], PETSC_FALSE);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetUp(d_sub_ksp[i]);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetReusePreconditioner(d_sub_ksp[i], PETSC_TRUE);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+
+    // Recompute the numerical setup of the preconditioner.  PETSc reuses any
+    // symbolic data (e.g., ASM subdomain matrices and symbolic factorizations)
+    // because the nonzero structure of the matrix is unchanged.
+    ierr = KSPSetReusePreconditioner(d_petsc_ksp, PETSC_FALSE);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetUp(d_petsc_ksp);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetReusePreconditioner(d_petsc_ksp, PETSC_TRUE);
+    IBTK_CHKERRQ(ierr);
+    return true;
+} // updateProblemCoefficients
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 void
@@ -753,6 +839,28 @@ PETScLevelSolver::init(Pointer<Database> input_db, const std::string& default_op
             input_db->getIntegerArray("subdomain_box_size", d_box_size, NDIM);
         if (input_db->keyExists("subdomain_overlap_size"))
             input_db->getIntegerArray("subdomain_overlap_size", d_overlap_size, NDIM);
+        if (input_db->keyExists("agglomeration_reduction_factor"))
+            d_agglomeration_reduction_factor = input_db->getInteger("agglomeration_reduction_factor");
+        if (input_db->keyExists("agglomeration_pc_type"))
+            d_agglomeration_pc_type = input_db->getString("agglomeration_pc_type");
+    }
+    if (d_agglomeration_reduction_factor < 1)
+    {
+        TBOX_ERROR(d_object_name << "::init()\n"
+                                 << "  agglomeration_reduction_factor must be positive" << std::endl);
+    }
+    if (d_agglomeration_reduction_factor > 1)
+    {
+        // Agglomeration replaces the KSP preconditioner by PCTELESCOPE.
+        if (input_db && input_db->keyExists("pc_type") && d_pc_type != PCTELESCOPE)
+        {
+            TBOX_ERROR(d_object_name << "::init()\n"
+                                     << "  pc_type = " << d_pc_type
+                                     << " cannot be used with agglomeration_reduction_factor > 1\n"
+                                     << "  use agglomeration_pc_type to set the preconditioner of the reduced system"
+                                     << std::endl);
+        }
+        d_pc_type = PCTELESCOPE;
     }
     return;
 } // init
@@ -776,6 +884,12 @@ PETScLevelSolver::generateFieldSplitSubdomains(std::vector<std::string>& /*field
     return;
 } // generateFieldSplitSubdomains
 
+bool
+PETScLevelSolver::updateSolverStateSpecialized()
+{
+    return false;
+} // updateSolverStateSpecialized
+
 void
 PETScLevelSolver::setupNullspace()
 {
@@ -811,6 +925,38 @@ PETScLevelSolver::setupNullspace()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+PETScLevelSolver::setupAgglomeration()
+{
+    // The KSP used on the subcommunicator is created when the preconditioner
+    // is set up, and it exists only on the processes of the subcommunicator.
+    // Its default configuration is set directly, so that it does not affect
+    // other solvers, and options with prefix "-<options_prefix>telescope_"
+    // take precedence over it.
+    int ierr;
+    PC ksp_pc;
+    ierr = KSPGetPC(d_petsc_ksp, &ksp_pc);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCSetUp(ksp_pc);
+    IBTK_CHKERRQ(ierr);
+    KSP sub_ksp = nullptr;
+    ierr = PCTelescopeGetKSP(ksp_pc, &sub_ksp);
+    IBTK_CHKERRQ(ierr);
+    if (sub_ksp)
+    {
+        ierr = KSPSetType(sub_ksp, KSPPREONLY);
+        IBTK_CHKERRQ(ierr);
+        PC sub_pc;
+        ierr = KSPGetPC(sub_ksp, &sub_pc);
+        IBTK_CHKERRQ(ierr);
+        ierr = PCSetType(sub_pc, d_agglomeration_pc_type.c_str());
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetFromOptions(sub_ksp);
+        IBTK_CHKERRQ(ierr);
+    }
+    return;
+} // setupAgglomeration
+
 PetscErrorCode
 PETScLevelSolver::PCApply_Additive(PC pc, Vec x, Vec y)
 {
@@ -282,6 +282,12 @@ SCLaplaceOperator::deallocateOperatorState()
     return;
 } // deallocateOperatorState
 
+bool
+SCLaplaceOperator::updateProblemCoefficients()
+{
+    return d_is_initialized;
+} // updateProblemCoefficients
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////
@@ -18,6 +18,7 @@
 #include "ibtk/GeneralSolver.h"
 #include "ibtk/PoissonUtilities.h"
 #include "ibtk/SCPoissonHypreLevelSolver.h"
+#include "ibtk/box_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
 #include "BoundaryBox.h"
@@ -27,6 +28,7 @@
 #include "CoarseFineBoundary.h"
 #include "Patch.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "SideData.h"
 #include "SideGeometry.h"
 #include "SideIndex.h"
@@ -47,6 +49,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <mpi.h>
 
 #include <algorithm>
+#include <cmath>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -129,6 +132,8 @@ SCPoissonHypreLevelSolver::SCPoissonHypreLevelSolver(const std::string& object_n
         {
             if (input_db->keyExists("two_norm")) d_two_norm = input_db->getInteger("two_norm");
         }
+
+        if (input_db->keyExists("setup_reuse_tol")) d_setup_reuse_tol = input_db->getDouble("setup_reuse_tol");
     }
 
     // Setup Timers.
@@ -146,6 +151,11 @@ SCPoissonHypreLevelSolver::SCPoissonHypreLevelSolver(const std::string& object_n
 SCPoissonHypreLevelSolver::~SCPoissonHypreLevelSolver()
 {
     if (d_is_initialized) deallocateSolverState();
+    if (d_hypre_data_allocated)
+    {
+        destroyHypreSolver();
+        deallocateHypreData();
+    }
     return;
 } // ~SCPoissonHypreLevelSolver
 
@@ -260,10 +270,41 @@ SCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
         d_cf_boundary = new CoarseFineBoundary<NDIM>(*d_hierarchy, d_level_num, IntVector<NDIM>(1));
     }
 
-    // Allocate and initialize the hypre data structures.
-    allocateHypreData();
+    // Reuse the hypre data structures retained from the previous
+    // initialization when the level layout is unchanged.  Otherwise,
+    // (re)allocate them.
+    std::vector<Box<NDIM> > level_boxes;
+    std::vector<int> level_mapping;
+    get_level_layout(d_level, level_boxes, level_mapping);
+    const bool reuse_hypre_data = d_hypre_data_allocated && d_hypre_hierarchy == d_hierarchy &&
+                                  d_hypre_level_num == d_level_num && d_hypre_level_boxes == level_boxes &&
+                                  d_hypre_level_mapping == level_mapping;
+    if (!reuse_hypre_data)
+    {
+        if (d_hypre_data_allocated)
+        {
+            destroyHypreSolver();
+            deallocateHypreData();
+        }
+        allocateHypreData();
+        d_hypre_data_allocated = true;
+        d_hypre_hierarchy = d_hierarchy;
+        d_hypre_level_num = d_level_num;
+        d_hypre_level_boxes = level_boxes;
+        d_hypre_level_mapping = level_mapping;
+    }
+    else
+    {
+        HYPRE_SStructMatrixInitialize(d_matrix);
+    }
+
+    // Initialize the hypre data structures.
     setMatrixCoefficients();
-    setupHypreSolver();
+    if (!reuse_hypre_data || !canReuseHypreSolverSetup())
+    {
+        if (reuse_hypre_data) destroyHypreSolver();
+        setupHypreSolver();
+    }
 
     // Indicate that the solver is initialized.
     d_is_initialized = true;
@@ -279,9 +320,9 @@ SCPoissonHypreLevelSolver::deallocateSolverState()
 
     IBTK_TIMER_START(t_deallocate_solver_state);
 
-    // Deallocate the hypre data structures.
-    destroyHypreSolver();
-    deallocateHypreData();
+    // The hypre data structures are retained so that they may be reused if
+    // the solver is reinitialized on a level with the same layout.  They are
+    // freed by the destructor or by a reinitialization on a different level.
 
     // Indicate that the solver is NOT initialized.
     d_is_initialized = false;
@@ -290,6 +331,20 @@ SCPoissonHypreLevelSolver::deallocateSolverState()
     return;
 } // deallocateSolverState
 
+bool
+SCPoissonHypreLevelSolver::updateProblemCoefficients()
+{
+    if (!d_is_initialized) return false;
+    HYPRE_SStructMatrixInitialize(d_matrix);
+    setMatrixCoefficients();
+    if (!canReuseHypreSolverSetup())
+    {
+        destroyHypreSolver();
+        setupHypreSolver();
+    }
+    return true;
+} // updateProblemCoefficients
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -428,6 +483,10 @@ SCPoissonHypreLevelSolver::setupHypreSolver()
     // Get the MPI communicator.
     MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
 
+    // Record the coefficients used to set up the solver.
+    d_setup_C = d_poisson_spec.cIsConstant() ? d_poisson_spec.getCConstant() : 0.0;
+    d_setup_D = d_poisson_spec.getDConstant();
+
     // Determine the split solver type.
     int split_solver_type_id = -1;
     if (d_solver_type == "Split" || d_precond_type == "Split")
@@ -924,6 +983,16 @@ SCPoissonHypreLevelSolver::deallocateHypreData()
     return;
 } // deallocateHypreData
 
+bool
+SCPoissonHypreLevelSolver::canReuseHypreSolverSetup() const
+{
+    if (d_setup_reuse_tol < 0.0) return false;
+    const double C = d_poisson_spec.cIsConstant() ? d_poisson_spec.getCConstant() : 0.0;
+    const double D = d_poisson_spec.getDConstant();
+    return std::abs(C - d_setup_C) <= d_setup_reuse_tol * std::abs(d_setup_C) &&
+           std::abs(D - d_setup_D) <= d_setup_reuse_tol * std::abs(d_setup_D);
+} // canReuseHypreSolverSetup
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
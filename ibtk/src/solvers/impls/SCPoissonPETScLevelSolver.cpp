@@ -151,6 +151,14 @@ SCPoissonPETScLevelSolver::deallocateSolverStateSpecialized()
     return;
 } // deallocateSolverStateSpecialized
 
+bool
+SCPoissonPETScLevelSolver::updateSolverStateSpecialized()
+{
+    PETScMatUtilities::updatePatchLevelSCLaplaceOp(
+        d_petsc_mat, d_poisson_spec, d_bc_coefs, d_solution_time, d_num_dofs_per_proc, d_dof_index_idx, d_level);
+    return true;
+} // updateSolverStateSpecialized
+
 void
 SCPoissonPETScLevelSolver::copyToPETScVec(Vec& petsc_x, SAMRAIVectorReal<NDIM, double>& x)
 {
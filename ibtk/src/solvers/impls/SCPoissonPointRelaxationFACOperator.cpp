@@ -32,6 +32,7 @@
 #include "ibtk/StaggeredPhysicalBoundaryHelper.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "ibtk/patch_smoothers.h"
 
 #include "ArrayData.h"
 #include "Box.h"
@@ -74,94 +75,6 @@
 #include <utility>
 #include <vector>
 
-// FORTRAN ROUTINES
-#if (NDIM == 2)
-#define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth2d, GSSMOOTH2D)
-#define GS_SMOOTH_MASK_FC IBTK_FC_FUNC(gssmoothmask2d, GSSMOOTHMASK2D)
-#define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth2d, RBGSSMOOTH2D)
-#define RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(rbgssmoothmask2d, RBGSSMOOTHMASK2D)
-#endif
-#if (NDIM == 3)
-#define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth3d, GSSMOOTH3D)
-#define GS_SMOOTH_MASK_FC IBTK_FC_FUNC(gssmoothmask3d, GSSMOOTHMASK3D)
-#define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth3d, RBGSSMOOTH3D)
-#define RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(rbgssmoothmask3d, RBGSSMOOTHMASK3D)
-#endif
-
-// Function interfaces
-extern "C"
-{
-    void GS_SMOOTH_FC(double* U,
-                      const int& U_gcw,
-                      const double& alpha,
-                      const double& beta,
-                      const double* F,
-                      const int& F_gcw,
-                      const int& ilower0,
-                      const int& iupper0,
-                      const int& ilower1,
-                      const int& iupper1,
-#if (NDIM == 3)
-                      const int& ilower2,
-                      const int& iupper2,
-#endif
-                      const double* dx);
-
-    void GS_SMOOTH_MASK_FC(double* U,
-                           const int& U_gcw,
-                           const double& alpha,
-                           const double& beta,
-                           const double* F,
-                           const int& F_gcw,
-                           const int* mask,
-                           const int& mask_gcw,
-                           const int& ilower0,
-                           const int& iupper0,
-                           const int& ilower1,
-                           const int& iupper1,
-#if (NDIM == 3)
-                           const int& ilower2,
-                           const int& iupper2,
-#endif
-                           const double* dx);
-
-    void RB_GS_SMOOTH_FC(double* U,
-                         const int& U_gcw,
-                         const double& alpha,
-                         const double& beta,
-                         const double* F,
-                         const int& F_gcw,
-                         const int& ilower0,
-                         const int& iupper0,
-                         const int& ilower1,
-                         const int& iupper1,
-#if (NDIM == 3)
-                         const int& ilower2,
-                         const int& iupper2,
-#endif
-                         const double* dx,
-                         const int& red_or_black);
-
-    void RB_GS_SMOOTH_MASK_FC(double* U,
-                              const int& U_gcw,
-                              const double& alpha,
-                              const double& beta,
-                              const double* F,
-                              const int& F_gcw,
-                              const int* mask,
-                              const int& mask_gcw,
-                              const int& ilower0,
-                              const int& iupper0,
-                              const int& ilower1,
-                              const int& iupper1,
-#if (NDIM == 3)
-                              const int& ilower2,
-                              const int& iupper2,
-#endif
-                              const double* dx,
-                              const int& red_or_black);
-}
-
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBTK
@@ -514,99 +427,23 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             for (int axis = 0; axis < NDIM; ++axis)
             {
                 const Box<NDIM> side_patch_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+                ArrayData<NDIM, double>& U = error_data->getArrayData(axis);
+                const ArrayData<NDIM, double>& F = residual_data->getArrayData(axis);
+                const ArrayData<NDIM, int>* mask = nullptr;
+                if (patch_has_dirichlet_bdry && d_bc_helper->patchTouchesDirichletBoundaryAxis(patch, axis))
+                {
+                    mask = &mask_data->getArrayData(axis);
+                }
                 for (int depth = 0; depth < error_data->getDepth(); ++depth)
                 {
-                    double* const U = error_data->getPointer(axis, depth);
-                    const int U_ghosts = (error_data->getGhostCellWidth()).max();
-                    const double* const F = residual_data->getPointer(axis, depth);
-                    const int F_ghosts = (residual_data->getGhostCellWidth()).max();
-                    const int* const mask = mask_data->getPointer(axis, depth);
-                    const int mask_ghosts = (mask_data->getGhostCellWidth()).max();
-                    if (patch_has_dirichlet_bdry && d_bc_helper->patchTouchesDirichletBoundaryAxis(patch, axis))
+                    if (red_black_ordering)
                     {
-                        if (red_black_ordering)
-                        {
-                            int red_or_black = isweep % 2; // "red" = 0, "black" = 1
-                            RB_GS_SMOOTH_MASK_FC(U,
-                                                 U_ghosts,
-                                                 alpha,
-                                                 beta,
-                                                 F,
-                                                 F_ghosts,
-                                                 mask,
-                                                 mask_ghosts,
-                                                 side_patch_box.lower(0),
-                                                 side_patch_box.upper(0),
-                                                 side_patch_box.lower(1),
-                                                 side_patch_box.upper(1),
-#if (NDIM == 3)
-                                                 side_patch_box.lower(2),
-                                                 side_patch_box.upper(2),
-#endif
-                                                 dx,
-                                                 red_or_black);
-                        }
-                        else
-                        {
-                            GS_SMOOTH_MASK_FC(U,
-                                              U_ghosts,
-                                              alpha,
-                                              beta,
-                                              F,
-                                              F_ghosts,
-                                              mask,
-                                              mask_ghosts,
-                                              side_patch_box.lower(0),
-                                              side_patch_box.upper(0),
-                                              side_patch_box.lower(1),
-                                              side_patch_box.upper(1),
-#if (NDIM == 3)
-                                              side_patch_box.lower(2),
-                                              side_patch_box.upper(2),
-#endif
-                                              dx);
-                        }
+                        int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+                        rb_gs_smooth(U, F, depth, side_patch_box, alpha, beta, dx, red_or_black, mask);
                     }
                     else
                     {
-                        if (red_black_ordering)
-                        {
-                            int red_or_black = isweep % 2; // "red" = 0, "black" = 1
-                            RB_GS_SMOOTH_FC(U,
-                                            U_ghosts,
-                                            alpha,
-                                            beta,
-                                            F,
-                                            F_ghosts,
-                                            side_patch_box.lower(0),
-                                            side_patch_box.upper(0),
-                                            side_patch_box.lower(1),
-                                            side_patch_box.upper(1),
-#if (NDIM == 3)
-                                            side_patch_box.lower(2),
-                                            side_patch_box.upper(2),
-#endif
-                                            dx,
-                                            red_or_black);
-                        }
-                        else
-                        {
-                            GS_SMOOTH_FC(U,
-                                         U_ghosts,
-                                         alpha,
-                                         beta,
-                                         F,
-                                         F_ghosts,
-                                         side_patch_box.lower(0),
-                                         side_patch_box.upper(0),
-                                         side_patch_box.lower(1),
-                                         side_patch_box.upper(1),
-#if (NDIM == 3)
-                                         side_patch_box.lower(2),
-                                         side_patch_box.upper(2),
-#endif
-                                         dx);
-                        }
+                        gs_smooth(U, F, depth, side_patch_box, alpha, beta, dx, mask);
                     }
                 }
             }
@@ -720,6 +557,17 @@ SCPoissonPointRelaxationFACOperator::computeResidual(SAMRAIVectorReal<NDIM, doub
     return;
 } // computeResidual
 
+bool
+SCPoissonPointRelaxationFACOperator::updateProblemCoefficients()
+{
+    if (!d_is_initialized) return false;
+    if (!d_coarse_solver) return true;
+    d_coarse_solver->setSolutionTime(d_solution_time);
+    d_coarse_solver->setTimeInterval(d_current_time, d_new_time);
+    d_coarse_solver->setPoissonSpecifications(d_poisson_spec);
+    return d_coarse_solver->updateProblemCoefficients();
+} // updateProblemCoefficients
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 void
@@ -24,6 +24,7 @@
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "ibtk/patch_smoothers.h"
 
 #include "ArrayData.h"
 #include "Box.h"
@@ -46,202 +47,6 @@
 #include <map>
 #include <memory>
 
-// FORTRAN ROUTINES
-#if (NDIM == 2)
-#define VC_GS_SMOOTH_FC IBTK_FC_FUNC(vcgssmooth2d, VCGSSMOOTH2D)
-#define VC_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(vcgssmoothmask2d, VCGSSMOOTHMASK2D)
-#define VC_RB_GS_SMOOTH_FC IBTK_FC_FUNC(vcrbgssmooth2d, VCRBGSSMOOTH2D)
-#define VC_RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(vcrbgssmoothmask2d, VCRBGSSMOOTHMASK2D)
-#endif
-#if (NDIM == 3)
-#define VC_GS_SMOOTH_FC IBTK_FC_FUNC(vcgssmooth3d, VCGSSMOOTH3D)
-#define VC_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(vcgssmoothmask3d, VCGSSMOOTHMASK3D)
-#define VC_RB_GS_SMOOTH_FC IBTK_FC_FUNC(vcrbgssmooth3d, VCRBGSSMOOTH3D)
-#define VC_RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(vcrbgssmoothmask3d, VCRBGSSMOOTHMASK3D)
-#endif
-
-// Function interfaces
-extern "C"
-{
-    void VC_GS_SMOOTH_FC(double* U0,
-                         double* U1,
-#if (NDIM == 3)
-                         double* U2,
-#endif
-                         const int& U_gcw,
-                         const double* F0,
-                         const double* F1,
-#if (NDIM == 3)
-                         const double* F2,
-#endif
-                         const int& F_gcw,
-                         const double* C0,
-                         const double* C1,
-#if (NDIM == 3)
-                         const double* C2,
-#endif
-                         const int& C_gcw,
-#if (NDIM == 2)
-                         const double* mu,
-#endif
-#if (NDIM == 3)
-                         const double* mu0,
-                         const double* mu1,
-                         const double* mu2,
-#endif
-                         const int& mu_gcw,
-                         const double& alpha,
-                         const double& beta,
-                         const int& ilower0,
-                         const int& iupper0,
-                         const int& ilower1,
-                         const int& iupper1,
-#if (NDIM == 3)
-                         const int& ilower2,
-                         const int& iupper2,
-#endif
-                         const double* dx,
-                         const int& var_c,
-                         const int& use_harmonic_interp);
-
-    void VC_GS_SMOOTH_MASK_FC(double* U0,
-                              double* U1,
-#if (NDIM == 3)
-                              double* U2,
-#endif
-                              const int& U_gcw,
-                              const double* F0,
-                              const double* F1,
-#if (NDIM == 3)
-                              const double* F2,
-#endif
-                              const int& F_gcw,
-                              const int* mask0,
-                              const int* mask1,
-#if (NDIM == 3)
-                              const int* mask2,
-#endif
-                              const int& mask_gcw,
-                              const double* C0,
-                              const double* C1,
-#if (NDIM == 3)
-                              const double* C2,
-#endif
-                              const int& C_gcw,
-#if (NDIM == 2)
-                              const double* mu,
-#endif
-#if (NDIM == 3)
-                              const double* mu0,
-                              const double* mu1,
-                              const double* mu2,
-#endif
-                              const int& mu_gcw,
-                              const double& alpha,
-                              const double& beta,
-                              const int& ilower0,
-                              const int& iupper0,
-                              const int& ilower1,
-                              const int& iupper1,
-#if (NDIM == 3)
-                              const int& ilower2,
-                              const int& iupper2,
-#endif
-                              const double* dx,
-                              const int& var_c,
-                              const int& use_harmonic_interp);
-
-    void VC_RB_GS_SMOOTH_FC(double* U0,
-                            double* U1,
-#if (NDIM == 3)
-                            double* U2,
-#endif
-                            const int& U_gcw,
-                            const double* F0,
-                            const double* F1,
-#if (NDIM == 3)
-                            const double* F2,
-#endif
-                            const int& F_gcw,
-                            const double* C0,
-                            const double* C1,
-#if (NDIM == 3)
-                            const double* C2,
-#endif
-                            const int& C_gcw,
-#if (NDIM == 2)
-                            const double* mu,
-#endif
-#if (NDIM == 3)
-                            const double* mu0,
-                            const double* mu1,
-                            const double* mu2,
-#endif
-                            const int& mu_gcw,
-                            const double& alpha,
-                            const double& beta,
-                            const int& ilower0,
-                            const int& iupper0,
-                            const int& ilower1,
-                            const int& iupper1,
-#if (NDIM == 3)
-                            const int& ilower2,
-                            const int& iupper2,
-#endif
-                            const double* dx,
-                            const int& var_c,
-                            const int& use_harmonic_interp,
-                            const int& red_or_black);
-
-    void VC_RB_GS_SMOOTH_MASK_FC(double* U0,
-                                 double* U1,
-#if (NDIM == 3)
-                                 double* U2,
-#endif
-                                 const int& U_gcw,
-                                 const double* F0,
-                                 const double* F1,
-#if (NDIM == 3)
-                                 const double* F2,
-#endif
-                                 const int& F_gcw,
-                                 const int* mask0,
-                                 const int* mask1,
-#if (NDIM == 3)
-                                 const int* mask2,
-#endif
-                                 const int& mask_gcw,
-                                 const double* C0,
-                                 const double* C1,
-#if (NDIM == 3)
-                                 const double* C2,
-#endif
-                                 const int& C_gcw,
-#if (NDIM == 2)
-                                 const double* mu,
-#endif
-#if (NDIM == 3)
-                                 const double* mu0,
-                                 const double* mu1,
-                                 const double* mu2,
-#endif
-                                 const int& mu_gcw,
-                                 const double& alpha,
-                                 const double& beta,
-                                 const int& ilower0,
-                                 const int& iupper0,
-                                 const int& ilower1,
-                                 const int& iupper1,
-#if (NDIM == 3)
-                                 const int& ilower2,
-                                 const int& iupper2,
-#endif
-                                 const double* dx,
-                                 const int& var_c,
-                                 const int& use_harmonic_interp,
-                                 const int& red_or_black);
-}
-
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBTK
@@ -512,7 +317,6 @@ VCSCViscousOpPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
             // Smooth the error using Gauss-Seidel.
             double alpha = 1.0;
             double beta = 0.0;
-            const int C_is_varying = d_poisson_spec.cIsVariable();
             if (d_poisson_spec.cIsConstant())
             {
                 beta = d_poisson_spec.getCConstant();
@@ -522,248 +326,39 @@ VCSCViscousOpPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
                 beta = 1.0;
             }
 
+            const SideData<NDIM, int>* const mask = patch_has_dirichlet_bdry ? mask_data.getPointer() : nullptr;
+            const SideData<NDIM, double>* const C = C_data.getPointer();
             for (int depth = 0; depth < error_data->getDepth(); ++depth)
             {
-                double* const U0 = error_data->getPointer(0, depth);
-                double* const U1 = error_data->getPointer(1, depth);
-#if (NDIM == 3)
-                double* const U2 = error_data->getPointer(2, depth);
-#endif
-                const int U_ghosts = (error_data->getGhostCellWidth()).max();
-
-                const double* const F0 = residual_data->getPointer(0, depth);
-                const double* const F1 = residual_data->getPointer(1, depth);
-#if (NDIM == 3)
-                const double* const F2 = residual_data->getPointer(2, depth);
-#endif
-                const int F_ghosts = (residual_data->getGhostCellWidth()).max();
-
-                const int* const mask0 = mask_data->getPointer(0, depth);
-                const int* const mask1 = mask_data->getPointer(1, depth);
-#if (NDIM == 3)
-                const int* const mask2 = mask_data->getPointer(2, depth);
-#endif
-                const int mask_ghosts = (mask_data->getGhostCellWidth()).max();
-
-#if (NDIM == 2)
-                const double* const mu = mu_data->getPointer(depth);
-#endif
-#if (NDIM == 3)
-                const double* const mu0 = mu_data->getPointer(0, depth);
-                const double* const mu1 = mu_data->getPointer(1, depth);
-                const double* const mu2 = mu_data->getPointer(2, depth);
-#endif
-                const int mu_ghosts = (mu_data->getGhostCellWidth()).max();
-
-                const double* C0 = nullptr;
-                const double* C1 = nullptr;
-#if (NDIM == 3)
-                const double* C2 = nullptr;
-#endif
-                int C_ghosts = 0;
-                if (d_poisson_spec.cIsVariable())
+                if (red_black_ordering)
                 {
-                    C0 = C_data->getPointer(0, depth);
-                    C1 = C_data->getPointer(1, depth);
-#if (NDIM == 3)
-                    C2 = C_data->getPointer(2, depth);
-#endif
-                    C_ghosts = (C_data->getGhostCellWidth()).max();
-                }
-
-                if (patch_has_dirichlet_bdry)
-                {
-                    if (red_black_ordering)
-                    {
-                        int red_or_black = isweep % 2; // "red" = 0, "black" = 1
-                        VC_RB_GS_SMOOTH_MASK_FC(U0,
-                                                U1,
-#if (NDIM == 3)
-                                                U2,
-#endif
-                                                U_ghosts,
-                                                F0,
-                                                F1,
-#if (NDIM == 3)
-                                                F2,
-#endif
-                                                F_ghosts,
-                                                mask0,
-                                                mask1,
-#if (NDIM == 3)
-                                                mask2,
-#endif
-                                                mask_ghosts,
-                                                C0,
-                                                C1,
-#if (NDIM == 3)
-                                                C2,
-#endif
-                                                C_ghosts,
-#if (NDIM == 2)
-                                                mu,
-#endif
-#if (NDIM == 3)
-                                                mu0,
-                                                mu1,
-                                                mu2,
-#endif
-                                                mu_ghosts,
-                                                alpha,
-                                                beta,
-                                                patch_box.lower(0),
-                                                patch_box.upper(0),
-                                                patch_box.lower(1),
-                                                patch_box.upper(1),
-#if (NDIM == 3)
-                                                patch_box.lower(2),
-                                                patch_box.upper(2),
-#endif
-                                                dx,
-                                                C_is_varying,
-                                                use_harmonic_interp,
-                                                red_or_black);
-                    }
-                    else
-                    {
-                        VC_GS_SMOOTH_MASK_FC(U0,
-                                             U1,
-#if (NDIM == 3)
-                                             U2,
-#endif
-                                             U_ghosts,
-                                             F0,
-                                             F1,
-#if (NDIM == 3)
-                                             F2,
-#endif
-                                             F_ghosts,
-                                             mask0,
-                                             mask1,
-#if (NDIM == 3)
-                                             mask2,
-#endif
-                                             mask_ghosts,
-                                             C0,
-                                             C1,
-#if (NDIM == 3)
-                                             C2,
-#endif
-                                             C_ghosts,
-#if (NDIM == 2)
-                                             mu,
-#endif
-#if (NDIM == 3)
-                                             mu0,
-                                             mu1,
-                                             mu2,
-#endif
-                                             mu_ghosts,
-                                             alpha,
-                                             beta,
-                                             patch_box.lower(0),
-                                             patch_box.upper(0),
-                                             patch_box.lower(1),
-                                             patch_box.upper(1),
-#if (NDIM == 3)
-                                             patch_box.lower(2),
-                                             patch_box.upper(2),
-#endif
-                                             dx,
-                                             C_is_varying,
-                                             use_harmonic_interp);
-                    }
+                    int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+                    vc_side_rb_gs_smooth(*error_data,
+                                         *residual_data,
+                                         mask,
+                                         C,
+                                         *mu_data,
+                                         depth,
+                                         alpha,
+                                         beta,
+                                         patch_box,
+                                         dx,
+                                         use_harmonic_interp,
+                                         red_or_black);
                 }
                 else
                 {
-                    if (red_black_ordering)
-                    {
-                        int red_or_black = isweep % 2; // "red" = 0, "black" = 1
-                        VC_RB_GS_SMOOTH_FC(U0,
-                                           U1,
-#if (NDIM == 3)
-                                           U2,
-#endif
-                                           U_ghosts,
-                                           F0,
-                                           F1,
-#if (NDIM == 3)
-                                           F2,
-#endif
-                                           F_ghosts,
-                                           C0,
-                                           C1,
-#if (NDIM == 3)
-                                           C2,
-#endif
-                                           C_ghosts,
-#if (NDIM == 2)
-                                           mu,
-#endif
-#if (NDIM == 3)
-                                           mu0,
-                                           mu1,
-                                           mu2,
-#endif
-                                           mu_ghosts,
-                                           alpha,
-                                           beta,
-                                           patch_box.lower(0),
-                                           patch_box.upper(0),
-                                           patch_box.lower(1),
-                                           patch_box.upper(1),
-#if (NDIM == 3)
-                                           patch_box.lower(2),
-                                           patch_box.upper(2),
-#endif
-                                           dx,
-                                           C_is_varying,
-                                           use_harmonic_interp,
-                                           red_or_black);
-                    }
-                    else
-                    {
-                        VC_GS_SMOOTH_FC(U0,
-                                        U1,
-#if (NDIM == 3)
-                                        U2,
-#endif
-                                        U_ghosts,
-                                        F0,
-                                        F1,
-#if (NDIM == 3)
-                                        F2,
-#endif
-                                        F_ghosts,
-                                        C0,
-                                        C1,
-#if (NDIM == 3)
-                                        C2,
-#endif
-                                        C_ghosts,
-#if (NDIM == 2)
-                                        mu,
-#endif
-#if (NDIM == 3)
-                                        mu0,
-                                        mu1,
-                                        mu2,
-#endif
-                                        mu_ghosts,
-                                        alpha,
-                                        beta,
-                                        patch_box.lower(0),
-                                        patch_box.upper(0),
-                                        patch_box.lower(1),
-                                        patch_box.upper(1),
-#if (NDIM == 3)
-                                        patch_box.lower(2),
-                                        patch_box.upper(2),
-#endif
-                                        dx,
-                                        C_is_varying,
-                                        use_harmonic_interp);
-                    }
+                    vc_side_gs_smooth(*error_data,
+                                      *residual_data,
+                                      mask,
+                                      C,
+                                      *mu_data,
+                                      depth,
+                                      alpha,
+                                      beta,
+                                      patch_box,
+                                      dx,
+                                      use_harmonic_interp);
                 }
             }
         }
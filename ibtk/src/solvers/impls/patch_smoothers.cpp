@@ -0,0 +1,531 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <IBTK_config.h>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "ibtk/patch_smoothers.h"
+
+#include "ArrayData.h"
+#include "Box.h"
+#include "EdgeData.h"
+#include "Index.h"
+#include "NodeData.h"
+#include "SideData.h"
+#include "SideGeometry.h"
+
+#include "tbox/Utilities.h"
+
+#include <algorithm>
+#include <array>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Widths (in cells) of the tiles along axes 0 and 1.  In three spatial
+// dimensions, the three planes of a tile that are touched by the stencils while
+// the tile is swept along axis 2 stay in cache, so that each value is loaded
+// from memory once per sweep even for patches that are much larger than the
+// cache.
+static const int TILE_WIDTH_0 = 64;
+static const int TILE_WIDTH_1 = 16;
+
+// Value of red_or_black that selects a sweep over all cells.
+static const int ALL_CELLS = -1;
+
+// Number of viscosity values that are averaged to obtain the viscosity at a
+// cell center.
+static const int NUM_MU_CELL_NBRS = (NDIM == 2 ? 4 : 12);
+
+// Access to one depth of the data stored in an ArrayData object via global
+// indices.  T is const-qualified for read-only data.
+template <typename T>
+class ArrayView
+{
+public:
+    ArrayView() = default;
+
+    template <typename DataType>
+    ArrayView(DataType& data, const int depth) : d_ptr(data.getPointer(depth))
+    {
+        const Box<NDIM>& box = data.getBox();
+        int stride = 1;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            d_stride[d] = stride;
+            d_offset -= box.lower(d) * stride;
+            stride *= box.numberCells(d);
+        }
+    }
+
+    T* operator()(const hier::Index<NDIM>& i) const
+    {
+        int offset = d_offset;
+        for (unsigned int d = 0; d < NDIM; ++d) offset += i(d) * d_stride[d];
+        return d_ptr + offset;
+    }
+
+    int stride(const unsigned int d) const
+    {
+        return d_stride[d];
+    }
+
+private:
+    T* d_ptr = nullptr;
+    int d_offset = 0;
+    std::array<int, NDIM> d_stride{};
+};
+
+// Call row_kernel(i, n_cells, step) for each row of cells of box that is
+// updated by one sweep.  The row starts at index i and consists of n_cells
+// cells spaced step cells apart along axis 0.  If red_or_black is 0 or 1, only
+// the cells of that color are visited; otherwise, all cells are visited.
+//
+// The rows are grouped into tiles that cover axes 0 and 1.  The tiles are
+// visited in lexicographic order, and the rows within a tile are visited in
+// lexicographic order.  Since a cell only depends on its neighbors along the
+// coordinate axes, each neighbor that precedes a cell in a lexicographic sweep
+// over the whole box is also updated before the cell in this ordering, and each
+// neighbor that follows it is also updated after it.
+template <typename RowKernel>
+void
+sweep_tiles(const Box<NDIM>& box, const int red_or_black, RowKernel row_kernel)
+{
+    const bool use_red_black = (red_or_black == 0 || red_or_black == 1);
+    const int step = use_red_black ? 2 : 1;
+    for (int tile_lower_1 = box.lower(1); tile_lower_1 <= box.upper(1); tile_lower_1 += TILE_WIDTH_1)
+    {
+        for (int tile_lower_0 = box.lower(0); tile_lower_0 <= box.upper(0); tile_lower_0 += TILE_WIDTH_0)
+        {
+            const int tile_upper_0 = std::min(tile_lower_0 + TILE_WIDTH_0 - 1, box.upper(0));
+            Box<NDIM> row_box = box;
+            row_box.lower(0) = tile_lower_0;
+            row_box.upper(0) = tile_lower_0;
+            row_box.lower(1) = tile_lower_1;
+            row_box.upper(1) = std::min(tile_lower_1 + TILE_WIDTH_1 - 1, box.upper(1));
+            for (Box<NDIM>::Iterator r(row_box); r; r++)
+            {
+                hier::Index<NDIM> i = r();
+                if (use_red_black)
+                {
+                    int i_sum = 0;
+                    for (unsigned int d = 0; d < NDIM; ++d) i_sum += i(d);
+                    if (((i_sum % 2) + 2) % 2 != red_or_black) i(0) += 1;
+                    if (i(0) > tile_upper_0) continue;
+                }
+                row_kernel(i, (tile_upper_0 - i(0)) / step + 1, step);
+            }
+        }
+    }
+    return;
+} // sweep_tiles
+
+// Smooth F = alpha div grad U + beta U.  The mask is only read if MASKED is
+// true.
+template <bool MASKED>
+void
+cc_smooth(ArrayData<NDIM, double>& U_data,
+          const ArrayData<NDIM, double>& F_data,
+          const ArrayData<NDIM, int>* const mask_data,
+          const int depth,
+          const Box<NDIM>& box,
+          const double alpha,
+          const double beta,
+          const double* const dx,
+          const int red_or_black)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(U_data.getBox().contains(Box<NDIM>::grow(box, 1)));
+    TBOX_ASSERT(F_data.getBox().contains(box));
+    TBOX_ASSERT(!MASKED || mask_data->getBox().contains(box));
+#endif
+    const ArrayView<double> U(U_data, depth);
+    const ArrayView<const double> F(F_data, depth);
+    ArrayView<const int> mask;
+    if (MASKED) mask = ArrayView<const int>(*mask_data, depth);
+
+    std::array<double, NDIM> fac_axis;
+    std::array<int, NDIM> U_stride;
+    double fac_sum = 0.0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        fac_axis[d] = alpha / (dx[d] * dx[d]);
+        fac_sum += fac_axis[d];
+        U_stride[d] = U.stride(d);
+    }
+    const double fac = 0.5 / (fac_sum - 0.5 * beta);
+
+    sweep_tiles(box, red_or_black, [&](const hier::Index<NDIM>& i, const int n_cells, const int step) {
+        double* const u = U(i);
+        const double* const f = F(i);
+        const int* const m = MASKED ? mask(i) : nullptr;
+        for (int k = 0; k < n_cells * step; k += step)
+        {
+            if (MASKED && m[k] != 0) continue;
+            double U_nbrs = fac_axis[0] * (u[k - 1] + u[k + 1]);
+            for (unsigned int d = 1; d < NDIM; ++d)
+            {
+                U_nbrs += fac_axis[d] * (u[k - U_stride[d]] + u[k + U_stride[d]]);
+            }
+            u[k] = fac * (U_nbrs - f[k]);
+        }
+    });
+    return;
+} // cc_smooth
+
+// Smooth F = div alpha grad U + beta U for cell-centered U and side-centered
+// alpha.
+void
+vc_cell_smooth(ArrayData<NDIM, double>& U_data,
+               const SideData<NDIM, double>& alpha_data,
+               const double beta,
+               const ArrayData<NDIM, double>& F_data,
+               const int depth,
+               const Box<NDIM>& box,
+               const double* const dx,
+               const int red_or_black)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(U_data.getBox().contains(Box<NDIM>::grow(box, 1)));
+    TBOX_ASSERT(F_data.getBox().contains(box));
+    TBOX_ASSERT(alpha_data.getGhostBox().contains(box));
+#endif
+    const ArrayView<double> U(U_data, depth);
+    const ArrayView<const double> F(F_data, depth);
+    std::array<ArrayView<const double>, NDIM> alpha;
+    std::array<int, NDIM> U_stride, alpha_stride;
+    std::array<double, NDIM> h_sq;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        alpha[d] = ArrayView<const double>(alpha_data.getArrayData(d), depth);
+        U_stride[d] = U.stride(d);
+        alpha_stride[d] = alpha[d].stride(d);
+        h_sq[d] = dx[d] * dx[d];
+    }
+
+    sweep_tiles(box, red_or_black, [&](const hier::Index<NDIM>& i, const int n_cells, const int step) {
+        double* const u = U(i);
+        const double* const f = F(i);
+        std::array<const double*, NDIM> alpha_lower;
+        for (unsigned int d = 0; d < NDIM; ++d) alpha_lower[d] = alpha[d](i);
+        for (int k = 0; k < n_cells * step; k += step)
+        {
+            double fac_sum = 0.0, U_nbrs = 0.0;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                const double facu = alpha_lower[d][k + alpha_stride[d]] / h_sq[d];
+                const double facl = alpha_lower[d][k] / h_sq[d];
+                fac_sum += facu;
+                fac_sum += facl;
+                U_nbrs += facu * u[k + U_stride[d]];
+                U_nbrs += facl * u[k - U_stride[d]];
+            }
+            u[k] = (1.0 / (fac_sum - beta)) * (U_nbrs - f[k]);
+        }
+    });
+    return;
+} // vc_cell_smooth
+
+// Offsets of the viscosity values that are averaged to obtain the viscosity at
+// a cell center, relative to a given index.  Entry n refers to the viscosity
+// data with index array[n].
+struct MuCellStencil
+{
+    std::array<int, NUM_MU_CELL_NBRS> array;
+    std::array<int, NUM_MU_CELL_NBRS> offset;
+};
+
+// Smooth F = alpha div mu (grad U + grad U^T) + beta C U for side-centered U,
+// F, and C.  The mask and C are only read if they are non-null.
+void
+vc_side_smooth(SideData<NDIM, double>& U_data,
+               const SideData<NDIM, double>& F_data,
+               const SideData<NDIM, int>* const mask_data,
+               const SideData<NDIM, double>* const C_data,
+               const ViscosityPatchData& mu_data,
+               const int depth,
+               const double alpha,
+               const double beta,
+               const Box<NDIM>& box,
+               const double* const dx,
+               const bool use_harmonic_interp,
+               const int red_or_black)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(U_data.getGhostCellWidth().min() >= 1);
+    TBOX_ASSERT(mu_data.getGhostCellWidth().min() >= 1);
+    TBOX_ASSERT(U_data.getBox() == box);
+#endif
+    std::array<ArrayView<double>, NDIM> U;
+    std::array<ArrayView<const double>, NDIM> F, C;
+    std::array<ArrayView<const int>, NDIM> mask;
+    std::array<double, NDIM> fac_axis;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        U[d] = ArrayView<double>(U_data.getArrayData(d), depth);
+        F[d] = ArrayView<const double>(F_data.getArrayData(d), depth);
+        if (C_data) C[d] = ArrayView<const double>(C_data->getArrayData(d), depth);
+        if (mask_data) mask[d] = ArrayView<const int>(mask_data->getArrayData(d), depth);
+        fac_axis[d] = 1.0 / dx[d];
+    }
+
+    // In two spatial dimensions, mu is node-centered.  In three spatial
+    // dimensions, mu[k] is the viscosity on the edges aligned with axis k.
+#if (NDIM == 2)
+    static const int NUM_MU_ARRAYS = 1;
+    const std::array<ArrayView<const double>, NUM_MU_ARRAYS> mu = { ArrayView<const double>(mu_data.getArrayData(),
+                                                                                            depth) };
+#endif
+#if (NDIM == 3)
+    static const int NUM_MU_ARRAYS = NDIM;
+    std::array<ArrayView<const double>, NUM_MU_ARRAYS> mu;
+    for (unsigned int k = 0; k < NDIM; ++k) mu[k] = ArrayView<const double>(mu_data.getArrayData(k), depth);
+#endif
+
+    // The components are updated one after another.  The neighboring
+    // components are visited in the same order as in the reference Fortran
+    // implementation, so that the results agree to round-off.
+#if (NDIM == 2)
+    static const int other_axes_dnr[NDIM][NDIM - 1] = { { 1 }, { 0 } };
+    static const int other_axes_nmr[NDIM][NDIM - 1] = { { 1 }, { 0 } };
+#endif
+#if (NDIM == 3)
+    static const int other_axes_dnr[NDIM][NDIM - 1] = { { 1, 2 }, { 0, 2 }, { 0, 1 } };
+    static const int other_axes_nmr[NDIM][NDIM - 1] = { { 1, 2 }, { 0, 2 }, { 1, 0 } };
+#endif
+    for (unsigned int a = 0; a < NDIM; ++a)
+    {
+        // Index of the viscosity data that couples component a with component
+        // b.
+        auto mu_array = [a](const unsigned int b) { return NDIM == 2 ? 0 : static_cast<int>(NDIM - a - b); };
+
+        // The viscosity at the upper cell center is averaged from the values
+        // on the cell (i), and the viscosity at the lower cell center is
+        // averaged from the values on the cell (i - e_a).
+        MuCellStencil mu_upper_stencil, mu_lower_stencil;
+#if (NDIM == 2)
+        const int mu_s0 = mu[0].stride(0), mu_s1 = mu[0].stride(1);
+        mu_upper_stencil.array.fill(0);
+        mu_lower_stencil.array.fill(0);
+        mu_upper_stencil.offset = { 0, mu_s0, mu_s1, mu_s0 + mu_s1 };
+        if (a == 0)
+        {
+            mu_lower_stencil.offset = { 0, -mu_s0, mu_s1, -mu_s0 + mu_s1 };
+        }
+        else
+        {
+            mu_lower_stencil.offset = { 0, mu_s0, -mu_s1, mu_s0 - mu_s1 };
+        }
+#endif
+#if (NDIM == 3)
+        int n = 0;
+        for (unsigned int k = 0; k < NDIM; ++k)
+        {
+            const int s_j1 = mu[k].stride(k == 0 ? 1 : 0);
+            const int s_j2 = mu[k].stride(k == 2 ? 1 : 2);
+            const int s_a = mu[k].stride(a);
+            for (const int offset : { 0, s_j1, s_j2, s_j1 + s_j2 })
+            {
+                mu_upper_stencil.array[n] = k;
+                mu_upper_stencil.offset[n] = offset;
+                mu_lower_stencil.array[n] = k;
+                mu_lower_stencil.offset[n] = offset - s_a;
+                ++n;
+            }
+        }
+#endif
+        auto mu_cell = [use_harmonic_interp](const std::array<const double*, NUM_MU_ARRAYS>& mu_i,
+                                             const MuCellStencil& stencil,
+                                             const int k) {
+            double sum = 0.0;
+            if (use_harmonic_interp)
+            {
+                for (int n = 0; n < NUM_MU_CELL_NBRS; ++n) sum += 1.0 / mu_i[stencil.array[n]][k + stencil.offset[n]];
+                return static_cast<double>(NUM_MU_CELL_NBRS) / sum;
+            }
+            for (int n = 0; n < NUM_MU_CELL_NBRS; ++n) sum += mu_i[stencil.array[n]][k + stencil.offset[n]];
+            return (1.0 / static_cast<double>(NUM_MU_CELL_NBRS)) * sum;
+        };
+
+        const double fac = 2.0 * fac_axis[a] * fac_axis[a];
+        const int u_a_s_a = U[a].stride(a);
+        sweep_tiles(SideGeometry<NDIM>::toSideBox(box, a),
+                    red_or_black,
+                    [&](const hier::Index<NDIM>& i, const int n_cells, const int step) {
+                        double* const u_a = U[a](i);
+                        const double* const f_a = F[a](i);
+                        const double* const c_a = C_data ? C[a](i) : nullptr;
+                        const int* const mask_a = mask_data ? mask[a](i) : nullptr;
+                        std::array<const double*, NDIM> u;
+                        for (unsigned int d = 0; d < NDIM; ++d) u[d] = U[d](i);
+                        std::array<const double*, NUM_MU_ARRAYS> mu_i;
+                        for (int k = 0; k < NUM_MU_ARRAYS; ++k) mu_i[k] = mu[k](i);
+                        for (int k = 0; k < n_cells * step; k += step)
+                        {
+                            if (mask_a && mask_a[k] != 0) continue;
+                            const double c = c_a ? c_a[k] * beta : beta;
+                            const double mu_upper = mu_cell(mu_i, mu_upper_stencil, k);
+                            const double mu_lower = mu_cell(mu_i, mu_lower_stencil, k);
+
+                            double dnr = fac * (mu_upper + mu_lower);
+                            for (const int b : other_axes_dnr[a])
+                            {
+                                const double* const mu_b = mu_i[mu_array(b)];
+                                const int mu_s_b = mu[mu_array(b)].stride(b);
+                                dnr += fac_axis[b] * fac_axis[b] * (mu_b[k + mu_s_b] + mu_b[k]);
+                            }
+                            dnr = alpha * dnr - c;
+
+                            double nmr = fac * (mu_upper * u_a[k + u_a_s_a] + mu_lower * u_a[k - u_a_s_a]);
+                            for (const int b : other_axes_nmr[a])
+                            {
+                                const double* const mu_b = mu_i[mu_array(b)];
+                                const int mu_s_b = mu[mu_array(b)].stride(b);
+                                const int u_a_s_b = U[a].stride(b);
+                                const int u_b_s_a = U[b].stride(a), u_b_s_b = U[b].stride(b);
+                                const double* const u_b = u[b];
+                                nmr += fac_axis[b] * fac_axis[b] *
+                                       (mu_b[k + mu_s_b] * u_a[k + u_a_s_b] + mu_b[k] * u_a[k - u_a_s_b]);
+                                nmr += fac_axis[a] * fac_axis[b] *
+                                       (mu_b[k + mu_s_b] * (u_b[k + u_b_s_b] - u_b[k + u_b_s_b - u_b_s_a]) -
+                                        mu_b[k] * (u_b[k] - u_b[k - u_b_s_a]));
+                            }
+                            nmr = -f_a[k] + alpha * nmr;
+
+                            u_a[k] = nmr / dnr;
+                        }
+                    });
+    }
+    return;
+} // vc_side_smooth
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+gs_smooth(ArrayData<NDIM, double>& U,
+          const ArrayData<NDIM, double>& F,
+          const int depth,
+          const Box<NDIM>& box,
+          const double alpha,
+          const double beta,
+          const double* const dx,
+          const ArrayData<NDIM, int>* const mask)
+{
+    if (mask)
+    {
+        cc_smooth<true>(U, F, mask, depth, box, alpha, beta, dx, ALL_CELLS);
+    }
+    else
+    {
+        cc_smooth<false>(U, F, mask, depth, box, alpha, beta, dx, ALL_CELLS);
+    }
+    return;
+} // gs_smooth
+
+void
+rb_gs_smooth(ArrayData<NDIM, double>& U,
+             const ArrayData<NDIM, double>& F,
+             const int depth,
+             const Box<NDIM>& box,
+             const double alpha,
+             const double beta,
+             const double* const dx,
+             const int red_or_black,
+             const ArrayData<NDIM, int>* const mask)
+{
+    if (mask)
+    {
+        cc_smooth<true>(U, F, mask, depth, box, alpha, beta, dx, red_or_black % 2);
+    }
+    else
+    {
+        cc_smooth<false>(U, F, mask, depth, box, alpha, beta, dx, red_or_black % 2);
+    }
+    return;
+} // rb_gs_smooth
+
+void
+vc_cell_gs_smooth(ArrayData<NDIM, double>& U,
+                  const SideData<NDIM, double>& alpha,
+                  const double beta,
+                  const ArrayData<NDIM, double>& F,
+                  const int depth,
+                  const Box<NDIM>& box,
+                  const double* const dx)
+{
+    vc_cell_smooth(U, alpha, beta, F, depth, box, dx, ALL_CELLS);
+    return;
+} // vc_cell_gs_smooth
+
+void
+vc_cell_rb_gs_smooth(ArrayData<NDIM, double>& U,
+                     const SideData<NDIM, double>& alpha,
+                     const double beta,
+                     const ArrayData<NDIM, double>& F,
+                     const int depth,
+                     const Box<NDIM>& box,
+                     const double* const dx,
+                     const int red_or_black)
+{
+    vc_cell_smooth(U, alpha, beta, F, depth, box, dx, red_or_black % 2);
+    return;
+} // vc_cell_rb_gs_smooth
+
+void
+vc_side_gs_smooth(SideData<NDIM, double>& U,
+                  const SideData<NDIM, double>& F,
+                  const SideData<NDIM, int>* const mask,
+                  const SideData<NDIM, double>* const C,
+                  const ViscosityPatchData& mu,
+                  const int depth,
+                  const double alpha,
+                  const double beta,
+                  const Box<NDIM>& box,
+                  const double* const dx,
+                  const bool use_harmonic_interp)
+{
+    vc_side_smooth(U, F, mask, C, mu, depth, alpha, beta, box, dx, use_harmonic_interp, ALL_CELLS);
+    return;
+} // vc_side_gs_smooth
+
+void
+vc_side_rb_gs_smooth(SideData<NDIM, double>& U,
+                     const SideData<NDIM, double>& F,
+                     const SideData<NDIM, int>* const mask,
+                     const SideData<NDIM, double>* const C,
+                     const ViscosityPatchData& mu,
+                     const int depth,
+                     const double alpha,
+                     const double beta,
+                     const Box<NDIM>& box,
+                     const double* const dx,
+                     const bool use_harmonic_interp,
+                     const int red_or_black)
+{
+    vc_side_smooth(U, F, mask, C, mu, depth, alpha, beta, box, dx, use_harmonic_interp, red_or_black % 2);
+    return;
+} // vc_side_rb_gs_smooth
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
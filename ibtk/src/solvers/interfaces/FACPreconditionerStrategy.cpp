@@ -120,6 +120,12 @@ FACPreconditionerStrategy::deallocateOperatorState()
     return;
 } // deallocateOperatorState
 
+bool
+FACPreconditionerStrategy::updateProblemCoefficients()
+{
+    return false;
+} // updateProblemCoefficients
+
 void
 FACPreconditionerStrategy::allocateScratchData()
 {
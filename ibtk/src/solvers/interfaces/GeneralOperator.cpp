@@ -147,6 +147,12 @@ GeneralOperator::deallocateOperatorState()
     return;
 } // deallocateOperatorState
 
+bool
+GeneralOperator::updateProblemCoefficients()
+{
+    return false;
+} // updateProblemCoefficients
+
 void
 GeneralOperator::modifyRhsForBcs(SAMRAIVectorReal<NDIM, double>& /*y*/)
 {
@@ -127,6 +127,12 @@ GeneralSolver::deallocateSolverState()
     return;
 } // deallocateSolverState
 
+bool
+GeneralSolver::updateProblemCoefficients()
+{
+    return false;
+} // updateProblemCoefficients
+
 void
 GeneralSolver::setMaxIterations(int max_iterations)
 {
@@ -64,6 +64,15 @@ KrylovLinearSolver::setTimeInterval(const double current_time, const double new_
     return;
 } // setTimeInterval
 
+bool
+KrylovLinearSolver::updateProblemCoefficients()
+{
+    if (!d_is_initialized) return false;
+    if (d_A && !d_A->updateProblemCoefficients()) return false;
+    if (d_pc_solver && !d_pc_solver->updateProblemCoefficients()) return false;
+    return true;
+} // updateProblemCoefficients
+
 void
 KrylovLinearSolver::setOperator(Pointer<LinearOperator> A)
 {
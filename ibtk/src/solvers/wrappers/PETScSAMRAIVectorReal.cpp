@@ -19,9 +19,22 @@
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
+#include "ArrayData.h"
+#include "Box.h"
+#include "CellData.h"
+#include "CellDataFactory.h"
 #include "IntVector.h"
+#include "Patch.h"
+#include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "SAMRAIVectorReal.h"
+#include "SideData.h"
+#include "SideDataFactory.h"
+#include "SideGeometry.h"
+#include "VariableDatabase.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/Pointer.h"
 #include "tbox/Timer.h"
@@ -35,6 +48,8 @@
 #include <cmath>
 #include <ostream>
 #include <string>
+#include <utility>
+#include <vector>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -102,6 +117,222 @@ static Timer* t_vec_dot_norm2;
 #define PSVR_CHECK3(v1, v2, v3)
 #define PSVR_CHECKN(v, N)
 #endif
+
+// Determine whether or not the fused multi-vector kernels below may be used
+// with the given vectors, i.e., whether all of the vectors have the same
+// levels and cell- or side-centered components with matching depths and
+// ghost cell widths.
+bool
+fused_kernels_supported(const SAMRAIVectorReal<NDIM, PetscScalar>& x,
+                        const std::vector<const SAMRAIVectorReal<NDIM, PetscScalar>*>& y)
+{
+    const auto nv = static_cast<PetscInt>(y.size());
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<PatchDescriptor<NDIM> > patch_descriptor = var_db->getPatchDescriptor();
+    const int n_comps = x.getNumberOfComponents();
+    for (PetscInt i = 0; i < nv; ++i)
+    {
+        const SAMRAIVectorReal<NDIM, PetscScalar>& y_vec = *y[i];
+        if (y_vec.getPatchHierarchy() != x.getPatchHierarchy() ||
+            y_vec.getCoarsestLevelNumber() != x.getCoarsestLevelNumber() ||
+            y_vec.getFinestLevelNumber() != x.getFinestLevelNumber() || y_vec.getNumberOfComponents() != n_comps)
+        {
+            return false;
+        }
+    }
+    for (int comp = 0; comp < n_comps; ++comp)
+    {
+        Pointer<PatchDataFactory<NDIM> > x_factory =
+            patch_descriptor->getPatchDataFactory(x.getComponentDescriptorIndex(comp));
+        Pointer<CellDataFactory<NDIM, PetscScalar> > x_cc_factory = x_factory;
+        Pointer<SideDataFactory<NDIM, PetscScalar> > x_sc_factory = x_factory;
+        if (x_sc_factory && x_sc_factory->getDirectionVector() != IntVector<NDIM>(1)) return false;
+        if (!x_cc_factory && !x_sc_factory) return false;
+        const int depth = x_cc_factory ? x_cc_factory->getDefaultDepth() : x_sc_factory->getDefaultDepth();
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            Pointer<PatchDataFactory<NDIM> > y_factory =
+                patch_descriptor->getPatchDataFactory(y[i]->getComponentDescriptorIndex(comp));
+            if (y_factory->getGhostCellWidth() != x_factory->getGhostCellWidth()) return false;
+            Pointer<CellDataFactory<NDIM, PetscScalar> > y_cc_factory = y_factory;
+            Pointer<SideDataFactory<NDIM, PetscScalar> > y_sc_factory = y_factory;
+            if (x_cc_factory && (!y_cc_factory || y_cc_factory->getDefaultDepth() != depth)) return false;
+            if (x_sc_factory && (!y_sc_factory || y_sc_factory->getDefaultDepth() != depth ||
+                                 y_sc_factory->getDirectionVector() != IntVector<NDIM>(1)))
+                return false;
+        }
+    }
+    return true;
+}
+
+// Get the array data objects stored by a cell- or side-centered patch data
+// object along with the boxes of indices that correspond to the patch
+// interior.
+void
+get_array_data(const Pointer<PatchData<NDIM> >& data,
+               const Box<NDIM>& patch_box,
+               std::vector<std::pair<ArrayData<NDIM, PetscScalar>*, Box<NDIM> > >& arrays)
+{
+    arrays.clear();
+    Pointer<CellData<NDIM, PetscScalar> > cc_data = data;
+    Pointer<SideData<NDIM, PetscScalar> > sc_data = data;
+    if (cc_data)
+    {
+        arrays.emplace_back(&cc_data->getArrayData(), patch_box);
+    }
+    else
+    {
+        TBOX_ASSERT(sc_data);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            arrays.emplace_back(&sc_data->getArrayData(axis), SideGeometry<NDIM>::toSideBox(patch_box, axis));
+        }
+    }
+}
+
+// Compute the local parts of the (control volume weighted) dot products of x
+// with each of the vectors y[0], ..., y[nv - 1] over patch interiors. Each
+// contiguous row of x (and the control volume) is loaded once and then
+// reused, from cache, for every y[i].
+void
+fused_mdot_local(const SAMRAIVectorReal<NDIM, PetscScalar>& x,
+                 const std::vector<const SAMRAIVectorReal<NDIM, PetscScalar>*>& y,
+                 PetscScalar* val)
+{
+    const auto nv = static_cast<PetscInt>(y.size());
+    std::fill(val, val + nv, 0.0);
+    Pointer<PatchHierarchy<NDIM> > hierarchy = x.getPatchHierarchy();
+    std::vector<std::pair<ArrayData<NDIM, PetscScalar>*, Box<NDIM> > > x_arrays, cvol_arrays, y_arrays;
+    std::vector<std::vector<ArrayData<NDIM, PetscScalar>*> > y_array_data;
+    std::vector<const PetscScalar*> y_ptrs(nv);
+    std::vector<PetscScalar> x_row;
+    for (int ln = x.getCoarsestLevelNumber(); ln <= x.getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            for (int comp = 0; comp < x.getNumberOfComponents(); ++comp)
+            {
+                get_array_data(patch->getPatchData(x.getComponentDescriptorIndex(comp)), patch_box, x_arrays);
+                const int cvol_idx = x.getControlVolumeIndex(comp);
+                const bool use_cvol = cvol_idx >= 0;
+                if (use_cvol) get_array_data(patch->getPatchData(cvol_idx), patch_box, cvol_arrays);
+                y_array_data.resize(nv);
+                for (PetscInt i = 0; i < nv; ++i)
+                {
+                    get_array_data(patch->getPatchData(y[i]->getComponentDescriptorIndex(comp)), patch_box, y_arrays);
+                    y_array_data[i].clear();
+                    for (const auto& y_array : y_arrays) y_array_data[i].push_back(y_array.first);
+                }
+
+                for (unsigned int a = 0; a < x_arrays.size(); ++a)
+                {
+                    const ArrayData<NDIM, PetscScalar>& x_array = *x_arrays[a].first;
+                    const Box<NDIM>& data_box = x_array.getBox();
+                    const Box<NDIM> box = x_arrays[a].second * data_box;
+                    if (box.empty()) continue;
+                    const int row_length = box.numberCells(0);
+                    x_row.resize(row_length);
+                    Box<NDIM> row_start_box = box;
+                    row_start_box.upper(0) = row_start_box.lower(0);
+                    for (int d = 0; d < x_array.getDepth(); ++d)
+                    {
+                        const PetscScalar* const x_ptr = x_array.getPointer(d);
+                        const PetscScalar* cvol_ptr = nullptr;
+                        const Box<NDIM>* cvol_box = nullptr;
+                        if (use_cvol)
+                        {
+                            const ArrayData<NDIM, PetscScalar>& cvol_array = *cvol_arrays[a].first;
+                            cvol_ptr = cvol_array.getPointer(cvol_array.getDepth() == 1 ? 0 : d);
+                            cvol_box = &cvol_array.getBox();
+                        }
+                        for (PetscInt i = 0; i < nv; ++i) y_ptrs[i] = y_array_data[i][a]->getPointer(d);
+
+                        for (Box<NDIM>::Iterator b(row_start_box); b; b++)
+                        {
+                            const int offset = data_box.offset(b());
+                            const PetscScalar* const x_row_ptr = x_ptr + offset;
+                            if (use_cvol)
+                            {
+                                const PetscScalar* const cvol_row_ptr = cvol_ptr + cvol_box->offset(b());
+                                for (int k = 0; k < row_length; ++k) x_row[k] = x_row_ptr[k] * cvol_row_ptr[k];
+                            }
+                            else
+                            {
+                                std::copy(x_row_ptr, x_row_ptr + row_length, x_row.begin());
+                            }
+                            for (PetscInt i = 0; i < nv; ++i)
+                            {
+                                const PetscScalar* const y_row_ptr = y_ptrs[i] + offset;
+                                PetscScalar sum = 0.0;
+                                for (int k = 0; k < row_length; ++k) sum += x_row[k] * y_row_ptr[k];
+                                val[i] += sum;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Compute y += alpha[0]*x[0] + ... + alpha[nv - 1]*x[nv - 1] on all indices
+// (including ghost cells). The update is done in blocks small enough that
+// each block of y stays in cache while all nv updates are applied to it.
+void
+fused_maxpy(SAMRAIVectorReal<NDIM, PetscScalar>& y,
+            const PetscScalar* alpha,
+            const std::vector<const SAMRAIVectorReal<NDIM, PetscScalar>*>& x)
+{
+    const auto nv = static_cast<PetscInt>(x.size());
+    static const int block_size = 512;
+    Pointer<PatchHierarchy<NDIM> > hierarchy = y.getPatchHierarchy();
+    std::vector<std::pair<ArrayData<NDIM, PetscScalar>*, Box<NDIM> > > y_arrays, x_arrays;
+    std::vector<std::vector<const PetscScalar*> > x_ptrs;
+    for (int ln = y.getCoarsestLevelNumber(); ln <= y.getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            for (int comp = 0; comp < y.getNumberOfComponents(); ++comp)
+            {
+                get_array_data(patch->getPatchData(y.getComponentDescriptorIndex(comp)), patch_box, y_arrays);
+                x_ptrs.resize(y_arrays.size());
+                for (auto& ptrs : x_ptrs) ptrs.resize(nv);
+                for (PetscInt i = 0; i < nv; ++i)
+                {
+                    get_array_data(patch->getPatchData(x[i]->getComponentDescriptorIndex(comp)), patch_box, x_arrays);
+                    for (unsigned int a = 0; a < x_arrays.size(); ++a)
+                    {
+                        TBOX_ASSERT(x_arrays[a].first->getBox() == y_arrays[a].first->getBox());
+                        x_ptrs[a][i] = x_arrays[a].first->getPointer();
+                    }
+                }
+
+                for (unsigned int a = 0; a < y_arrays.size(); ++a)
+                {
+                    ArrayData<NDIM, PetscScalar>& y_array = *y_arrays[a].first;
+                    PetscScalar* const y_ptr = y_array.getPointer();
+                    const int n_values = y_array.getBox().size() * y_array.getDepth();
+                    for (int block_begin = 0; block_begin < n_values; block_begin += block_size)
+                    {
+                        const int block_end = std::min(block_begin + block_size, n_values);
+                        for (PetscInt i = 0; i < nv; ++i)
+                        {
+                            const PetscScalar a_i = alpha[i];
+                            const PetscScalar* const x_ptr = x_ptrs[a][i];
+                            for (int k = block_begin; k < block_end; ++k) y_ptr[k] += a_i * x_ptr[k];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -305,10 +536,19 @@ PETScSAMRAIVectorReal::VecMDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscSca
     IBTK_TIMER_START(t_vec_m_dot);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
+    std::vector<const SAMRAIVectorReal<NDIM, PetscScalar>*> y_vecs(nv);
+    for (PetscInt i = 0; i < nv; ++i) y_vecs[i] = PSVR_CAST2(y[i]).getPointer();
+    if (fused_kernels_supported(*PSVR_CAST2(x), y_vecs))
+    {
+        fused_mdot_local(*PSVR_CAST2(x), y_vecs, val);
+    }
+    else
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
     }
     SAMRAI_MPI::sumReduction(val, nv);
     IBTK_TIMER_STOP(t_vec_m_dot);
@@ -366,10 +606,19 @@ PETScSAMRAIVectorReal::VecMTDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscSc
     IBTK_TIMER_START(t_vec_m_t_dot);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
+    std::vector<const SAMRAIVectorReal<NDIM, PetscScalar>*> y_vecs(nv);
+    for (PetscInt i = 0; i < nv; ++i) y_vecs[i] = PSVR_CAST2(y[i]).getPointer();
+    if (fused_kernels_supported(*PSVR_CAST2(x), y_vecs))
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        fused_mdot_local(*PSVR_CAST2(x), y_vecs, val);
+    }
+    else
+    {
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
     }
     SAMRAI_MPI::sumReduction(val, nv);
     IBTK_TIMER_STOP(t_vec_m_t_dot);
@@ -488,6 +737,16 @@ PETScSAMRAIVectorReal::VecMAXPY_SAMRAI(Vec y, PetscInt nv, const PetscScalar* al
     IBTK_TIMER_START(t_vec_maxpy);
     PSVR_CHECK1(y);
     PSVR_CHECKN(x, nv);
+    std::vector<const SAMRAIVectorReal<NDIM, PetscScalar>*> x_vecs(nv);
+    for (PetscInt i = 0; i < nv; ++i) x_vecs[i] = PSVR_CAST2(x[i]).getPointer();
+    if (fused_kernels_supported(*PSVR_CAST2(y), x_vecs))
+    {
+        fused_maxpy(*PSVR_CAST2(y), alpha, x_vecs);
+        int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
+        CHKERRQ(ierr);
+        IBTK_TIMER_STOP(t_vec_maxpy);
+        PetscFunctionReturn(0);
+    }
     static const bool interior_only = false;
     for (PetscInt i = 0; i < nv; ++i)
     {
@@ -716,10 +975,19 @@ PETScSAMRAIVectorReal::VecMDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, Pe
     IBTK_TIMER_START(t_vec_m_dot_local);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
+    std::vector<const SAMRAIVectorReal<NDIM, PetscScalar>*> y_vecs(nv);
+    for (PetscInt i = 0; i < nv; ++i) y_vecs[i] = PSVR_CAST2(y[i]).getPointer();
+    if (fused_kernels_supported(*PSVR_CAST2(x), y_vecs))
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        fused_mdot_local(*PSVR_CAST2(x), y_vecs, val);
+    }
+    else
+    {
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
     }
     IBTK_TIMER_STOP(t_vec_m_dot_local);
     PetscFunctionReturn(0);
@@ -731,10 +999,19 @@ PETScSAMRAIVectorReal::VecMTDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, P
     IBTK_TIMER_START(t_vec_m_t_dot_local);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
+    std::vector<const SAMRAIVectorReal<NDIM, PetscScalar>*> y_vecs(nv);
+    for (PetscInt i = 0; i < nv; ++i) y_vecs[i] = PSVR_CAST2(y[i]).getPointer();
+    if (fused_kernels_supported(*PSVR_CAST2(x), y_vecs))
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        fused_mdot_local(*PSVR_CAST2(x), y_vecs, val);
+    }
+    else
+    {
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
     }
     IBTK_TIMER_STOP(t_vec_m_t_dot_local);
     PetscFunctionReturn(0);
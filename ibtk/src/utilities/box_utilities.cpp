@@ -20,6 +20,10 @@
 #include "tbox/Utilities.h"
 
 #include <Box.h>
+#include <BoxArray.h>
+#include <Patch.h>
+#include <PatchLevel.h>
+#include <ProcessorMapping.h>
 
 #include <algorithm>
 #include <iterator>
@@ -253,6 +257,34 @@ merge_boxes_by_longest_edge(const std::vector<SAMRAI::hier::Box<NDIM> >& input_b
 
     return result;
 }
+
+void
+get_level_layout(const tbox::Pointer<hier::PatchLevel<NDIM> >& level,
+                 std::vector<hier::Box<NDIM> >& boxes,
+                 std::vector<int>& mapping)
+{
+    const hier::BoxArray<NDIM>& level_boxes = level->getBoxes();
+    const hier::ProcessorMapping& processor_mapping = level->getProcessorMapping();
+    const int num_boxes = level_boxes.getNumberOfBoxes();
+    boxes.resize(num_boxes);
+    mapping.resize(num_boxes);
+    for (int i = 0; i < num_boxes; ++i)
+    {
+        boxes[i] = level_boxes[i];
+        mapping[i] = processor_mapping.getProcessorAssignment(i);
+    }
+}
+
+std::vector<tbox::Pointer<hier::Patch<NDIM> > >
+get_local_patches(const tbox::Pointer<hier::PatchLevel<NDIM> >& level)
+{
+    std::vector<tbox::Pointer<hier::Patch<NDIM> > > patches;
+    for (hier::PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        patches.push_back(level->getPatch(p()));
+    }
+    return patches;
+}
 } // namespace IBTK
 
 #endif
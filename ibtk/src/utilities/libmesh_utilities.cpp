@@ -29,6 +29,8 @@
 #include "libmesh/dof_map.h"
 #include "libmesh/elem.h"
 #include "libmesh/enum_elem_type.h"
+#include "libmesh/enum_xdr_mode.h"
+#include "libmesh/equation_systems.h"
 #include "libmesh/enum_order.h"
 #include "libmesh/enum_quadrature_type.h"
 #include "libmesh/fem_context.h"
@@ -46,6 +48,8 @@
 #include "libmesh/variant_filter_iterator.h"
 
 #include <petscsys.h>
+#include <petscvec.h>
+#include <petscviewer.h>
 
 IBTK_DISABLE_EXTRA_WARNINGS
 #include <boost/multi_array.hpp>
@@ -239,6 +243,274 @@ write_node_partitioning(const std::string& file_name, const libMesh::System& pos
     }
 }
 
+libMesh::XdrMODE
+get_xdr_mode(const std::string& extension, const bool write)
+{
+    if (extension == "xdr")
+    {
+        return write ? libMesh::ENCODE : libMesh::DECODE;
+    }
+    if (extension == "xda" || extension == "xda.gz" || extension == "xda.bz2" || extension == "xda.xz")
+    {
+        return write ? libMesh::WRITE : libMesh::READ;
+    }
+    if (extension.compare(0, 4, "xdr.") == 0)
+    {
+        TBOX_ERROR("IBTK::get_xdr_mode():\n"
+                   << "  libMesh does not compress binary (xdr) files: the extension " << extension
+                   << " is not supported.\n"
+                   << "  Use xdr, or use xda followed by .gz, .bz2, or .xz for compressed ASCII files.\n");
+    }
+    TBOX_ERROR("IBTK::get_xdr_mode():\n"
+               << "  unknown libMesh file extension " << extension << ".\n"
+               << "  Valid extensions are xdr, xda, xda.gz, xda.bz2, and xda.xz.\n");
+    return libMesh::INVALID_XDR_MODE;
+}
+
+namespace
+{
+/*!
+ * Number the degrees of freedom of @p system in an order that does not depend
+ * on the partitioning of the mesh: first the degrees of freedom of all nodes,
+ * ordered by node id, then those of all active elements, ordered by element
+ * id. On output, @p local_dofs contains the locally owned degrees of freedom
+ * of the system and @p canonical_dofs their indices in that order.
+ */
+void
+get_canonical_dof_indices(const libMesh::System& system,
+                          std::vector<PetscInt>& local_dofs,
+                          std::vector<PetscInt>& canonical_dofs)
+{
+    const libMesh::MeshBase& mesh = system.get_mesh();
+    const libMesh::DofMap& dof_map = system.get_dof_map();
+    if (!mesh.is_serial())
+    {
+        TBOX_ERROR("IBTK::write_equation_systems_data():\n"
+                   << "  the mesh of system " << system.name() << " is not replicated.\n");
+    }
+    if (dof_map.n_SCALAR_dofs() != 0)
+    {
+        TBOX_ERROR("IBTK::write_equation_systems_data():\n"
+                   << "  system " << system.name() << " contains SCALAR variables, which are not supported.\n");
+    }
+
+    const unsigned int sys_num = system.number();
+    const libMesh::dof_id_type first_dof = dof_map.first_dof();
+    const libMesh::dof_id_type end_dof = dof_map.end_dof();
+    local_dofs.clear();
+    canonical_dofs.clear();
+    local_dofs.reserve(end_dof - first_dof);
+    canonical_dofs.reserve(end_dof - first_dof);
+
+    // Both loops go over the entire mesh since the offset of each node and
+    // element in the canonical ordering depends on all preceding objects.
+    // Replicated meshes iterate over nodes and elements in order of their ids.
+    PetscInt canonical_dof = 0;
+    const auto number_dofs = [&](const libMesh::DofObject& dof_object) {
+        for (unsigned int var = 0; var < dof_object.n_vars(sys_num); ++var)
+        {
+            for (unsigned int comp = 0; comp < dof_object.n_comp(sys_num, var); ++comp)
+            {
+                const libMesh::dof_id_type dof = dof_object.dof_number(sys_num, var, comp);
+                if (dof == libMesh::DofObject::invalid_id) continue;
+                if (first_dof <= dof && dof < end_dof)
+                {
+                    local_dofs.push_back(static_cast<PetscInt>(dof));
+                    canonical_dofs.push_back(canonical_dof);
+                }
+                ++canonical_dof;
+            }
+        }
+    };
+    const auto end_node = mesh.nodes_end();
+    for (auto node_it = mesh.nodes_begin(); node_it != end_node; ++node_it) number_dofs(**node_it);
+    const auto end_elem = mesh.active_elements_end();
+    for (auto elem_it = mesh.active_elements_begin(); elem_it != end_elem; ++elem_it) number_dofs(**elem_it);
+    TBOX_ASSERT(static_cast<libMesh::dof_id_type>(canonical_dof) == dof_map.n_dofs());
+    TBOX_ASSERT(local_dofs.size() == end_dof - first_dof);
+}
+
+/*!
+ * Collect the solution and the additional vectors of @p system (in the order
+ * in which libMesh stores them, i.e., sorted by name) as PETSc vectors.
+ */
+std::vector<libMesh::PetscVector<double>*>
+get_system_vectors(libMesh::System& system)
+{
+    std::vector<libMesh::NumericVector<double>*> vecs = { system.solution.get() };
+    for (auto it = system.vectors_begin(); it != system.vectors_end(); ++it) vecs.push_back(it->second);
+
+    std::vector<libMesh::PetscVector<double>*> petsc_vecs;
+    for (libMesh::NumericVector<double>* vec : vecs)
+    {
+        auto petsc_vec = dynamic_cast<libMesh::PetscVector<double>*>(vec);
+        if (!petsc_vec || petsc_vec->type() == libMesh::SERIAL)
+        {
+            TBOX_ERROR("IBTK::write_equation_systems_data():\n"
+                       << "  all vectors of system " << system.name()
+                       << " must be parallel or ghosted PETSc vectors.\n");
+        }
+        petsc_vecs.push_back(petsc_vec);
+    }
+    return petsc_vecs;
+}
+
+/*!
+ * Set up a scatter from the libMesh numbering of the degrees of freedom of
+ * @p system, stored in the layout of @p vec, to the canonical numbering
+ * stored in @p canonical_vec.
+ */
+VecScatter
+create_canonical_scatter(const libMesh::System& system, Vec vec, Vec canonical_vec)
+{
+    std::vector<PetscInt> local_dofs, canonical_dofs;
+    get_canonical_dof_indices(system, local_dofs, canonical_dofs);
+
+    const MPI_Comm comm = system.comm().get();
+    int ierr;
+    IS local_is, canonical_is;
+    ierr = ISCreateGeneral(
+        comm, static_cast<PetscInt>(local_dofs.size()), local_dofs.data(), PETSC_COPY_VALUES, &local_is);
+    IBTK_CHKERRQ(ierr);
+    ierr = ISCreateGeneral(
+        comm, static_cast<PetscInt>(canonical_dofs.size()), canonical_dofs.data(), PETSC_COPY_VALUES, &canonical_is);
+    IBTK_CHKERRQ(ierr);
+    VecScatter scatter;
+    ierr = VecScatterCreate(vec, local_is, canonical_vec, canonical_is, &scatter);
+    IBTK_CHKERRQ(ierr);
+    ierr = ISDestroy(&local_is);
+    IBTK_CHKERRQ(ierr);
+    ierr = ISDestroy(&canonical_is);
+    IBTK_CHKERRQ(ierr);
+    return scatter;
+}
+
+/*!
+ * Open a PETSc binary viewer on @p file_name that uses MPI-IO, when
+ * available, to access the file collectively.
+ */
+PetscViewer
+open_binary_viewer(const MPI_Comm comm, const std::string& file_name, const PetscFileMode mode)
+{
+    int ierr;
+    PetscViewer viewer;
+    ierr = PetscViewerCreate(comm, &viewer);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscViewerSetType(viewer, PETSCVIEWERBINARY);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscViewerFileSetMode(viewer, mode);
+    IBTK_CHKERRQ(ierr);
+#if defined(PETSC_HAVE_MPIIO)
+    ierr = PetscViewerBinarySetUseMPIIO(viewer, PETSC_TRUE);
+    IBTK_CHKERRQ(ierr);
+#endif
+    ierr = PetscViewerBinarySetSkipInfo(viewer, PETSC_TRUE);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscViewerFileSetName(viewer, file_name.c_str());
+    IBTK_CHKERRQ(ierr);
+    return viewer;
+}
+} // namespace
+
+void
+write_equation_systems_data(libMesh::EquationSystems& equation_systems, const std::string& file_name)
+{
+    const MPI_Comm comm = equation_systems.comm().get();
+    PetscViewer viewer = open_binary_viewer(comm, file_name, FILE_MODE_WRITE);
+    int ierr;
+    for (unsigned int sys_num = 0; sys_num < equation_systems.n_systems(); ++sys_num)
+    {
+        libMesh::System& system = equation_systems.get_system(sys_num);
+        const std::vector<libMesh::PetscVector<double>*> vecs = get_system_vectors(system);
+        for (libMesh::PetscVector<double>* vec : vecs) vec->close();
+
+        Vec canonical_vec;
+        ierr = VecCreateMPI(comm, PETSC_DECIDE, static_cast<PetscInt>(system.n_dofs()), &canonical_vec);
+        IBTK_CHKERRQ(ierr);
+        VecScatter scatter = create_canonical_scatter(system, vecs[0]->vec(), canonical_vec);
+        for (libMesh::PetscVector<double>* vec : vecs)
+        {
+            ierr = VecScatterBegin(scatter, vec->vec(), canonical_vec, INSERT_VALUES, SCATTER_FORWARD);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecScatterEnd(scatter, vec->vec(), canonical_vec, INSERT_VALUES, SCATTER_FORWARD);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecView(canonical_vec, viewer);
+            IBTK_CHKERRQ(ierr);
+        }
+        ierr = VecScatterDestroy(&scatter);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&canonical_vec);
+        IBTK_CHKERRQ(ierr);
+    }
+    ierr = PetscViewerDestroy(&viewer);
+    IBTK_CHKERRQ(ierr);
+}
+
+void
+read_equation_systems_data(libMesh::EquationSystems& equation_systems, const std::string& file_name)
+{
+    const MPI_Comm comm = equation_systems.comm().get();
+    PetscViewer viewer = open_binary_viewer(comm, file_name, FILE_MODE_READ);
+    int ierr;
+    for (unsigned int sys_num = 0; sys_num < equation_systems.n_systems(); ++sys_num)
+    {
+        libMesh::System& system = equation_systems.get_system(sys_num);
+        const std::vector<libMesh::PetscVector<double>*> vecs = get_system_vectors(system);
+        for (libMesh::PetscVector<double>* vec : vecs) vec->close();
+
+        Vec canonical_vec;
+        ierr = VecCreateMPI(comm, PETSC_DECIDE, static_cast<PetscInt>(system.n_dofs()), &canonical_vec);
+        IBTK_CHKERRQ(ierr);
+        VecScatter scatter = create_canonical_scatter(system, vecs[0]->vec(), canonical_vec);
+        for (libMesh::PetscVector<double>* vec : vecs)
+        {
+            // VecLoad() checks that the stored vector has the same size.
+            ierr = VecLoad(canonical_vec, viewer);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecScatterBegin(scatter, canonical_vec, vec->vec(), INSERT_VALUES, SCATTER_REVERSE);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecScatterEnd(scatter, canonical_vec, vec->vec(), INSERT_VALUES, SCATTER_REVERSE);
+            IBTK_CHKERRQ(ierr);
+            // Update the ghost values.
+            vec->close();
+        }
+        ierr = VecScatterDestroy(&scatter);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&canonical_vec);
+        IBTK_CHKERRQ(ierr);
+        system.update();
+    }
+    ierr = PetscViewerDestroy(&viewer);
+    IBTK_CHKERRQ(ierr);
+}
+
+double
+max_norm_difference(libMesh::PetscVector<double>& X_vec, libMesh::PetscVector<double>* X_ref_vec)
+{
+    unsigned int same_layout = X_ref_vec && X_vec.local_size() == X_ref_vec->local_size() ? 1 : 0;
+    X_vec.comm().min(same_layout);
+    if (!same_layout) return std::numeric_limits<double>::max();
+
+    int ierr;
+    const double* X_vals;
+    const double* X_ref_vals;
+    ierr = VecGetArrayRead(X_vec.vec(), &X_vals);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGetArrayRead(X_ref_vec->vec(), &X_ref_vals);
+    IBTK_CHKERRQ(ierr);
+    double max_diff = 0.0;
+    for (unsigned int i = 0; i < X_vec.local_size(); ++i)
+    {
+        max_diff = std::max(max_diff, std::abs(X_vals[i] - X_ref_vals[i]));
+    }
+    ierr = VecRestoreArrayRead(X_ref_vec->vec(), &X_ref_vals);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecRestoreArrayRead(X_vec.vec(), &X_vals);
+    IBTK_CHKERRQ(ierr);
+    X_vec.comm().max(max_diff);
+    return max_diff;
+}
+
 std::vector<libMeshWrappers::BoundingBox>
 get_local_active_element_bounding_boxes(const libMesh::MeshBase& mesh,
                                         const libMesh::System& X_system,
@@ -61,6 +61,9 @@ namespace IBAMR
  * ConvectiveOperator that implements a centered convective differencing
  * operator.
  *
+ * When IBAMR is configured with --enable-openmp, the patches of each level are
+ * differenced in parallel by the available threads.
+ *
  * \see AdvDiffSemiImplicitHierarchyIntegrator
  */
 class AdvDiffCenteredConvectiveOperator : public ConvectiveOperator
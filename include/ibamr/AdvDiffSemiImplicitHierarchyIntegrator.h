@@ -20,15 +20,19 @@
 #include "ibamr/ibamr_enums.h"
 #include "ibamr/ibamr_utilities.h"
 
+#include "ibtk/SAMRAIDataCache.h"
+
 #include "HierarchyFaceDataOpsReal.h"
 #include "IntVector.h"
 #include "MultiblockDataTranslator.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
+#include <deque>
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace IBAMR
 {
@@ -292,6 +296,11 @@ public:
                                        int num_cycles = 1) override;
 
 protected:
+    /*!
+     * Discard the solution history prior to regridding the patch hierarchy.
+     */
+    void regridHierarchyBeginSpecialized() override;
+
     /*!
      * Reset cached hierarchy dependent data.
      */
@@ -380,6 +389,34 @@ private:
      * by the object_name specified in the class constructor.
      */
     void getFromRestart();
+
+    /*!
+     * Store the new values of the transported quantities that are obtained by
+     * solving a linear system in the solution history.
+     */
+    void updateSolutionHistory(double new_time);
+
+    /*!
+     * Set the patch data index Q_idx to the extrapolation to the new time of
+     * the solution history of the transported quantity with index l.
+     */
+    void extrapolateSolutionHistory(unsigned int l, int Q_idx, double new_time);
+
+    /*!
+     * Solutions from previous time steps, which are extrapolated to provide the
+     * initial guesses for the Helmholtz solvers.  The extrapolation order is
+     * set by the input key initial_guess_extrapolation_order (zero, the
+     * default, disables extrapolation).  The history is discarded when the
+     * patch hierarchy is regridded.
+     */
+    int d_initial_guess_extrapolation_order = 0;
+    IBTK::SAMRAIDataCache d_solution_history_cache;
+    struct SolutionHistoryEntry
+    {
+        double time;
+        IBTK::SAMRAIDataCache::CachedPatchDataIndex Q_idx;
+    };
+    std::vector<std::deque<SolutionHistoryEntry> > d_Q_solution_history;
 };
 } // namespace IBAMR
 
@@ -29,10 +29,14 @@
 #include "libmesh/enum_fe_family.h"
 #include "libmesh/enum_order.h"
 #include "libmesh/enum_quadrature_type.h"
+#include "libmesh/enum_xdr_mode.h"
 #include "libmesh/explicit_system.h"
 
+#include <map>
+#include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
 
@@ -41,6 +45,45 @@ namespace IBAMR
 /*!
  * @brief      Class FEMechanicsBase provides core finite element mechanics
  *             functionality and data management.
+ *
+ * If <code>use_threaded_force_assembly</code> is set to <code>TRUE</code> in
+ * the input database (the default is <code>FALSE</code>) and libMesh was
+ * started with more than one thread (e.g., with <code>--n_threads</code>),
+ * then the element loop used to assemble the interior force density is split
+ * across threads with libMesh::Threads::parallel_reduce(). In this case all
+ * registered stress and force functions must be thread-safe.
+ *
+ * The input database key <code>l2_projection_solver_type</code> selects how
+ * consistent mass matrix L2 projections are solved: <code>"KRYLOV"</code>
+ * (the default) uses an iterative solver configurable from the PETSc options
+ * database, <code>"CHOLESKY"</code> factors the mass matrix once and reuses
+ * the factorization, and <code>"CHEBYSHEV"</code> uses a fixed number of
+ * Chebyshev iterations preconditioned by the lumped mass matrix. See
+ * IBTK::FEProjector for more details.
+ *
+ * The quadrature, FE, and Jacobian caches used by the FEDataManager objects
+ * of inheriting classes store an entry for every combination of element type,
+ * quadrature type, and quadrature order they encounter. Setting
+ * <code>cache_max_size</code> to a positive integer bounds the number of
+ * entries in each of these caches: the least recently used entries are
+ * discarded first. The default value, zero, means that the caches are
+ * unbounded.
+ *
+ * libMesh restart data are written in the format given by
+ * <code>libmesh_restart_file_extension</code>: <code>"xdr"</code> (the
+ * default) is binary and <code>"xda"</code> is ASCII. libMesh can only
+ * compress ASCII files, so only <code>"xda"</code> may be followed by a
+ * compression suffix (<code>"xda.gz"</code>, <code>"xda.bz2"</code>, or
+ * <code>"xda.xz"</code>); any other extension is an error. By default the
+ * EquationSystems are gathered and written by one processor in a
+ * partition-agnostic ordering. If <code>libmesh_restart_use_collective_io</code>
+ * is <code>TRUE</code>, then that file only describes the systems and all
+ * processors write the vectors together to a single additional binary file
+ * (with MPI-IO, if PETSc supports it). The vectors are stored in an order
+ * that only depends on the node and element ids, so they can be read back
+ * with any partitioning of the mesh, e.g., after
+ * <code>libmesh_partitioner_type = "SAMRAI_BOX"</code> repartitioned it. This
+ * requires a replicated mesh.
  */
 class FEMechanicsBase : public SAMRAI::tbox::Serializable
 {
@@ -170,8 +213,32 @@ public:
      */
     using PK1StressFcnPtr = IBTK::TensorMeshFcnPtr;
 
+    /*!
+     * Typedef specifying interface for a batched PK1 stress tensor function.
+     *
+     * A batched function is called once per element (or once per side of an
+     * element) instead of once per quadrature point. All pointer arguments
+     * refer to contiguous arrays of length @p n_qp: the function should set
+     * PP[qp] using FF[qp], x[qp], and X[qp] for qp = 0, ..., n_qp - 1. The
+     * system data is indexed first by quadrature point and then by the
+     * position of the system in PK1StressFcnData::system_data.
+     */
+    using PK1StressBatchFcnPtr = void (*)(
+        libMesh::TensorValue<double>* PP,
+        const libMesh::TensorValue<double>* FF,
+        const libMesh::Point* x,
+        const libMesh::Point* X,
+        unsigned int n_qp,
+        libMesh::Elem* elem,
+        const std::vector<std::vector<const std::vector<double>*> >& system_var_data,
+        const std::vector<std::vector<const std::vector<libMesh::VectorValue<double> >*> >& system_grad_var_data,
+        double data_time,
+        void* ctx);
+
     /*!
      * Struct encapsulating PK1 stress tensor function data.
+     *
+     * Exactly one of fcn and batch_fcn should be set.
      */
     struct PK1StressFcnData
     {
@@ -184,7 +251,21 @@ public:
         {
         }
 
-        PK1StressFcnPtr fcn;
+        PK1StressFcnData(PK1StressBatchFcnPtr batch_fcn,
+                         std::vector<IBTK::SystemData> system_data = {},
+                         void* const ctx = nullptr,
+                         const libMesh::QuadratureType& quad_type = libMesh::INVALID_Q_RULE,
+                         const libMesh::Order& quad_order = libMesh::INVALID_ORDER)
+            : batch_fcn(batch_fcn),
+              system_data(std::move(system_data)),
+              ctx(ctx),
+              quad_type(quad_type),
+              quad_order(quad_order)
+        {
+        }
+
+        PK1StressFcnPtr fcn = nullptr;
+        PK1StressBatchFcnPtr batch_fcn = nullptr;
         std::vector<IBTK::SystemData> system_data;
         void* ctx;
         libMesh::QuadratureType quad_type;
@@ -207,6 +288,34 @@ public:
      */
     std::vector<PK1StressFcnData> getPK1StressFunction(unsigned int part = 0) const;
 
+    /*!
+     * Scratch storage used by evaluatePK1StressFunction() to pass the system
+     * data at a single point to a batched stress function. Callers should
+     * keep one object per stress function outside of their element loops so
+     * that the storage is allocated only once.
+     */
+    struct PK1StressBatchScratch
+    {
+        std::vector<std::vector<const std::vector<double>*> > var_data;
+        std::vector<std::vector<const std::vector<libMesh::VectorValue<double> >*> > grad_var_data;
+    };
+
+    /*!
+     * Evaluate a PK1 stress function at a single point, using the batched
+     * interface if that is the one that was registered.
+     */
+    static void
+    evaluatePK1StressFunction(libMesh::TensorValue<double>& PP,
+                              const PK1StressFcnData& data,
+                              const libMesh::TensorValue<double>& FF,
+                              const libMesh::Point& x,
+                              const libMesh::Point& X,
+                              libMesh::Elem* elem,
+                              const std::vector<const std::vector<double>*>& var_data,
+                              const std::vector<const std::vector<libMesh::VectorValue<double> >*>& grad_var_data,
+                              double data_time,
+                              PK1StressBatchScratch& scratch);
+
     /*!
      * Typedef specifying interface for Lagrangian body force distribution
      * function.
@@ -389,12 +498,40 @@ protected:
      * Assemble the RHS for the interior elastic density, possibly splitting off
      * the normal component of the transmission force along the physical
      * boundary of the Lagrangian structure.
+     *
+     * If @p allow_threads is <code>false</code> then the element loop is not
+     * split across threads even if <code>use_threaded_force_assembly</code> is
+     * set. This is used to avoid nesting threaded loops when this function is
+     * itself called from a threaded loop over parts.
      */
     virtual void assembleInteriorForceDensityRHS(libMesh::PetscVector<double>& F_rhs_vec,
                                                  libMesh::PetscVector<double>& X_vec,
                                                  libMesh::PetscVector<double>* P_vec,
                                                  double data_time,
-                                                 unsigned int part);
+                                                 unsigned int part,
+                                                 bool allow_threads = true);
+
+    /*!
+     * Accumulate the contributions of the elements in [el_begin, el_end) to
+     * the interior elastic force density RHS into @p F_rhs_local_soln, the
+     * local form of @p F_rhs_vec. Element data are gathered from @p
+     * local_solns, which maps each vector read during assembly to a
+     * read-only array of its local form. When this function is called from
+     * several threads at once, the DOF map caches must already contain all
+     * of the elements; @p data_mutex then only guards the setup of the FE
+     * objects.
+     */
+    void assembleInteriorForceDensityRHSOnElements(double* F_rhs_local_soln,
+                                                   const libMesh::PetscVector<double>& F_rhs_vec,
+                                                   libMesh::PetscVector<double>& X_vec,
+                                                   libMesh::PetscVector<double>* P_vec,
+                                                   double data_time,
+                                                   unsigned int part,
+                                                   std::vector<libMesh::Elem*>::const_iterator el_begin,
+                                                   std::vector<libMesh::Elem*>::const_iterator el_end,
+                                                   const std::map<const libMesh::NumericVector<double>*, const double*>&
+                                                       local_solns,
+                                                   std::mutex& data_mutex);
 
     /*!
      * Initialize the physical coordinates using the supplied coordinate mapping
@@ -536,6 +673,21 @@ protected:
     std::vector<libMesh::QuadratureType> d_default_quad_type_stress, d_default_quad_type_force;
     std::vector<libMesh::Order> d_default_quad_order_stress, d_default_quad_order_force;
     bool d_use_consistent_mass_matrix = true;
+    bool d_use_threaded_force_assembly = false;
+
+    /*!
+     * Maximum number of entries stored in each quadrature, FE, and Jacobian
+     * cache. Zero means that the caches are unbounded.
+     */
+    std::size_t d_cache_max_size = 0;
+
+    /*!
+     * Mutex guarding DOF map caches and PETSc vector access during force
+     * assembly. This is shared by all parts so that assembly may also be run
+     * concurrently on different parts.
+     */
+    std::mutex d_assembly_mutex;
+    IBTK::L2ProjectionSolverType d_L2_projection_solver_type = IBTK::L2_PROJECTION_KRYLOV;
     bool d_include_normal_stress_in_weak_form = false;
     bool d_include_tangential_stress_in_weak_form = false;
     bool d_include_normal_surface_forces_in_weak_form = true;
@@ -587,6 +739,18 @@ protected:
      */
     std::string d_libmesh_restart_file_extension;
 
+    /*!
+     * Whether or not the vectors of the libMesh equation systems should be
+     * written collectively to a single partition-independent file.
+     */
+    bool d_libmesh_restart_use_collective_io = false;
+
+    /*!
+     * Whether or not the libMesh restart files being read were written with
+     * collective IO.
+     */
+    bool d_libmesh_restart_read_collective_io = false;
+
 private:
     /*!
      * Implementation of class constructor.
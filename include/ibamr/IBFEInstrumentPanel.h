@@ -22,6 +22,8 @@
 #include "ibtk/ibtk_macros.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "Box.h"
+#include "BoxArray.h"
 #include "tbox/DescribedClass.h"
 #include "tbox/Pointer.h"
 
@@ -38,6 +40,8 @@ IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <fstream>
 #include <memory>
+#include <utility>
+#include <vector>
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
 
@@ -46,6 +50,19 @@ namespace IBAMR
 /*!
  * \brief Class IBFEInstrumentPanel provides support for meters to measure flow
  * and pressure.
+ *
+ * The quadrature points of the meter meshes are assigned to the patches of
+ * the Cartesian grid hierarchy in initializeHierarchyDependentData(), and
+ * readInstrumentData() interpolates the Eulerian data at the points assigned
+ * to each local patch. The assignment is recomputed only if the patch
+ * hierarchy has changed, if the quadrature rule has changed, or if a meter
+ * mesh has moved by more than <code>meters_remap_tol</code> (in the max norm)
+ * since the assignment was last computed. The default tolerance of zero
+ * recomputes the assignment whenever the meters move. With a positive
+ * tolerance, the quadrature points used to read the data may lag the meter
+ * positions by up to that distance. Setting
+ * <code>meters_reuse_quad_point_mapping</code> to <code>FALSE</code> (the
+ * default is <code>TRUE</code>) recomputes the assignment every time.
  */
 class IBFEInstrumentPanel
 {
@@ -122,6 +139,18 @@ public:
      */
     libMesh::Order getMeterMeshQuadOrder(const unsigned int jj) const;
 
+    /*!
+     * \return The flow rates through the meters computed by the last call to
+     * readInstrumentData()
+     */
+    const std::vector<double>& getFlowValues() const;
+
+    /*!
+     * \return The mean pressures on the meters computed by the last call to
+     * readInstrumentData()
+     */
+    const std::vector<double>& getMeanPressureValues() const;
+
 private:
     /*!
      * \brief initialize data which depend on the FE equation systems for
@@ -130,6 +159,12 @@ private:
      */
     void initializeSystemDependentData(IBAMR::IBFEMethod* ib_method_ops, int meter_mesh_number);
 
+    /*!
+     * \brief determine whether the assignment of the meter mesh quadrature
+     * points to the patches of the hierarchy is still valid.
+     */
+    bool quadPointMappingIsCurrent(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy) const;
+
     /*!
      * \brief write out data to file.
      */
@@ -278,6 +313,24 @@ private:
      */
     using QuadPointMap = std::multimap<SAMRAI::hier::Index<NDIM>, QuadPointStruct, IndexFortranOrder>;
     std::vector<QuadPointMap> d_quad_point_map;
+
+    /*!
+     * \brief the quadrature points which lie in each local patch, indexed by
+     * level number and local patch number.
+     */
+    using PatchQuadPoints = std::vector<std::pair<SAMRAI::hier::Index<NDIM>, QuadPointStruct> >;
+    std::vector<std::vector<PatchQuadPoints> > d_patch_quad_points;
+
+    /*!
+     * \brief the configuration of the hierarchy and of the meter meshes for
+     * which the quadrature points were assigned to patches.
+     */
+    bool d_reuse_quad_point_mapping = true;
+    double d_remap_tol = 0.0;
+    std::vector<SAMRAI::hier::BoxArray<NDIM> > d_mapped_level_boxes;
+    std::vector<std::vector<SAMRAI::hier::Box<NDIM> > > d_mapped_patch_boxes;
+    std::vector<libMesh::Order> d_mapped_quad_order;
+    std::vector<std::vector<double> > d_mapped_meter_displacements;
 };
 } // namespace IBAMR
 
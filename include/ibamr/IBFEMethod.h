@@ -28,11 +28,13 @@
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/libmesh_utilities.h"
 
+#include "Box.h"
 #include "BoxGeneratorStrategy.h"
 #include "GriddingAlgorithm.h"
 #include "IntVector.h"
 #include "LoadBalancer.h"
 #include "PatchHierarchy.h"
+#include "SideIndex.h"
 #include "SideVariable.h"
 #include "TagAndInitializeStrategy.h"
 #include "Variable.h"
@@ -297,9 +299,58 @@ class IBFEDirectForcingKinematics;
  * regions since some patches will be merged together.
  *
  * The parameter <code>workload_quad_point_weight</code> is the multiplier
- * assigned to an IB point when calculating the work per processor: in the
- * future additional weights, such as <code>workload_node_point_weight</code>
- * will also be added.
+ * assigned to an IB point when calculating the work per processor. All
+ * workload weights are relative to the cost of one Eulerian cell. The
+ * following additional parameters refine this estimate:
+ * <ol>
+ *   <li><code>workload_quad_point_weights</code>: a database whose keys are
+ *   libMesh element type names (e.g., <code>HEX27</code>) and whose values are
+ *   the relative costs of quadrature points on those element types (see
+ *   IBTK::FEDataManager::WorkloadSpec::elem_type_q_point_weights).</li>
+ *   <li><code>workload_jump_condition_quad_point_weight</code>: an additional
+ *   weight added to each quadrature point of parts that impose jump
+ *   conditions. Defaults to zero.</li>
+ *   <li><code>workload_calibration_steps</code>: if positive, the wall clock
+ *   time spent in force spreading and velocity interpolation and the time spent
+ *   in the remainder of each time step are recorded over this many time steps.
+ *   At the end of that period the quadrature point weights of every part are
+ *   rescaled by a common factor so that the ratio of the quadrature point
+ *   workload to the Eulerian cell workload matches the ratio of the measured
+ *   times. Relative weights (e.g., between element types) are preserved. The
+ *   new weights are used at the next regrid. The times are measured with the
+ *   timers <code>IBAMR::IBFEMethod::interpolateVelocity()</code>,
+ *   <code>IBAMR::IBFEMethod::spreadForce()</code>, and
+ *   <code>IBAMR::IBFEMethod::timeStep()</code>. The progress of the
+ *   calibration and the calibrated weights are stored in restart files, so a
+ *   restarted run neither repeats nor discards the calibration. Defaults to
+ *   zero, i.e., no calibration.</li>
+ * </ol>
+ *
+ * <h2>Caching Jump Condition Intersections</h2>
+ * When jump conditions are used (<code>use_jump_conditions = TRUE</code>),
+ * most of the cost of imposing them is in finding the intersections of the
+ * physical boundaries of the structure with the Cartesian grid lines. If
+ * <code>jump_condition_intersection_cache_tol</code> is nonnegative, then the
+ * intersections found on each patch are stored and reused until the
+ * structure has moved by more than that distance (measured in the max norm)
+ * or the patch configuration changes. The jump conditions themselves are
+ * always evaluated with the current data. A tolerance of zero reuses
+ * intersections only if the structure has not moved at all. The default
+ * value of -1 disables the cache.
+ *
+ * <h2>Concurrent Processing of Parts</h2>
+ * If <code>process_parts_concurrently</code> is set to <code>TRUE</code> (the
+ * default is <code>FALSE</code>) and libMesh was started with more than one
+ * thread, then the interior force densities of the different parts are
+ * assembled concurrently, with each part assigned to a thread. Each part
+ * assembles into its own right-hand side vector, so no further synchronization
+ * is required. In this case the element loop within each part is run on a
+ * single thread, even if <code>use_threaded_force_assembly</code> is also set,
+ * so that threaded loops are never nested. Steps that communicate (L2
+ * projections, spreading, and interpolation) are still performed one part at a
+ * time. As with
+ * <code>use_threaded_force_assembly</code>, all registered stress and force
+ * functions must be thread-safe if this option is enabled.
  *
  * <h2>Options Controlling Logging</h2>
  * The logging options set by this class are propagated to the owned
@@ -379,6 +430,21 @@ public:
      */
     IBTK::FEDataManager* getFEDataManager(unsigned int part = 0) const;
 
+    /*!
+     * Return the number of times that jump conditions have been imposed on
+     * the specified part.
+     */
+    unsigned int getNumJumpConditionImpositions(unsigned int part = 0) const;
+
+    /*!
+     * Return the number of times that the intersections of the specified
+     * part with the Cartesian grid lines have been recomputed to impose jump
+     * conditions. This is equal to getNumJumpConditionImpositions() unless
+     * <code>jump_condition_intersection_cache_tol</code> is nonnegative and
+     * previously computed intersections have been reused.
+     */
+    unsigned int getNumJumpConditionIntersectionSearches(unsigned int part = 0) const;
+
     /*!
      * Indicate that a part should use stress normalization.
      */
@@ -780,6 +846,12 @@ protected:
      */
     bool d_use_scratch_hierarchy = false;
 
+    /*!
+     * Whether or not the force densities of different parts should be
+     * assembled concurrently.
+     */
+    bool d_process_parts_concurrently = false;
+
     /*!
      * Pointers to the patch hierarchy and gridding algorithm objects associated
      * with this object.
@@ -924,11 +996,55 @@ protected:
     IBTK::FEDataManager::SpreadSpec d_default_spread_spec;
     IBTK::FEDataManager::WorkloadSpec d_default_workload_spec;
     std::vector<IBTK::FEDataManager::WorkloadSpec> d_workload_spec;
+
+    /*!
+     * Additional workload weight of quadrature points on parts that impose
+     * jump conditions.
+     */
+    double d_workload_jump_condition_q_point_weight = 0.0;
+
+    /*!
+     * Data used to calibrate the workload weights: the number of time steps
+     * to measure, the number of time steps measured so far, the accumulated
+     * wall clock times spent in Lagrangian-Eulerian interaction and in
+     * complete time steps on this processor, and the factor by which the
+     * calibration has scaled the quadrature point weights. All but the first
+     * are stored in restart files. See the main documentation of this class
+     * for more information.
+     */
+    int d_workload_calibration_steps = 0;
+    int d_workload_calibration_step_num = 0;
+    double d_workload_interaction_time = 0.0;
+    double d_workload_step_time = 0.0;
+    double d_workload_calibration_scale = 1.0;
     std::vector<IBTK::FEDataManager::InterpSpec> d_interp_spec;
     std::vector<IBTK::FEDataManager::SpreadSpec> d_spread_spec;
     bool d_split_normal_force = false, d_split_tangential_force = false;
     bool d_use_jump_conditions = false;
 
+    /*!
+     * Cached grid line-boundary intersections used to impose jump conditions,
+     * indexed by part and then by local patch number, along with the
+     * structure positions at which they were computed.
+     */
+    struct JumpConditionSideIntersections
+    {
+        libMesh::Elem* elem;
+        unsigned int side;
+        std::vector<libMesh::Point> ref_coords;
+        std::vector<SAMRAI::pdat::SideIndex<NDIM> > indices;
+    };
+    struct PatchJumpConditionIntersections
+    {
+        SAMRAI::hier::Box<NDIM> patch_box;
+        std::vector<libMesh::Elem*> patch_elems;
+        std::vector<JumpConditionSideIntersections> side_intersections;
+    };
+    double d_jump_condition_intersection_cache_tol = -1.0;
+    std::vector<std::vector<PatchJumpConditionIntersections> > d_jump_condition_intersections;
+    std::vector<std::unique_ptr<libMesh::PetscVector<double> > > d_jump_condition_intersection_X_vecs;
+    std::vector<unsigned int> d_num_jump_condition_impositions, d_num_jump_condition_intersection_searches;
+
     /*!
      * Data related to handling stress normalization.
      */
@@ -1026,6 +1142,13 @@ private:
      * explicitly asserts that this condition is met.
      */
     void assertStructureOnFinestLevel() const;
+
+    /*!
+     * Rescale the quadrature point workload weights of all parts based on the
+     * times measured during the first <code>workload_calibration_steps</code>
+     * time steps.
+     */
+    void calibrateWorkloadSpecs();
 };
 } // namespace IBAMR
 
@@ -23,10 +23,12 @@
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/libmesh_utilities.h"
 
+#include "Box.h"
 #include "GriddingAlgorithm.h"
 #include "IntVector.h"
 #include "LoadBalancer.h"
 #include "PatchHierarchy.h"
+#include "SideIndex.h"
 #include "tbox/Pointer.h"
 
 #include "libmesh/enum_fe_family.h"
@@ -98,6 +100,19 @@ namespace IBAMR
  *
  * \note When using the IIM implementation, it is recommended that users set
  * all linear solvers to use tight relative tolerances (1e-10).
+ *
+ * The input options <code>libmesh_restart_file_extension</code> and
+ * <code>libmesh_restart_use_collective_io</code> control the format of the
+ * libMesh restart data in the same way as in FEMechanicsBase.
+ *
+ * Finding the intersections of the surface mesh with the Cartesian grid lines
+ * is the most expensive part of imposing jump conditions. If the input option
+ * <code>jump_condition_intersection_cache_tol</code> is nonnegative, then the
+ * intersections found on each patch are stored and reused until the surface
+ * has moved by more than that distance (measured in the max norm) or the
+ * patch configuration changes. A tolerance of zero reuses intersections only
+ * if the surface has not moved at all. The default value of -1 disables the
+ * cache.
  */
 class IBFESurfaceMethod : public IBStrategy
 {
@@ -150,6 +165,21 @@ public:
      */
     IBTK::FEDataManager* getFEDataManager(unsigned int part = 0) const;
 
+    /*!
+     * Return the number of times that jump conditions have been imposed on
+     * the specified part.
+     */
+    unsigned int getNumJumpConditionImpositions(unsigned int part = 0) const;
+
+    /*!
+     * Return the number of times that the intersections of the specified
+     * part with the Cartesian grid lines have been recomputed to impose jump
+     * conditions. This is equal to getNumJumpConditionImpositions() unless
+     * <code>jump_condition_intersection_cache_tol</code> is nonnegative and
+     * previously computed intersections have been reused.
+     */
+    unsigned int getNumJumpConditionIntersectionSearches(unsigned int part = 0) const;
+
     /*!
      * Typedef specifying interface for coordinate mapping function.
      */
@@ -594,6 +624,29 @@ protected:
     double d_wss_calc_width = 0.0;
     double d_p_calc_width = 0.0;
 
+    /*
+     * Cached grid line-surface intersections used to impose jump conditions,
+     * indexed by part and then by local patch number, along with the
+     * structure positions at which they were computed.
+     */
+    struct JumpConditionIntersection
+    {
+        libMesh::Elem* elem;
+        SAMRAI::pdat::SideIndex<NDIM> i_s;
+        double sgn;
+        std::vector<double> phi;
+    };
+    struct PatchJumpConditionIntersections
+    {
+        SAMRAI::hier::Box<NDIM> patch_box;
+        std::vector<libMesh::Elem*> patch_elems;
+        std::vector<JumpConditionIntersection> intersections;
+    };
+    double d_jump_condition_intersection_cache_tol = -1.0;
+    std::vector<std::vector<PatchJumpConditionIntersections> > d_jump_condition_intersections;
+    std::vector<std::unique_ptr<libMesh::PetscVector<double> > > d_jump_condition_intersection_X_vecs;
+    std::vector<unsigned int> d_num_jump_condition_impositions, d_num_jump_condition_intersection_searches;
+
     /*
      * Functions used to compute the initial coordinates of the Lagrangian mesh.
      */
@@ -640,6 +693,14 @@ protected:
      */
     std::string d_libmesh_restart_file_extension = "xdr";
 
+    /*
+     * Whether or not the vectors of the libMesh equation systems should be
+     * written collectively to a single partition-independent file, and
+     * whether or not the restart files being read were written that way.
+     */
+    bool d_libmesh_restart_use_collective_io = false;
+    bool d_libmesh_restart_read_collective_io = false;
+
 private:
     /*!
      * \brief Default constructor.
@@ -83,6 +83,12 @@ namespace IBAMR
  * \brief Class IBMethod is an implementation of the abstract base class
  * IBImplicitStrategy that provides functionality required by the standard IB
  * method.
+ *
+ * The cost of each IB point used in workload estimates, relative to the cost
+ * of one Eulerian cell, is set by <code>workload_node_weight</code> (default
+ * 1.0). If <code>scale_workload_by_kernel_width</code> is <code>TRUE</code>
+ * (default <code>FALSE</code>) then this weight is scaled by the volume of the
+ * kernel stencil: see IBTK::LDataManager::setWorkloadNodeWeight().
  */
 class IBMethod : public IBImplicitStrategy
 {
@@ -542,6 +548,12 @@ protected:
     bool d_error_if_points_leave_domain = false;
     SAMRAI::hier::IntVector<NDIM> d_ghosts;
 
+    /*
+     * Parameters used to estimate the workload of each IB point.
+     */
+    double d_workload_node_weight = 1.0;
+    bool d_scale_workload_by_kernel_width = false;
+
     /*
      * Lagrangian variables.
      */
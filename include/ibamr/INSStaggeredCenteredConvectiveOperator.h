@@ -52,6 +52,9 @@ namespace IBAMR
  * ConvectiveOperator which implements a centered convective differencing
  * operator.
  *
+ * When IBAMR is configured with --enable-openmp, the patches of each level are
+ * differenced in parallel by the available threads.
+ *
  * \see INSStaggeredHierarchyIntegrator
  */
 class INSStaggeredCenteredConvectiveOperator : public ConvectiveOperator
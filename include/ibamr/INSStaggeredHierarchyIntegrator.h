@@ -22,6 +22,7 @@
 #include "ibamr/StaggeredStokesSolverManager.h"
 #include "ibamr/ibamr_enums.h"
 
+#include "ibtk/SAMRAIDataCache.h"
 #include "ibtk/SideDataSynchronization.h"
 
 #include "CellVariable.h"
@@ -35,6 +36,7 @@
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
+#include <deque>
 #include <string>
 #include <vector>
 
@@ -355,6 +357,20 @@ private:
      */
     TimeSteppingType getConvectiveTimeSteppingType(int cycle_num);
 
+    /*!
+     * Store the velocity and pressure computed during the most recent time
+     * step in the solution history.
+     */
+    void updateSolutionHistory(double current_time, double new_time);
+
+    /*!
+     * Set the solution vector to the extrapolation of the solution history to
+     * the new time.
+     */
+    void extrapolateSolutionHistory(const SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> >& sol_vec,
+                                    double current_time,
+                                    double new_time);
+
     /*!
      * Hierarchy operations objects.
      */
@@ -392,6 +408,23 @@ private:
     SAMRAI::tbox::Pointer<StaggeredStokesSolver> d_stokes_solver;
     bool d_stokes_solver_needs_init;
 
+    /*!
+     * Velocity and pressure solutions from previous time steps, which are
+     * extrapolated to provide the initial guess for the Stokes solver.  The
+     * extrapolation order is set by the input key
+     * initial_guess_extrapolation_order (zero, the default, disables
+     * extrapolation, in which case the initial guess is the current solution).
+     * The history is discarded when the patch hierarchy is regridded.
+     */
+    int d_initial_guess_extrapolation_order = 0;
+    IBTK::SAMRAIDataCache d_solution_history_cache;
+    struct SolutionHistoryEntry
+    {
+        double U_time, P_time;
+        IBTK::SAMRAIDataCache::CachedPatchDataIndex U_idx, P_idx;
+    };
+    std::deque<SolutionHistoryEntry> d_solution_history;
+
     /*!
      * Fluid solver variables.
      */
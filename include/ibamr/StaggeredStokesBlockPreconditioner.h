@@ -150,6 +150,19 @@ public:
      */
     void deallocateSolverState() override;
 
+    /*!
+     * \brief Update the solver to use new problem coefficients.
+     *
+     * The problem coefficients are only used when the preconditioner is
+     * applied, so this function only requires that the solver state is
+     * initialized.
+     *
+     * \note As with initializeSolverState(), the velocity and pressure
+     * subdomain solvers are not updated by this function.  They must be
+     * updated by the object that manages them.
+     */
+    bool updateProblemCoefficients() override;
+
 protected:
     /*!
      * \brief Remove components in operator null space.
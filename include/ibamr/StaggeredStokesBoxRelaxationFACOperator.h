@@ -16,14 +16,13 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibamr/StaggeredStokesFACPreconditioner.h"
 #include "ibamr/StaggeredStokesFACPreconditionerStrategy.h"
+#include "ibamr/StaggeredStokesSolver.h"
 
+#include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
-#include "petscksp.h"
-#include "petscmat.h"
-#include "petscvec.h"
-
 #include <array>
 #include <string>
 #include <vector>
@@ -54,6 +53,11 @@ namespace IBAMR
  * \brief Class StaggeredStokesBoxRelaxationFACOperator is a concrete
  * StaggeredStokesFACPreconditionerStrategy implementing a box relaxation
  * (Vanka-type) smoother for use as a multigrid preconditioner.
+ *
+ * The smoother sweeps over the cells of each patch, solving a local Stokes
+ * problem for the velocity and pressure degrees of freedom of each cell.  The
+ * local operator is the same for all cells on a level, so it is factored once
+ * (via a dense LU factorization) and applied with a fixed-size kernel.
  */
 class StaggeredStokesBoxRelaxationFACOperator : public StaggeredStokesFACPreconditionerStrategy
 {
@@ -70,6 +74,21 @@ public:
      */
     ~StaggeredStokesBoxRelaxationFACOperator();
 
+    /*!
+     * \brief Static function to construct a StaggeredStokesFACPreconditioner with a
+     * StaggeredStokesBoxRelaxationFACOperator FAC strategy.
+     */
+    static SAMRAI::tbox::Pointer<StaggeredStokesSolver>
+    allocate_solver(const std::string& object_name,
+                    SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                    const std::string& default_options_prefix)
+    {
+        SAMRAI::tbox::Pointer<StaggeredStokesFACPreconditionerStrategy> fac_operator =
+            new StaggeredStokesBoxRelaxationFACOperator(
+                object_name + "::StaggeredStokesBoxRelaxationFACOperator", input_db, default_options_prefix);
+        return new StaggeredStokesFACPreconditioner(object_name, fac_operator, input_db, default_options_prefix);
+    } // allocate_solver
+
     /*!
      * \name Implementation of FACPreconditionerStrategy interface.
      */
@@ -141,11 +160,10 @@ private:
     StaggeredStokesBoxRelaxationFACOperator& operator=(const StaggeredStokesBoxRelaxationFACOperator& that) = delete;
 
     /*
-     * Box operator data.
+     * Box operator data: the dense inverse of the single-cell box operator
+     * (2*NDIM face velocities and one cell pressure) on each level.
      */
-    std::vector<Mat> d_box_op;
-    std::vector<Vec> d_box_e, d_box_r;
-    std::vector<KSP> d_box_ksp;
+    std::vector<std::array<double, (2 * NDIM + 1) * (2 * NDIM + 1)> > d_box_inv;
 
     /*
      * Mappings from patch indices to patch operators.
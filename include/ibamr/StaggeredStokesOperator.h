@@ -182,6 +182,14 @@ public:
      */
     void deallocateOperatorState() override;
 
+    /*!
+     * \brief Update the operator to use new problem coefficients.
+     *
+     * The problem coefficients are only used when the operator is applied, so
+     * this function only requires that the operator state is initialized.
+     */
+    bool updateProblemCoefficients() override;
+
     /*!
      * \brief Modify the RHS vector to account for physical boundary conditions.
      */
@@ -0,0 +1,69 @@
+## ---------------------------------------------------------------------
+##
+## Copyright (c) 2020 - 2020 by the IBAMR developers
+## All rights reserved.
+##
+## This file is part of IBAMR.
+##
+## IBAMR is free software and is distributed under the 3-clause BSD
+## license. The full text of the license can be found in the file
+## COPYRIGHT at the top level directory of IBAMR.
+##
+## ---------------------------------------------------------------------
+
+AC_DEFUN([CONFIGURE_OPENMP],[
+echo
+echo "===================================="
+echo "Configuring optional package OpenMP"
+echo "===================================="
+
+AC_ARG_ENABLE([openmp],
+  AS_HELP_STRING(--enable-openmp,enable thread-parallel patch loops with OpenMP @<:@default=no@:>@),
+                 [case "$enableval" in
+                    yes)  OPENMP_ENABLED=yes ;;
+                    no)   OPENMP_ENABLED=no ;;
+                    *)    AC_MSG_ERROR(--enable-openmp=$enableval is invalid; choices are "yes" and "no") ;;
+                  esac],[OPENMP_ENABLED=no])
+
+if test "$OPENMP_ENABLED" = yes; then
+  dnl Try the flags used by the common compilers in turn: none (the flag is
+  dnl already in CXXFLAGS), GCC and Clang, Intel, Sun/Oracle, and PGI.
+  AC_MSG_CHECKING([for the C++ compiler flag that enables OpenMP])
+  OPENMP_CXXFLAGS=unknown
+  openmp_save_CXXFLAGS=$CXXFLAGS
+  for openmp_flag in none -fopenmp -qopenmp -openmp -xopenmp -mp; do
+    if test "$openmp_flag" = none; then
+      CXXFLAGS=$openmp_save_CXXFLAGS
+    else
+      CXXFLAGS="$openmp_save_CXXFLAGS $openmp_flag"
+    fi
+    AC_LINK_IFELSE([AC_LANG_PROGRAM([[
+#ifndef _OPENMP
+#error OpenMP is not enabled
+#endif
+#include <omp.h>
+]], [[
+    int n_threads = 0;
+#pragma omp parallel reduction(+ : n_threads)
+    n_threads += 1;
+    return n_threads > 0 ? 0 : 1;
+]])],[
+      if test "$openmp_flag" = none; then
+        OPENMP_CXXFLAGS=""
+      else
+        OPENMP_CXXFLAGS=$openmp_flag
+      fi
+      break])
+  done
+  CXXFLAGS=$openmp_save_CXXFLAGS
+  if test "$OPENMP_CXXFLAGS" = unknown; then
+    AC_MSG_RESULT([not found])
+    AC_MSG_ERROR([--enable-openmp was specified, but the C++ compiler does not appear to support OpenMP])
+  fi
+  AC_MSG_RESULT([${OPENMP_CXXFLAGS:-none needed}])
+  PACKAGE_CXXFLAGS_APPEND($OPENMP_CXXFLAGS)
+  PACKAGE_LDFLAGS_APPEND($OPENMP_CXXFLAGS)
+else
+  AC_MSG_NOTICE([Optional package OpenMP is DISABLED])
+fi
+])
@@ -28,6 +28,7 @@
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/libmesh_utilities.h"
 
+#include "tbox/Array.h"
 #include "tbox/RestartManager.h"
 
 #include "libmesh/boundary_info.h"
@@ -63,14 +64,22 @@
 #include "libmesh/quadrature_gauss.h"
 #include "libmesh/sparse_matrix.h"
 #include "libmesh/string_to_enum.h"
+#include "libmesh/stored_range.h"
 #include "libmesh/system.h"
 #include "libmesh/tensor_value.h"
+#include "libmesh/threads.h"
 #include "libmesh/type_tensor.h"
 #include "libmesh/type_vector.h"
 #include "libmesh/variant_filter_iterator.h"
 #include "libmesh/vector_value.h"
 
+#include <functional>
 #include <iterator>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -153,6 +162,41 @@ get_x_and_FF(libMesh::VectorValue<double>& x,
         FF(i, i) = 1.0;
     }
 }
+
+using ElemPtrRange = StoredRange<std::vector<Elem*>::const_iterator, Elem*>;
+
+// Body for Threads::parallel_reduce() that accumulates element contributions
+// into a private copy of the local form of a ghosted vector.
+class LocalVectorAssemblyBody
+{
+public:
+    using AssemblyFcn = std::function<void(const ElemPtrRange& range, double* local_soln)>;
+
+    LocalVectorAssemblyBody(const std::size_t n_local, AssemblyFcn assemble)
+        : d_local_soln(n_local, 0.0), d_assemble(std::move(assemble))
+    {
+    }
+
+    LocalVectorAssemblyBody(LocalVectorAssemblyBody& other, Threads::split)
+        : d_local_soln(other.d_local_soln.size(), 0.0), d_assemble(other.d_assemble)
+    {
+    }
+
+    void operator()(const ElemPtrRange& range)
+    {
+        d_assemble(range, d_local_soln.data());
+    }
+
+    void join(const LocalVectorAssemblyBody& other)
+    {
+        for (std::size_t i = 0; i < d_local_soln.size(); ++i) d_local_soln[i] += other.d_local_soln[i];
+    }
+
+    std::vector<double> d_local_soln;
+
+private:
+    AssemblyFcn d_assemble;
+};
 } // namespace
 
 const std::string FEMechanicsBase::COORDS_SYSTEM_NAME = "IB coordinates system";
@@ -238,6 +282,7 @@ void
 FEMechanicsBase::registerPK1StressFunction(const PK1StressFcnData& data, const unsigned int part)
 {
     TBOX_ASSERT(part < d_meshes.size());
+    TBOX_ASSERT(!(data.fcn && data.batch_fcn));
     d_PK1_stress_fcn_data[part].push_back(data);
     if (data.quad_type == INVALID_Q_RULE)
     {
@@ -359,6 +404,7 @@ FEMechanicsBase::putToDatabase(Pointer<Database> db)
     db->putInteger("FE_MECHANICS_BASE_VERSION", FE_MECHANICS_BASE_VERSION);
     db->putBool("d_use_consistent_mass_matrix", d_use_consistent_mass_matrix);
     db->putString("d_libmesh_partitioner_type", enum_to_string<LibmeshPartitionerType>(d_libmesh_partitioner_type));
+    db->putBool("d_libmesh_restart_use_collective_io", d_libmesh_restart_use_collective_io);
 }
 
 void
@@ -368,12 +414,19 @@ FEMechanicsBase::writeFEDataToRestartFile(const std::string& restart_dump_dirnam
     {
         const std::string& file_name =
             libmesh_restart_file_name(restart_dump_dirname, time_step_number, part, d_libmesh_restart_file_extension);
-        const XdrMODE xdr_mode = (d_libmesh_restart_file_extension == "xdr" ? ENCODE : WRITE);
-        const int write_mode = EquationSystems::WRITE_DATA | EquationSystems::WRITE_ADDITIONAL_DATA;
-        d_equation_systems[part]->write(file_name,
-                                        xdr_mode,
-                                        write_mode,
-                                        /*partition_agnostic*/ true);
+        const XdrMODE xdr_mode = get_xdr_mode(d_libmesh_restart_file_extension, /*write*/ true);
+        if (d_libmesh_restart_use_collective_io)
+        {
+            // libMesh only writes the definitions of the systems: the vectors
+            // are written separately in a partition-independent order.
+            d_equation_systems[part]->write(file_name, xdr_mode, EquationSystems::WRITE_ADDITIONAL_DATA);
+            write_equation_systems_data(*d_equation_systems[part], file_name + ".data");
+        }
+        else
+        {
+            const int write_mode = EquationSystems::WRITE_DATA | EquationSystems::WRITE_ADDITIONAL_DATA;
+            d_equation_systems[part]->write(file_name, xdr_mode, write_mode, /*partition_agnostic*/ true);
+        }
     }
 }
 
@@ -384,28 +437,154 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
                                                  PetscVector<double>& X_vec,
                                                  PetscVector<double>* P_vec,
                                                  const double data_time,
-                                                 const unsigned int part)
+                                                 const unsigned int part,
+                                                 const bool allow_threads)
 {
-    const bool using_pressure = P_vec != nullptr;
-
-    // Extract the mesh.
     EquationSystems& equation_systems = *d_equation_systems[part];
     const MeshBase& mesh = equation_systems.get_mesh();
-    const BoundaryInfo& boundary_info = *mesh.boundary_info;
-    const unsigned int dim = mesh.mesh_dimension();
+    std::vector<Elem*> local_elems;
+    const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
+    const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
+    for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+    {
+        local_elems.push_back(*el_it);
+    }
+    const bool use_threads = allow_threads && d_use_threaded_force_assembly && libMesh::n_threads() > 1;
+
+    // Determine the vectors (and their systems) that are read during
+    // assembly. These are the same vectors that
+    // assembleInteriorForceDensityRHSOnElements() registers with its
+    // FEDataInterpolation objects.
+    std::vector<NumericVector<double>*> data_vecs = { &X_vec };
+    std::set<std::string> data_system_names = { FORCE_SYSTEM_NAME, COORDS_SYSTEM_NAME };
+    if (P_vec)
+    {
+        data_vecs.push_back(P_vec);
+        data_system_names.insert(PRESSURE_SYSTEM_NAME);
+    }
+    auto add_system_data = [&](const std::vector<SystemData>& system_data) {
+        for (const SystemData& data : system_data)
+        {
+            System& system = equation_systems.get_system(data.system_name);
+            data_vecs.push_back(data.system_vec ? data.system_vec : system.current_local_solution.get());
+            data_system_names.insert(data.system_name);
+        }
+    };
+    for (const PK1StressFcnData& data : d_PK1_stress_fcn_data[part]) add_system_data(data.system_data);
+    add_system_data(d_lag_body_force_fcn_data[part].system_data);
+    add_system_data(d_lag_surface_force_fcn_data[part].system_data);
+    add_system_data(d_lag_surface_pressure_fcn_data[part].system_data);
+
+    // Retrieve the local arrays of these vectors once instead of once per
+    // element.
+    std::map<const NumericVector<double>*, const double*> local_solns;
+    std::vector<PetscVector<double>*> retrieved_vecs;
+    for (NumericVector<double>* const vec : data_vecs)
+    {
+        if (local_solns.count(vec)) continue;
+        auto petsc_vec = dynamic_cast<PetscVector<double>*>(vec);
+        TBOX_ASSERT(petsc_vec);
+        local_solns[vec] = petsc_vec->get_array_read();
+        retrieved_vecs.push_back(petsc_vec);
+    }
+
+    // Threads look up DOF indices without synchronization, which is only safe
+    // if the DOF map caches already contain every element.
+    if (use_threads)
+    {
+        for (const std::string& system_name : data_system_names)
+        {
+            FEDataManager::SystemDofMapCache& dof_map_cache = *d_fe_data[part]->getDofMapCache(system_name);
+            for (const Elem* const elem : local_elems) dof_map_cache.dof_indices(elem);
+        }
+    }
 
-    // Setup global and elemental right-hand-side vectors.
-    auto& F_system = equation_systems.get_system<ExplicitSystem>(FORCE_SYSTEM_NAME);
     // During assembly we sum into ghost regions - this only makes sense if we
     // have a ghosted vector.
     int ierr;
     TBOX_ASSERT(F_rhs_vec.type() == GHOSTED);
     Vec F_rhs_vec_local;
-    ierr = VecGhostGetLocalForm(F_rhs_vec.vec(), &F_rhs_vec_local);
-    IBTK_CHKERRQ(ierr);
     double* F_rhs_local_soln = nullptr;
-    ierr = VecGetArray(F_rhs_vec_local, &F_rhs_local_soln);
+    {
+        std::lock_guard<std::mutex> data_lock(d_assembly_mutex);
+        ierr = VecGhostGetLocalForm(F_rhs_vec.vec(), &F_rhs_vec_local);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecGetArray(F_rhs_vec_local, &F_rhs_local_soln);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    if (use_threads)
+    {
+        // Each thread accumulates into its own copy of the local form of the
+        // right-hand side vector. The copies are summed after all elements
+        // have been processed.
+        PetscInt n_local;
+        ierr = VecGetLocalSize(F_rhs_vec_local, &n_local);
+        IBTK_CHKERRQ(ierr);
+        LocalVectorAssemblyBody body(n_local,
+                                     [&](const ElemPtrRange& range, double* const local_soln) {
+                                         assembleInteriorForceDensityRHSOnElements(local_soln,
+                                                                                   F_rhs_vec,
+                                                                                   X_vec,
+                                                                                   P_vec,
+                                                                                   data_time,
+                                                                                   part,
+                                                                                   range.begin(),
+                                                                                   range.end(),
+                                                                                   local_solns,
+                                                                                   d_assembly_mutex);
+                                     });
+        Threads::parallel_reduce(ElemPtrRange(local_elems.begin(), local_elems.end()), body);
+        for (PetscInt i = 0; i < n_local; ++i)
+        {
+            F_rhs_local_soln[i] += body.d_local_soln[i];
+        }
+    }
+    else
+    {
+        assembleInteriorForceDensityRHSOnElements(F_rhs_local_soln,
+                                                  F_rhs_vec,
+                                                  X_vec,
+                                                  P_vec,
+                                                  data_time,
+                                                  part,
+                                                  local_elems.begin(),
+                                                  local_elems.end(),
+                                                  local_solns,
+                                                  d_assembly_mutex);
+    }
+
+    for (PetscVector<double>* const petsc_vec : retrieved_vecs) petsc_vec->restore_array();
+    std::lock_guard<std::mutex> data_lock(d_assembly_mutex);
+    ierr = VecRestoreArray(F_rhs_vec_local, &F_rhs_local_soln);
     IBTK_CHKERRQ(ierr);
+    ierr = VecGhostRestoreLocalForm(F_rhs_vec.vec(), &F_rhs_vec_local);
+    IBTK_CHKERRQ(ierr);
+}
+
+void
+FEMechanicsBase::assembleInteriorForceDensityRHSOnElements(double* const F_rhs_local_soln,
+                                                           const PetscVector<double>& F_rhs_vec,
+                                                           PetscVector<double>& X_vec,
+                                                           PetscVector<double>* P_vec,
+                                                           const double data_time,
+                                                           const unsigned int part,
+                                                           const std::vector<Elem*>::const_iterator el_begin,
+                                                           const std::vector<Elem*>::const_iterator el_end,
+                                                           const std::map<const NumericVector<double>*, const double*>&
+                                                               local_solns,
+                                                           std::mutex& data_mutex)
+{
+    const bool using_pressure = P_vec != nullptr;
+
+    // Extract the mesh.
+    EquationSystems& equation_systems = *d_equation_systems[part];
+    const MeshBase& mesh = equation_systems.get_mesh();
+    const BoundaryInfo& boundary_info = *mesh.boundary_info;
+    const unsigned int dim = mesh.mesh_dimension();
+
+    // Setup elemental right-hand-side vectors.
+    auto& F_system = equation_systems.get_system<ExplicitSystem>(FORCE_SYSTEM_NAME);
     std::array<DenseVector<double>, NDIM> F_rhs_e;
     std::vector<libMesh::dof_id_type> dof_id_scratch;
 
@@ -414,9 +593,12 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
     const size_t num_PK1_fcns = d_PK1_stress_fcn_data[part].size();
     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
     {
-        if (!d_PK1_stress_fcn_data[part][k].fcn) continue;
+        const PK1StressFcnData& PK1_fcn_data = d_PK1_stress_fcn_data[part][k];
+        if (!PK1_fcn_data.fcn && !PK1_fcn_data.batch_fcn) continue;
 
-        // Extract the FE systems and DOF maps, and setup the FE object.
+        // Extract the FE systems and DOF maps, and setup the FE object. The
+        // FE data object is shared by all threads, so setup is serialized.
+        std::unique_lock<std::mutex> setup_lock(data_mutex);
         const DofMap& F_dof_map = F_system.get_dof_map();
         FEDataManager::SystemDofMapCache& F_dof_map_cache = *d_fe_data[part]->getDofMapCache(FORCE_SYSTEM_NAME);
         FEType F_fe_type = F_dof_map.variable_type(0);
@@ -446,6 +628,8 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
         fe.setupInterpolatedSystemDataIndexes(
             PK1_fcn_system_idxs, d_PK1_stress_fcn_data[part][k].system_data, &equation_systems);
         fe.init();
+        setup_lock.unlock();
+        fe.setLocalSolutionArrays(local_solns);
 
         const std::vector<libMesh::Point>& q_point = fe.getQuadraturePoints();
         const std::vector<double>& JxW = fe.getQuadratureWeights();
@@ -463,6 +647,14 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
         std::vector<const std::vector<double>*> PK1_var_data;
         std::vector<const std::vector<VectorValue<double> >*> PK1_grad_var_data;
 
+        // Scratch arrays used to pass all of the quadrature point data on an
+        // element to a batched stress function in a single call.
+        std::vector<TensorValue<double> > PP_batch, FF_batch;
+        std::vector<libMesh::Point> x_batch;
+        std::vector<std::vector<const std::vector<double>*> > PK1_var_data_batch;
+        std::vector<std::vector<const std::vector<VectorValue<double> >*> > PK1_grad_var_data_batch;
+        PK1StressBatchScratch PK1_batch_scratch;
+
         // Loop over the elements to compute the right-hand side vector.  This
         // is computed via
         //
@@ -473,40 +665,81 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
         // the interior elastic force density.
         TensorValue<double> PP, FF, FF_inv_trans;
         VectorValue<double> F, F_qp, n, x;
-        const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
-        const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
-        for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+        for (auto el_it = el_begin; el_it != el_end; ++el_it)
         {
             Elem* const elem = *el_it;
+            fe.reinit(elem);
             const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
+            fe.collectDataForInterpolation(elem);
             for (unsigned int d = 0; d < NDIM; ++d)
             {
                 F_rhs_e[d].resize(static_cast<int>(F_dof_indices[d].size()));
             }
-            fe.reinit(elem);
-            fe.collectDataForInterpolation(elem);
             fe.interpolate(elem);
             const unsigned int n_qp = qrule->n_points();
             const size_t n_basis = dphi.size();
-            for (unsigned int qp = 0; qp < n_qp; ++qp)
+            if (PK1_fcn_data.batch_fcn)
             {
-                const libMesh::Point& X = q_point[qp];
-                const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
-                const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
-                get_x_and_FF(x, FF, x_data, grad_x_data);
-
-                // Compute the value of the first Piola-Kirchhoff stress tensor
-                // at the quadrature point and add the corresponding forces to
-                // the right-hand-side vector.
-                fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
-                d_PK1_stress_fcn_data[part][k].fcn(
-                    PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, d_PK1_stress_fcn_data[part][k].ctx);
-                for (unsigned int basis_n = 0; basis_n < n_basis; ++basis_n)
+                // Collect the deformation gradients, positions, and system
+                // data at all quadrature points and evaluate the stress in a
+                // single call.
+                PP_batch.resize(n_qp);
+                FF_batch.resize(n_qp);
+                x_batch.resize(n_qp);
+                PK1_var_data_batch.resize(n_qp);
+                PK1_grad_var_data_batch.resize(n_qp);
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
                 {
-                    F_qp = -PP * dphi[basis_n][qp] * JxW[qp];
-                    for (unsigned int i = 0; i < NDIM; ++i)
+                    const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+                    const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
+                    get_x_and_FF(x, FF_batch[qp], x_data, grad_x_data);
+                    x_batch[qp] = x;
+                    fe.setInterpolatedDataPointers(
+                        PK1_var_data_batch[qp], PK1_grad_var_data_batch[qp], PK1_fcn_system_idxs, elem, qp);
+                }
+                PK1_fcn_data.batch_fcn(PP_batch.data(),
+                                       FF_batch.data(),
+                                       x_batch.data(),
+                                       q_point.data(),
+                                       n_qp,
+                                       elem,
+                                       PK1_var_data_batch,
+                                       PK1_grad_var_data_batch,
+                                       data_time,
+                                       PK1_fcn_data.ctx);
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    for (unsigned int basis_n = 0; basis_n < n_basis; ++basis_n)
                     {
-                        F_rhs_e[i](basis_n) += F_qp(i);
+                        F_qp = -PP_batch[qp] * dphi[basis_n][qp] * JxW[qp];
+                        for (unsigned int i = 0; i < NDIM; ++i)
+                        {
+                            F_rhs_e[i](basis_n) += F_qp(i);
+                        }
+                    }
+                }
+            }
+            else
+            {
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    const libMesh::Point& X = q_point[qp];
+                    const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+                    const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
+                    get_x_and_FF(x, FF, x_data, grad_x_data);
+
+                    // Compute the value of the first Piola-Kirchhoff stress
+                    // tensor at the quadrature point and add the corresponding
+                    // forces to the right-hand-side vector.
+                    fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
+                    PK1_fcn_data.fcn(PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, PK1_fcn_data.ctx);
+                    for (unsigned int basis_n = 0; basis_n < n_basis; ++basis_n)
+                    {
+                        F_qp = -PP * dphi[basis_n][qp] * JxW[qp];
+                        for (unsigned int i = 0; i < NDIM; ++i)
+                        {
+                            F_rhs_e[i](basis_n) += F_qp(i);
+                        }
                     }
                 }
             }
@@ -544,20 +777,18 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
                     // Compute the value of the first Piola-Kirchhoff stress
                     // tensor at the quadrature point and add the corresponding
                     // traction force to the right-hand-side vector.
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
-                    {
-                        fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
-                        d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                           FF,
-                                                           x,
-                                                           X,
-                                                           elem,
-                                                           PK1_var_data,
-                                                           PK1_grad_var_data,
-                                                           data_time,
-                                                           d_PK1_stress_fcn_data[part][k].ctx);
-                        F += PP * normal_face[qp];
-                    }
+                    fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
+                    evaluatePK1StressFunction(PP,
+                                              PK1_fcn_data,
+                                              FF,
+                                              x,
+                                              X,
+                                              elem,
+                                              PK1_var_data,
+                                              PK1_grad_var_data,
+                                              data_time,
+                                              PK1_batch_scratch);
+                    F += PP * normal_face[qp];
 
                     n = (FF_inv_trans * normal_face[qp]).unit();
 
@@ -600,6 +831,7 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
     // Now account for any additional force contributions.
 
     // Extract the FE systems and DOF maps, and setup the FE objects.
+    std::unique_lock<std::mutex> setup_lock(data_mutex);
     const DofMap& F_dof_map = F_system.get_dof_map();
     FEDataManager::SystemDofMapCache& F_dof_map_cache = *d_fe_data[part]->getDofMapCache(FORCE_SYSTEM_NAME);
     FEType F_fe_type = F_dof_map.variable_type(0);
@@ -639,6 +871,8 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
     fe.setupInterpolatedSystemDataIndexes(
         surface_pressure_fcn_system_idxs, d_lag_surface_pressure_fcn_data[part].system_data, &equation_systems);
     fe.init();
+    setup_lock.unlock();
+    fe.setLocalSolutionArrays(local_solns);
 
     const std::vector<libMesh::Point>& q_point = fe.getQuadraturePoints();
     const std::vector<double>& JxW = fe.getQuadratureWeights();
@@ -663,18 +897,16 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
     VectorValue<double> F, F_b, F_s, F_qp, n, x;
     boost::multi_array<double, 2> X_node;
     boost::multi_array<double, 1> P_node;
-    const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
-    const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
-    for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+    for (auto el_it = el_begin; el_it != el_end; ++el_it)
     {
         Elem* const elem = *el_it;
+        fe.reinit(elem);
         const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
+        fe.collectDataForInterpolation(elem);
         for (unsigned int d = 0; d < NDIM; ++d)
         {
             F_rhs_e[d].resize(static_cast<int>(F_dof_indices[d].size()));
         }
-        fe.reinit(elem);
-        fe.collectDataForInterpolation(elem);
         fe.interpolate(elem);
         const unsigned int n_qp = qrule->n_points();
         const size_t n_basis = phi.size();
@@ -841,11 +1073,34 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
             }
         }
     }
+}
 
-    ierr = VecRestoreArray(F_rhs_vec_local, &F_rhs_local_soln);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecGhostRestoreLocalForm(F_rhs_vec.vec(), &F_rhs_vec_local);
-    IBTK_CHKERRQ(ierr);
+void
+FEMechanicsBase::evaluatePK1StressFunction(TensorValue<double>& PP,
+                                           const PK1StressFcnData& data,
+                                           const TensorValue<double>& FF,
+                                           const libMesh::Point& x,
+                                           const libMesh::Point& X,
+                                           Elem* const elem,
+                                           const std::vector<const std::vector<double>*>& var_data,
+                                           const std::vector<const std::vector<VectorValue<double> >*>& grad_var_data,
+                                           const double data_time,
+                                           PK1StressBatchScratch& scratch)
+{
+    if (data.fcn)
+    {
+        data.fcn(PP, FF, x, X, elem, var_data, grad_var_data, data_time, data.ctx);
+    }
+    else
+    {
+        TBOX_ASSERT(data.batch_fcn);
+        // Copying into the existing scratch vectors reuses their storage.
+        scratch.var_data.resize(1);
+        scratch.grad_var_data.resize(1);
+        scratch.var_data[0] = var_data;
+        scratch.grad_var_data[0] = grad_var_data;
+        data.batch_fcn(&PP, &FF, &x, &X, 1, elem, scratch.var_data, scratch.grad_var_data, data_time, data.ctx);
+    }
 }
 
 void
@@ -1148,6 +1403,29 @@ FEMechanicsBase::getFromInput(const Pointer<Database>& db, bool /*is_from_restar
     // Force computation settings.
     if (db->isBool("use_consistent_mass_matrix"))
         d_use_consistent_mass_matrix = db->getBool("use_consistent_mass_matrix");
+    if (db->isBool("use_threaded_force_assembly"))
+        d_use_threaded_force_assembly = db->getBool("use_threaded_force_assembly");
+    if (db->keyExists("cache_max_size"))
+    {
+        const int cache_max_size = db->getInteger("cache_max_size");
+        if (cache_max_size < 0)
+        {
+            TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                     << "  cache_max_size must be nonnegative: got " << cache_max_size << "\n");
+        }
+        d_cache_max_size = static_cast<std::size_t>(cache_max_size);
+    }
+    if (db->isString("l2_projection_solver_type"))
+    {
+        const std::string solver_type = db->getString("l2_projection_solver_type");
+        d_L2_projection_solver_type = IBTK::string_to_enum<L2ProjectionSolverType>(solver_type);
+        if (d_L2_projection_solver_type == IBTK::UNKNOWN_L2_PROJECTION_SOLVER_TYPE)
+        {
+            TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                     << "  unknown l2_projection_solver_type " << solver_type << "\n"
+                                     << "  valid choices are KRYLOV, CHOLESKY, and CHEBYSHEV.\n");
+        }
+    }
 
     // Restart settings.
     if (db->isString("libmesh_restart_file_extension"))
@@ -1158,6 +1436,8 @@ FEMechanicsBase::getFromInput(const Pointer<Database>& db, bool /*is_from_restar
     {
         d_libmesh_restart_file_extension = "xdr";
     }
+    if (db->isBool("libmesh_restart_use_collective_io"))
+        d_libmesh_restart_use_collective_io = db->getBool("libmesh_restart_use_collective_io");
 
     // Other settings.
     if (db->keyExists("do_log"))
@@ -1187,6 +1467,7 @@ FEMechanicsBase::getFromRestart()
     }
     d_use_consistent_mass_matrix = db->getBool("d_use_consistent_mass_matrix");
     d_libmesh_partitioner_type = string_to_enum<LibmeshPartitionerType>(db->getString("d_libmesh_partitioner_type"));
+    d_libmesh_restart_read_collective_io = db->getBoolWithDefault("d_libmesh_restart_use_collective_io", false);
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
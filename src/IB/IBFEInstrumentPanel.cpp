@@ -569,6 +569,10 @@ IBFEInstrumentPanel::initializeHierarchyDependentData(IBFEMethod* ib_method_ops,
         }
     }
 
+    // the quadrature points only need to be reassigned to patches if the patch
+    // hierarchy has changed or if the meters have moved too far.
+    if (d_reuse_quad_point_mapping && quadPointMappingIsCurrent(hierarchy)) return;
+
     // reset the quad point maps
     d_quad_point_map.clear();
     d_quad_point_map.resize(finest_ln + 1);
@@ -688,6 +692,55 @@ IBFEInstrumentPanel::initializeHierarchyDependentData(IBFEMethod* ib_method_ops,
             }
         }
     }
+
+    // assign the quadrature points on each level to the local patches.
+    d_patch_quad_points.clear();
+    d_patch_quad_points.resize(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            d_patch_quad_points[ln].emplace_back();
+            PatchQuadPoints& patch_quad_points = d_patch_quad_points[ln].back();
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                const hier::Index<NDIM>& i = b();
+                std::pair<QuadPointMap::const_iterator, QuadPointMap::const_iterator> qp_range =
+                    d_quad_point_map[ln].equal_range(i);
+                patch_quad_points.insert(patch_quad_points.end(), qp_range.first, qp_range.second);
+            }
+        }
+    }
+
+    // store the configuration for which the assignment was computed.
+    d_mapped_level_boxes.resize(finest_ln + 1);
+    d_mapped_patch_boxes.resize(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        d_mapped_level_boxes[ln] = level->getBoxes();
+        d_mapped_patch_boxes[ln].clear();
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            d_mapped_patch_boxes[ln].push_back(level->getPatch(p())->getBox());
+        }
+    }
+    d_mapped_quad_order = d_quad_order;
+    d_mapped_meter_displacements.resize(d_num_meters);
+    for (unsigned int jj = 0; jj < d_num_meters; ++jj)
+    {
+        const LinearImplicitSystem& displacement_sys =
+            d_meter_systems[jj]->get_system<LinearImplicitSystem>(IBFEMethod::COORD_MAPPING_SYSTEM_NAME);
+        const NumericVector<double>& displacement_coords = displacement_sys.get_vector("serial solution");
+        d_mapped_meter_displacements[jj].resize(displacement_coords.size());
+        for (numeric_index_type k = 0; k < displacement_coords.size(); ++k)
+        {
+            d_mapped_meter_displacements[jj][k] = displacement_coords(k);
+        }
+    }
 }
 
 void
@@ -701,15 +754,23 @@ IBFEInstrumentPanel::readInstrumentData(const int U_data_idx,
     const int coarsest_ln = 0;
     const int finest_ln = hierarchy->getFinestLevelNumber();
 
-    // Reset the instrument values.
-    std::fill(d_flow_values.begin(), d_flow_values.end(), 0.0);
-    std::fill(d_mean_pressure_values.begin(), d_mean_pressure_values.end(), 0.0);
-    std::vector<double> A(d_num_meters, 0.0);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_patch_quad_points.size() == static_cast<std::size_t>(finest_ln + 1));
+#endif
 
-    // local counters for checking whether we have consistent
-    // values for the number of quadrature points.
+    // Accumulate the flow, the mean pressure, the meter areas, and the flow
+    // corrections for all meters (along with the number of quadrature points
+    // used) in a single buffer so that they can be summed in one reduction.
+    std::vector<double> meter_data(4 * d_num_meters + 1, 0.0);
+    double* const flow_values = &meter_data[0];
+    double* const mean_pressure_values = &meter_data[d_num_meters];
+    double* const A = &meter_data[2 * d_num_meters];
+    double* const flux_corrections = &meter_data[3 * d_num_meters];
+    double& count_qp_2 = meter_data[4 * d_num_meters];
+
+    // local counter for checking whether we have consistent values for the
+    // number of quadrature points.
     int count_qp_1 = 0;
-    int count_qp_2 = 0;
 
     // compute flow and mean pressure on mesh meters
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
@@ -717,8 +778,12 @@ IBFEInstrumentPanel::readInstrumentData(const int U_data_idx,
         count_qp_1 += d_quad_point_map[ln].size();
 
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        int local_patch_num = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
         {
+            const PatchQuadPoints& patch_quad_points = d_patch_quad_points[ln][local_patch_num];
+            if (patch_quad_points.empty()) continue;
+
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             const Box<NDIM>& patch_box = patch->getBox();
             const hier::Index<NDIM>& patch_lower = patch_box.lower();
@@ -733,88 +798,43 @@ IBFEInstrumentPanel::readInstrumentData(const int U_data_idx,
             Pointer<SideData<NDIM, double> > U_sc_data = patch->getPatchData(U_data_idx);
             Pointer<CellData<NDIM, double> > P_cc_data = patch->getPatchData(P_data_idx);
 
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            for (const auto& patch_qp : patch_quad_points)
             {
-                const hier::Index<NDIM>& i = b();
-                std::pair<QuadPointMap::const_iterator, QuadPointMap::const_iterator> qp_range =
-                    d_quad_point_map[ln].equal_range(i);
-                if (qp_range.first != qp_range.second)
-                {
-                    const Vector X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                        x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
+                const hier::Index<NDIM>& i = patch_qp.first;
+                const int& meter_num = patch_qp.second.meter_num;
+                const double& JxW = patch_qp.second.JxW;
+                const Vector& X = patch_qp.second.qp_xyz_current;
+                const Vector& normal = patch_qp.second.normal;
+                const Vector X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
+                                    x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
 #if (NDIM == 3)
-                                            ,
-                                        x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
+                                        ,
+                                    x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
 #endif
-                    );
-                    if (U_cc_data)
-                    {
-                        for (auto it = qp_range.first; it != qp_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const double& JxW = it->second.JxW;
-                            const Vector& X = it->second.qp_xyz_current;
-                            const Vector& normal = it->second.normal;
-                            const Vector U = linear_interp<NDIM>(
-                                X, i, X_cell, *U_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += (U.dot(normal)) * JxW;
-                        }
-                    }
-                    if (U_sc_data)
-                    {
-                        for (auto it = qp_range.first; it != qp_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const double& JxW = it->second.JxW;
-                            const Vector& X = it->second.qp_xyz_current;
-                            const Vector& normal = it->second.normal;
-                            const Vector U =
-                                linear_interp(X, i, X_cell, *U_sc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += (U.dot(normal)) * JxW;
-                        }
-                    }
-                    if (P_cc_data)
-                    {
-                        for (auto it = qp_range.first; it != qp_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const double& JxW = it->second.JxW;
-                            const Vector& X = it->second.qp_xyz_current;
-                            double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_mean_pressure_values[meter_num] += P * JxW;
-                            A[meter_num] += JxW;
-                            count_qp_2 += 1;
-                        }
-                    }
+                );
+                if (U_cc_data)
+                {
+                    const Vector U =
+                        linear_interp<NDIM>(X, i, X_cell, *U_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    flow_values[meter_num] += (U.dot(normal)) * JxW;
+                }
+                if (U_sc_data)
+                {
+                    const Vector U =
+                        linear_interp(X, i, X_cell, *U_sc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    flow_values[meter_num] += (U.dot(normal)) * JxW;
+                }
+                if (P_cc_data)
+                {
+                    double P = linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    mean_pressure_values[meter_num] += P * JxW;
+                    A[meter_num] += JxW;
+                    count_qp_2 += 1.0;
                 }
             }
         }
     }
 
-    // check to make sure we don't double count quadrature points because
-    // of overlapping patches or something else.
-    const int count_qp_3 = SAMRAI_MPI::sumReduction(count_qp_2);
-    if (count_qp_1 != count_qp_3)
-    {
-        TBOX_WARNING("IBFEInstrumentPanel::readInstrumentData :"
-                     << " the total number of quadrature points in the meter meshes"
-                     << " is not consistent with the number used in the"
-                     << " calculations, for IBFE part " << d_part << "."
-                     << " there may be overlapping patches in the AMR grid.");
-    }
-
-    // Synchronize the values across all processes.
-    SAMRAI_MPI::sumReduction(&d_flow_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&d_mean_pressure_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&A[0], d_num_meters);
-
-    // Normalize the mean pressure.
-    for (unsigned int jj = 0; jj < d_num_meters; ++jj)
-    {
-        d_mean_pressure_values[jj] /= A[jj];
-    }
-
     // we need to compute the flow correction by calculating the contribution
     // from the velocity of each meter mesh.
     for (unsigned int jj = 0; jj < d_num_meters; ++jj)
@@ -878,12 +898,32 @@ IBFEInstrumentPanel::readInstrumentData(const int U_data_idx,
                 }
             }
         }
-
-        const double total_correction = SAMRAI_MPI::sumReduction(flux_correction);
-        d_flow_values[jj] -= total_correction;
+        flux_corrections[jj] = flux_correction;
 
     } // loop over meters
 
+    // Synchronize the values across all processes.
+    SAMRAI_MPI::sumReduction(&meter_data[0], static_cast<int>(meter_data.size()));
+
+    // check to make sure we don't double count quadrature points because
+    // of overlapping patches or something else.
+    const int count_qp_3 = static_cast<int>(count_qp_2);
+    if (count_qp_1 != count_qp_3)
+    {
+        TBOX_WARNING("IBFEInstrumentPanel::readInstrumentData :"
+                     << " the total number of quadrature points in the meter meshes"
+                     << " is not consistent with the number used in the"
+                     << " calculations, for IBFE part " << d_part << "."
+                     << " there may be overlapping patches in the AMR grid.");
+    }
+
+    // Normalize the mean pressure and apply the flow corrections.
+    for (unsigned int jj = 0; jj < d_num_meters; ++jj)
+    {
+        d_flow_values[jj] = flow_values[jj] - flux_corrections[jj];
+        d_mean_pressure_values[jj] = mean_pressure_values[jj] / A[jj];
+    }
+
     // write data
     outputData(data_time);
 }
@@ -900,6 +940,8 @@ IBFEInstrumentPanel::getFromInput(Pointer<Database> db)
     d_use_adaptive_quadrature = db->getBoolWithDefault("meters_adaptive_quadrature", false);
     d_quad_type = Utility::string_to_enum<QuadratureType>(db->getStringWithDefault("meters_quad_type", "QGAUSS"));
     d_input_quad_order = Utility::string_to_enum<Order>(db->getStringWithDefault("meters_quad_order", "FORTIETH"));
+    d_reuse_quad_point_mapping = db->getBoolWithDefault("meters_reuse_quad_point_mapping", true);
+    d_remap_tol = db->getDoubleWithDefault("meters_remap_tol", 0.0);
     if (d_use_adaptive_quadrature && d_quad_type != libMesh::QGRID)
     {
         TBOX_ERROR("IBFEInstrumentPanel::getFromInput :"
@@ -957,6 +999,18 @@ IBFEInstrumentPanel::getMeterMeshQuadOrder(const unsigned int jj) const
     return d_quad_order[jj];
 }
 
+const std::vector<double>&
+IBFEInstrumentPanel::getFlowValues() const
+{
+    return d_flow_values;
+}
+
+const std::vector<double>&
+IBFEInstrumentPanel::getMeanPressureValues() const
+{
+    return d_mean_pressure_values;
+}
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
@@ -1077,6 +1131,50 @@ IBFEInstrumentPanel::initializeSystemDependentData(IBFEMethod* ib_method_ops, co
     d_meter_radii[meter_mesh_number] = max_meter_radius;
 }
 
+bool
+IBFEInstrumentPanel::quadPointMappingIsCurrent(const Pointer<PatchHierarchy<NDIM> > hierarchy) const
+{
+    // check the patch hierarchy.
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    if (d_mapped_level_boxes.size() != static_cast<std::size_t>(finest_ln + 1)) return false;
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        const BoxArray<NDIM>& level_boxes = level->getBoxes();
+        if (level_boxes.getNumberOfBoxes() != d_mapped_level_boxes[ln].getNumberOfBoxes()) return false;
+        for (int k = 0; k < level_boxes.getNumberOfBoxes(); ++k)
+        {
+            if (!(level_boxes[k] == d_mapped_level_boxes[ln][k])) return false;
+        }
+        std::size_t local_patch_num = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+        {
+            if (local_patch_num >= d_mapped_patch_boxes[ln].size()) return false;
+            if (!(level->getPatch(p())->getBox() == d_mapped_patch_boxes[ln][local_patch_num])) return false;
+        }
+        if (local_patch_num != d_mapped_patch_boxes[ln].size()) return false;
+    }
+
+    // check the quadrature rules.
+    if (d_mapped_quad_order != d_quad_order) return false;
+
+    // check the displacements of the meter meshes. these are serial vectors,
+    // so the check gives the same result on every process.
+    if (d_mapped_meter_displacements.size() != d_num_meters) return false;
+    for (unsigned int jj = 0; jj < d_num_meters; ++jj)
+    {
+        const LinearImplicitSystem& displacement_sys =
+            d_meter_systems[jj]->get_system<LinearImplicitSystem>(IBFEMethod::COORD_MAPPING_SYSTEM_NAME);
+        const NumericVector<double>& displacement_coords = displacement_sys.get_vector("serial solution");
+        if (d_mapped_meter_displacements[jj].size() != displacement_coords.size()) return false;
+        for (numeric_index_type k = 0; k < displacement_coords.size(); ++k)
+        {
+            if (std::abs(displacement_coords(k) - d_mapped_meter_displacements[jj][k]) > d_remap_tol) return false;
+        }
+    }
+    return true;
+}
+
 double
 IBFEInstrumentPanel::getMeterRadius(const int meter_mesh_number)
 {
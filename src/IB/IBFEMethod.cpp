@@ -42,6 +42,7 @@
 #include "BasePatchLevel.h"
 #include "BergerRigoutsos.h"
 #include "Box.h"
+#include "BoxArray.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellIndex.h"
@@ -78,6 +79,8 @@
 #include "tbox/Pointer.h"
 #include "tbox/RestartManager.h"
 #include "tbox/SAMRAI_MPI.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
 #include "libmesh/boundary_info.h"
@@ -112,9 +115,11 @@
 #include "libmesh/quadrature.h"
 #include "libmesh/quadrature_gauss.h"
 #include "libmesh/sparse_matrix.h"
+#include "libmesh/stored_range.h"
 #include "libmesh/string_to_enum.h"
 #include "libmesh/system.h"
 #include "libmesh/tensor_value.h"
+#include "libmesh/threads.h"
 #include "libmesh/type_tensor.h"
 #include "libmesh/type_vector.h"
 #include "libmesh/variant_filter_iterator.h"
@@ -131,9 +136,11 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <functional>
 #include <iomanip>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <string>
 #include <tuple>
@@ -164,6 +171,12 @@ namespace
 // Version of IBFEMethod restart file data.
 const int IBFE_METHOD_VERSION = 4;
 
+// Timers. These are always active since they are also used to calibrate the
+// workload weights.
+static Timer* t_interpolate_velocity;
+static Timer* t_spread_force;
+static Timer* t_time_step;
+
 inline boundary_id_type
 get_dirichlet_bdry_ids(const std::vector<boundary_id_type>& bdry_ids)
 {
@@ -343,6 +356,27 @@ build_ib_ghosted_system_data(std::vector<SystemData>& ghosted_system_data,
     return;
 }
 
+using PartRange = StoredRange<std::vector<unsigned int>::const_iterator, unsigned int>;
+
+/*
+ * Body for libMesh::Threads::parallel_for() which applies a function to each
+ * part in a range.
+ */
+class PartLoopBody
+{
+public:
+    PartLoopBody(std::function<void(unsigned int)> fcn) : d_fcn(std::move(fcn))
+    {
+    }
+
+    void operator()(const PartRange& range) const
+    {
+        for (const unsigned int part : range) d_fcn(part);
+    }
+
+private:
+    std::function<void(unsigned int)> d_fcn;
+};
 } // namespace
 
 const std::string IBFEMethod::SOURCE_SYSTEM_NAME = "IB source system";
@@ -388,6 +422,20 @@ IBFEMethod::getFEDataManager(const unsigned int part) const
     return d_primary_fe_data_managers[part];
 } // getFEDataManager
 
+unsigned int
+IBFEMethod::getNumJumpConditionImpositions(const unsigned int part) const
+{
+    TBOX_ASSERT(part < d_meshes.size());
+    return d_num_jump_condition_impositions[part];
+} // getNumJumpConditionImpositions
+
+unsigned int
+IBFEMethod::getNumJumpConditionIntersectionSearches(const unsigned int part) const
+{
+    TBOX_ASSERT(part < d_meshes.size());
+    return d_num_jump_condition_intersection_searches[part];
+} // getNumJumpConditionIntersectionSearches
+
 void
 IBFEMethod::registerStressNormalizationPart(unsigned int part)
 {
@@ -510,6 +558,15 @@ IBFEMethod::preprocessIntegrateData(double current_time, double new_time, int nu
     FEMechanicsBase::preprocessIntegrateData(current_time, new_time, num_cycles);
 
     d_started_time_integration = true;
+    if (d_workload_calibration_step_num < d_workload_calibration_steps)
+    {
+        // Subtract the accumulated times now and add them back at the end of
+        // the time step, which leaves the times spent in this time step.
+        d_workload_interaction_time -=
+            t_interpolate_velocity->getTotalWallclockTime() + t_spread_force->getTotalWallclockTime();
+        d_workload_step_time -= t_time_step->getTotalWallclockTime();
+    }
+    IBAMR_TIMER_START(t_time_step);
 
     // Update direct forcing data.
     for (unsigned int part = 0; part < d_meshes.size(); ++part)
@@ -568,6 +625,16 @@ IBFEMethod::postprocessIntegrateData(double current_time, double new_time, int n
     }
 
     FEMechanicsBase::postprocessIntegrateData(current_time, new_time, num_cycles);
+
+    IBAMR_TIMER_STOP(t_time_step);
+    if (d_workload_calibration_step_num < d_workload_calibration_steps)
+    {
+        d_workload_interaction_time +=
+            t_interpolate_velocity->getTotalWallclockTime() + t_spread_force->getTotalWallclockTime();
+        d_workload_step_time += t_time_step->getTotalWallclockTime();
+        ++d_workload_calibration_step_num;
+        if (d_workload_calibration_step_num == d_workload_calibration_steps) calibrateWorkloadSpecs();
+    }
     return;
 } // postprocessIntegrateData
 
@@ -577,6 +644,7 @@ IBFEMethod::interpolateVelocity(const int u_data_idx,
                                 const std::vector<Pointer<RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
                                 const double data_time)
 {
+    IBAMR_TIMER_START(t_interpolate_velocity);
     const std::string data_time_str = get_data_time_str(data_time, d_current_time, d_new_time);
 
     if (d_use_scratch_hierarchy)
@@ -656,6 +724,7 @@ IBFEMethod::interpolateVelocity(const int u_data_idx,
             U_vecs[part]->zero();
         }
     }
+    IBAMR_TIMER_STOP(t_interpolate_velocity);
     return;
 } // interpolateVelocity
 
@@ -784,6 +853,8 @@ IBFEMethod::computeLagrangianForce(const double data_time)
     batch_vec_ghost_update(d_X_vecs->get(data_time_str), INSERT_VALUES, SCATTER_FORWARD);
     d_F_vecs->zero("RHS Vector");
     d_F_vecs->zero("tmp");
+    // Computing the stress normalization requires a projection (i.e., a
+    // parallel solve) so it must be done before assembly on all parts.
     for (unsigned part = 0; part < d_meshes.size(); ++part)
     {
         if (d_stress_normalization_part[part])
@@ -791,11 +862,32 @@ IBFEMethod::computeLagrangianForce(const double data_time)
             computeStressNormalization(
                 d_P_vecs->get(data_time_str, part), d_X_vecs->get(data_time_str, part), data_time, part);
         }
-        assembleInteriorForceDensityRHS(d_F_vecs->get("RHS Vector", part),
-                                        d_X_vecs->get(data_time_str, part),
-                                        d_P_vecs ? &d_P_vecs->get(data_time_str, part) : nullptr,
-                                        data_time,
-                                        part);
+    }
+    // Assembly involves no communication so independent parts may be
+    // processed concurrently. Look up all vectors in advance since doing so
+    // may modify the underlying systems.
+    const std::vector<PetscVector<double>*> F_rhs_vecs = d_F_vecs->get("RHS Vector");
+    const std::vector<PetscVector<double>*> X_vecs = d_X_vecs->get(data_time_str);
+    const std::vector<PetscVector<double>*> P_vecs =
+        d_P_vecs ? d_P_vecs->get(data_time_str) : std::vector<PetscVector<double>*>(d_meshes.size(), nullptr);
+    if (d_process_parts_concurrently && libMesh::n_threads() > 1 && d_meshes.size() > 1)
+    {
+        // Each part is already assembled on its own thread, so the element
+        // loops within a part are not split any further.
+        const auto assemble_part = [&](const unsigned int part) {
+            assembleInteriorForceDensityRHS(
+                *F_rhs_vecs[part], *X_vecs[part], P_vecs[part], data_time, part, /*allow_threads*/ false);
+        };
+        std::vector<unsigned int> parts(d_meshes.size());
+        std::iota(parts.begin(), parts.end(), 0u);
+        Threads::parallel_for(PartRange(parts.begin(), parts.end(), /*grainsize*/ 1), PartLoopBody(assemble_part));
+    }
+    else
+    {
+        for (unsigned part = 0; part < d_meshes.size(); ++part)
+        {
+            assembleInteriorForceDensityRHS(*F_rhs_vecs[part], *X_vecs[part], P_vecs[part], data_time, part);
+        }
     }
     batch_vec_ghost_update(d_F_vecs->get("RHS Vector"), ADD_VALUES, SCATTER_REVERSE);
     // RHS vectors don't need ghost entries for the solve so we can skip the other scatter
@@ -830,6 +922,7 @@ IBFEMethod::spreadForce(const int f_data_idx,
                         const std::vector<Pointer<RefineSchedule<NDIM> > >& /*f_prolongation_scheds*/,
                         const double data_time)
 {
+    IBAMR_TIMER_START(t_spread_force);
     const std::string data_time_str = get_data_time_str(data_time, d_current_time, d_new_time);
 
     // Communicate ghost data.
@@ -929,6 +1022,7 @@ IBFEMethod::spreadForce(const int f_data_idx,
         // just need to add its values to those in f_data_idx
         f_active_data_ops->add(f_data_idx, f_data_idx, f_scratch_data_idx);
     }
+    IBAMR_TIMER_STOP(t_spread_force);
     return;
 } // spreadForce
 
@@ -1539,6 +1633,10 @@ IBFEMethod::putToDatabase(Pointer<Database> db)
     std::copy(d_part_is_active.begin(), d_part_is_active.end(), part_is_active_arr.get());
     db->putInteger("part_is_active_arr_size", d_part_is_active.size());
     db->putBoolArray("part_is_active_arr", part_is_active_arr.get(), d_part_is_active.size());
+    db->putInteger("d_workload_calibration_step_num", d_workload_calibration_step_num);
+    db->putDouble("d_workload_interaction_time", d_workload_interaction_time);
+    db->putDouble("d_workload_step_time", d_workload_step_time);
+    db->putDouble("d_workload_calibration_scale", d_workload_calibration_scale);
     return;
 } // putToDatabase
 
@@ -1569,10 +1667,16 @@ IBFEMethod::doInitializeFEEquationSystems()
     {
         // Create FE data managers.
         const std::string manager_name = "IBFEMethod FEDataManager::" + std::to_string(part);
+        FEDataManager::WorkloadSpec workload_spec = d_workload_spec[part];
+        if (d_use_jump_conditions && d_split_normal_force && !d_stress_normalization_part[part])
+        {
+            workload_spec.q_point_weight += d_workload_jump_condition_q_point_weight;
+        }
+        workload_spec.q_point_weight *= d_workload_calibration_scale;
         d_primary_fe_data_managers[part] = FEDataManager::getManager(manager_name,
                                                                      d_interp_spec[part],
                                                                      d_spread_spec[part],
-                                                                     d_workload_spec[part],
+                                                                     workload_spec,
                                                                      min_ghost_width,
                                                                      d_primary_eulerian_data_cache);
         if (d_use_scratch_hierarchy)
@@ -1582,7 +1686,7 @@ IBFEMethod::doInitializeFEEquationSystems()
                                                                          manager_name + "::scratch",
                                                                          d_interp_spec[part],
                                                                          d_spread_spec[part],
-                                                                         d_workload_spec[part],
+                                                                         workload_spec,
                                                                          min_ghost_width,
                                                                          d_scratch_eulerian_data_cache);
             d_active_fe_data_managers[part] = d_scratch_fe_data_managers[part];
@@ -1594,7 +1698,14 @@ IBFEMethod::doInitializeFEEquationSystems()
         }
         d_fe_data[part] = d_primary_fe_data_managers[part]->getFEData();
 
+        // The scratch FEDataManager shares the FEData object, and hence the
+        // cache size, of the primary one.
+        d_primary_fe_data_managers[part]->setCacheMaxSize(d_cache_max_size);
+
         d_active_fe_data_managers[part]->setLoggingEnabled(d_do_log);
+        d_primary_fe_data_managers[part]->setL2ProjectionSolverType(d_L2_projection_solver_type);
+        if (d_use_scratch_hierarchy)
+            d_scratch_fe_data_managers[part]->setL2ProjectionSolverType(d_L2_projection_solver_type);
         d_ghosts = IntVector<NDIM>::max(d_ghosts, d_active_fe_data_managers[part]->getGhostCellWidth());
 
         // Create FE equation systems objects and corresponding variables.
@@ -1611,13 +1722,22 @@ IBFEMethod::doInitializeFEEquationSystems()
         {
             const std::string& file_name = libmesh_restart_file_name(
                 d_libmesh_restart_read_dir, d_libmesh_restart_restore_number, part, d_libmesh_restart_file_extension);
-            const XdrMODE xdr_mode = (d_libmesh_restart_file_extension == "xdr" ? DECODE : READ);
-            const int read_mode =
-                EquationSystems::READ_HEADER | EquationSystems::READ_DATA | EquationSystems::READ_ADDITIONAL_DATA;
-            equation_systems.read(file_name,
-                                  xdr_mode,
-                                  read_mode,
-                                  /*partition_agnostic*/ true);
+            const XdrMODE xdr_mode = get_xdr_mode(d_libmesh_restart_file_extension, /*write*/ false);
+            if (d_libmesh_restart_read_collective_io)
+            {
+                // Recreate the systems and their vectors from the header and
+                // then read the vectors, which do not depend on the current
+                // partitioning of the mesh.
+                equation_systems.read(
+                    file_name, xdr_mode, EquationSystems::READ_HEADER | EquationSystems::READ_ADDITIONAL_DATA);
+                read_equation_systems_data(equation_systems, file_name + ".data");
+            }
+            else
+            {
+                const int read_mode =
+                    EquationSystems::READ_HEADER | EquationSystems::READ_DATA | EquationSystems::READ_ADDITIONAL_DATA;
+                equation_systems.read(file_name, xdr_mode, read_mode, /*partition_agnostic*/ true);
+            }
         }
         else
         {
@@ -1857,6 +1977,7 @@ IBFEMethod::computeStressNormalization(PetscVector<double>& Phi_vec,
 
     std::vector<std::vector<const std::vector<double>*> > PK1_var_data(num_PK1_fcns);
     std::vector<std::vector<const std::vector<VectorValue<double> >*> > PK1_grad_var_data(num_PK1_fcns);
+    std::vector<PK1StressBatchScratch> PK1_batch_scratch(num_PK1_fcns);
     std::vector<const std::vector<double>*> surface_force_var_data, surface_pressure_var_data;
     std::vector<const std::vector<VectorValue<double> >*> surface_force_grad_var_data, surface_pressure_grad_var_data;
 
@@ -1922,22 +2043,23 @@ IBFEMethod::computeStressNormalization(PetscVector<double>& Phi_vec,
                 double Phi = 0.0;
                 for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                 {
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
+                    if (d_PK1_stress_fcn_data[part][k].fcn || d_PK1_stress_fcn_data[part][k].batch_fcn)
                     {
                         // Compute the value of the first Piola-Kirchhoff stress
                         // tensor at the quadrature point and add the corresponding
                         // traction force to the right-hand-side vector.
                         fe.setInterpolatedDataPointers(
                             PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                        d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                           FF,
-                                                           x,
-                                                           X,
-                                                           elem,
-                                                           PK1_var_data[k],
-                                                           PK1_grad_var_data[k],
-                                                           data_time,
-                                                           d_PK1_stress_fcn_data[part][k].ctx);
+                        evaluatePK1StressFunction(PP,
+                                                  d_PK1_stress_fcn_data[part][k],
+                                                  FF,
+                                                  x,
+                                                  X,
+                                                  elem,
+                                                  PK1_var_data[k],
+                                                  PK1_grad_var_data[k],
+                                                  data_time,
+                                                  PK1_batch_scratch[k]);
                         Phi += n * ((PP * FF_trans) * n) / J;
                     }
                 }
@@ -2111,6 +2233,7 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
 
     std::vector<std::vector<const std::vector<double>*> > PK1_var_data(num_PK1_fcns);
     std::vector<std::vector<const std::vector<VectorValue<double> >*> > PK1_grad_var_data(num_PK1_fcns);
+    std::vector<PK1StressBatchScratch> PK1_batch_scratch(num_PK1_fcns);
     std::vector<const std::vector<double>*> surface_force_var_data, surface_pressure_var_data;
     std::vector<const std::vector<VectorValue<double> >*> surface_force_grad_var_data, surface_pressure_grad_var_data;
 
@@ -2201,22 +2324,23 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (d_PK1_stress_fcn_data[part][k].fcn || d_PK1_stress_fcn_data[part][k].batch_fcn)
                         {
                             // Compute the value of the first Piola-Kirchhoff stress
                             // tensor at the quadrature point and compute the
                             // corresponding force.
                             fe.setInterpolatedDataPointers(
                                 PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               x,
-                                                               X,
-                                                               elem,
-                                                               PK1_var_data[k],
-                                                               PK1_grad_var_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            evaluatePK1StressFunction(PP,
+                                                      d_PK1_stress_fcn_data[part][k],
+                                                      FF,
+                                                      x,
+                                                      X,
+                                                      elem,
+                                                      PK1_var_data[k],
+                                                      PK1_grad_var_data[k],
+                                                      data_time,
+                                                      PK1_batch_scratch[k]);
                             F -= PP * normal_face[qp] * JxW_face[qp];
                         }
                     }
@@ -2390,6 +2514,7 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
 
     std::vector<std::vector<const std::vector<double>*> > PK1_var_data(num_PK1_fcns);
     std::vector<std::vector<const std::vector<VectorValue<double> >*> > PK1_grad_var_data(num_PK1_fcns);
+    std::vector<PK1StressBatchScratch> PK1_batch_scratch(num_PK1_fcns);
     std::vector<const std::vector<double>*> surface_force_var_data, surface_pressure_var_data;
     std::vector<const std::vector<VectorValue<double> >*> surface_force_grad_var_data, surface_pressure_grad_var_data;
 
@@ -2404,12 +2529,38 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
     std::vector<libMesh::Point> X_node_cache, x_node_cache;
     IBTK::Point x_min, x_max;
     std::vector<std::vector<unsigned int> > side_dof_indices(NDIM);
-    std::vector<libMesh::Point> intersection_ref_coords;
-    std::vector<SideIndex<NDIM> > intersection_indices;
+    std::vector<libMesh::Point> side_ref_coords;
+    std::vector<SideIndex<NDIM> > side_indices;
     std::vector<std::pair<double, libMesh::Point> > intersections;
+    std::vector<JumpConditionSideIntersections> patch_side_intersections;
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
     const IntVector<NDIM>& ratio = level->getRatio();
     const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
+
+    // Determine whether or not previously computed intersections can be
+    // reused.
+    const bool cache_intersections = d_jump_condition_intersection_cache_tol >= 0.0;
+    bool reuse_intersections = false;
+    if (cache_intersections)
+    {
+        std::unique_ptr<PetscVector<double> >& X_ref_vec = d_jump_condition_intersection_X_vecs[part];
+        reuse_intersections =
+            max_norm_difference(X_ghost_vec, X_ref_vec.get()) <= d_jump_condition_intersection_cache_tol;
+        if (!reuse_intersections)
+        {
+            X_ref_vec.reset(static_cast<PetscVector<double>*>(X_ghost_vec.clone().release()));
+            d_jump_condition_intersections[part].clear();
+        }
+        d_jump_condition_intersections[part].resize(active_patch_element_map.size());
+    }
+    ++d_num_jump_condition_impositions[part];
+    if (!reuse_intersections) ++d_num_jump_condition_intersection_searches[part];
+    if (d_do_log && cache_intersections)
+    {
+        plog << d_object_name << "::imposeJumpConditions(): " << (reuse_intersections ? "reusing" : "recomputing")
+             << " grid line intersections for part " << part << "\n";
+    }
+
     int local_patch_num = 0;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
     {
@@ -2426,8 +2577,22 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
         const double* const x_lower = patch_geom->getXLower();
         const double* const dx = patch_geom->getDx();
 
-        SideData<NDIM, int> num_intersections(patch_box, 1, IntVector<NDIM>(0));
-        num_intersections.fillAll(0);
+        // If possible, reuse the intersections found in a previous call.
+        PatchJumpConditionIntersections* const patch_intersections =
+            cache_intersections ? &d_jump_condition_intersections[part][local_patch_num] : nullptr;
+        const bool reuse_patch_intersections = patch_intersections && reuse_intersections &&
+                                               patch_intersections->patch_box == patch_box &&
+                                               patch_intersections->patch_elems == patch_elems;
+        if (patch_intersections && !reuse_patch_intersections)
+        {
+            patch_intersections->patch_box = patch_box;
+            patch_intersections->patch_elems = patch_elems;
+            patch_intersections->side_intersections.clear();
+        }
+        patch_side_intersections.clear();
+        std::vector<JumpConditionSideIntersections>& side_intersections =
+            patch_intersections ? patch_intersections->side_intersections : patch_side_intersections;
+        size_t cached_idx = 0;
 
         // Loop over the elements.
         for (size_t e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
@@ -2436,103 +2601,130 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
             const bool touches_physical_bdry = has_physical_bdry(elem, boundary_info, G_dof_map);
             if (!touches_physical_bdry) continue;
 
-            fe.reinit(elem);
-            fe.collectDataForInterpolation(elem);
-
-            // Loop over the element boundaries.
-            for (unsigned int side = 0; side < elem->n_sides(); ++side)
+            // Determine the intersections of the physical boundaries of the
+            // element with the background fluid grid.
+            const size_t elem_begin = reuse_patch_intersections ? cached_idx : side_intersections.size();
+            if (reuse_patch_intersections)
             {
-                // Skip non-physical boundaries.
-                if (!is_physical_bdry(elem, side, boundary_info, G_dof_map)) continue;
-
-                // Skip Dirichlet boundaries.
-                if (is_dirichlet_bdry(elem, side, boundary_info, G_dof_map)) continue;
-
-                // Construct a side element.
-                std::unique_ptr<Elem> side_elem = elem->build_side_ptr(side, /*proxy*/ false);
-                const unsigned int n_node_side = side_elem->n_nodes();
-                for (int d = 0; d < NDIM; ++d)
+                while (cached_idx < side_intersections.size() && side_intersections[cached_idx].elem == elem)
                 {
-                    X_dof_map.dof_indices(side_elem.get(), side_dof_indices[d], d);
+                    ++cached_idx;
                 }
-
-                // Cache the nodal and physical coordinates of the side element,
-                // determine the bounding box of the current configuration of
-                // the side element, and set the nodal coordinates to correspond
-                // to the physical coordinates.
-                X_node_cache.resize(n_node_side);
-                x_node_cache.resize(n_node_side);
-                x_min = IBTK::Point::Constant(std::numeric_limits<double>::max());
-                x_max = IBTK::Point::Constant(-std::numeric_limits<double>::max());
-                for (unsigned int k = 0; k < n_node_side; ++k)
+            }
+            else
+            {
+                // Loop over the element boundaries.
+                for (unsigned int side = 0; side < elem->n_sides(); ++side)
                 {
-                    X_node_cache[k] = side_elem->point(k);
-                    libMesh::Point& x = x_node_cache[k];
-                    for (unsigned int d = 0; d < NDIM; ++d)
+                    // Skip non-physical boundaries.
+                    if (!is_physical_bdry(elem, side, boundary_info, G_dof_map)) continue;
+
+                    // Skip Dirichlet boundaries.
+                    if (is_dirichlet_bdry(elem, side, boundary_info, G_dof_map)) continue;
+
+                    // Construct a side element.
+                    std::unique_ptr<Elem> side_elem = elem->build_side_ptr(side, /*proxy*/ false);
+                    const unsigned int n_node_side = side_elem->n_nodes();
+                    for (int d = 0; d < NDIM; ++d)
                     {
-                        x(d) = X_ghost_vec(side_dof_indices[d][k]);
-                        x_min[d] = std::min(x_min[d], x(d));
-                        x_max[d] = std::max(x_max[d], x(d));
+                        X_dof_map.dof_indices(side_elem.get(), side_dof_indices[d], d);
                     }
-                    side_elem->point(k) = x;
-                }
-                Box<NDIM> box(IndexUtilities::getCellIndex(&x_min[0], grid_geom, ratio),
-                              IndexUtilities::getCellIndex(&x_max[0], grid_geom, ratio));
-                box.grow(IntVector<NDIM>(1));
-                box = box * patch_box;
-
-                // Loop over coordinate directions and look for intersections
-                // with the background fluid grid.
-                intersection_ref_coords.clear();
-                intersection_indices.clear();
-                for (unsigned int axis = 0; axis < NDIM; ++axis)
-                {
-                    // Setup a unit vector pointing in the coordinate direction
-                    // of interest.
-                    VectorValue<double> q;
-                    q(axis) = 1.0;
-
-                    // Loop over the relevant range of indices.
-                    Box<NDIM> axis_box = box;
-                    axis_box.lower(axis) = 0;
-                    axis_box.upper(axis) = 0;
-                    for (BoxIterator<NDIM> b(axis_box); b; b++)
+
+                    // Cache the nodal and physical coordinates of the side
+                    // element, determine the bounding box of the current
+                    // configuration of the side element, and set the nodal
+                    // coordinates to correspond to the physical coordinates.
+                    X_node_cache.resize(n_node_side);
+                    x_node_cache.resize(n_node_side);
+                    x_min = IBTK::Point::Constant(std::numeric_limits<double>::max());
+                    x_max = IBTK::Point::Constant(-std::numeric_limits<double>::max());
+                    for (unsigned int k = 0; k < n_node_side; ++k)
                     {
-                        const hier::Index<NDIM>& i_c = b();
-                        libMesh::Point r;
+                        X_node_cache[k] = side_elem->point(k);
+                        libMesh::Point& x = x_node_cache[k];
                         for (unsigned int d = 0; d < NDIM; ++d)
                         {
-                            r(d) =
-                                (d == axis ? 0.0 :
-                                             x_lower[d] + dx[d] * (static_cast<double>(i_c(d) - patch_lower[d]) + 0.5));
+                            x(d) = X_ghost_vec(side_dof_indices[d][k]);
+                            x_min[d] = std::min(x_min[d], x(d));
+                            x_max[d] = std::max(x_max[d], x(d));
                         }
+                        side_elem->point(k) = x;
+                    }
+                    Box<NDIM> box(IndexUtilities::getCellIndex(&x_min[0], grid_geom, ratio),
+                                  IndexUtilities::getCellIndex(&x_max[0], grid_geom, ratio));
+                    box.grow(IntVector<NDIM>(1));
+                    box = box * patch_box;
+
+                    // Loop over coordinate directions and look for
+                    // intersections with the background fluid grid.
+                    side_ref_coords.clear();
+                    side_indices.clear();
+                    for (unsigned int axis = 0; axis < NDIM; ++axis)
+                    {
+                        // Setup a unit vector pointing in the coordinate
+                        // direction of interest.
+                        VectorValue<double> q;
+                        q(axis) = 1.0;
+
+                        // Loop over the relevant range of indices.
+                        Box<NDIM> axis_box = box;
+                        axis_box.lower(axis) = 0;
+                        axis_box.upper(axis) = 0;
+                        for (BoxIterator<NDIM> b(axis_box); b; b++)
+                        {
+                            const hier::Index<NDIM>& i_c = b();
+                            libMesh::Point r;
+                            for (unsigned int d = 0; d < NDIM; ++d)
+                            {
+                                if (d == axis) continue;
+                                r(d) = x_lower[d] + dx[d] * (static_cast<double>(i_c(d) - patch_lower[d]) + 0.5);
+                            }
 #if (NDIM == 2)
-                        intersect_line_with_edge(intersections, static_cast<Edge*>(side_elem.get()), r, q);
+                            intersect_line_with_edge(intersections, static_cast<Edge*>(side_elem.get()), r, q);
 #endif
 #if (NDIM == 3)
-                        intersect_line_with_face(intersections, static_cast<Face*>(side_elem.get()), r, q);
+                            intersect_line_with_face(intersections, static_cast<Face*>(side_elem.get()), r, q);
 #endif
-                        for (const auto& intersection : intersections)
-                        {
-                            const libMesh::Point x = r + intersection.first * q;
-                            SideIndex<NDIM> i_s(i_c, axis, 0);
-                            i_s(axis) = std::floor((x(axis) - x_lower[axis]) / dx[axis] + 0.5) + patch_lower[axis];
-                            intersection_ref_coords.push_back(intersection.second);
-                            intersection_indices.push_back(i_s);
-                            num_intersections(i_s) += 1;
+                            for (const auto& intersection : intersections)
+                            {
+                                const libMesh::Point x = r + intersection.first * q;
+                                SideIndex<NDIM> i_s(i_c, axis, 0);
+                                i_s(axis) =
+                                    std::floor((x(axis) - x_lower[axis]) / dx[axis] + 0.5) + patch_lower[axis];
+                                side_ref_coords.push_back(intersection.second);
+                                side_indices.push_back(i_s);
+                            }
                         }
                     }
-                }
 
-                // Restore the element coordinates.
-                for (unsigned int k = 0; k < n_node_side; ++k)
-                {
-                    side_elem->point(k) = X_node_cache[k];
+                    // Restore the element coordinates.
+                    for (unsigned int k = 0; k < n_node_side; ++k)
+                    {
+                        side_elem->point(k) = X_node_cache[k];
+                    }
+
+                    // Keep track of the sides that intersect the grid.
+                    if (!side_ref_coords.empty())
+                    {
+                        side_intersections.push_back({ elem, side, side_ref_coords, side_indices });
+                    }
                 }
+            }
+            const size_t elem_end = reuse_patch_intersections ? cached_idx : side_intersections.size();
+
+            // If there are no intersection points, then continue to the next
+            // element.
+            if (elem_begin == elem_end) continue;
+
+            fe.reinit(elem);
+            fe.collectDataForInterpolation(elem);
 
-                // If there are no intersection points, then continue to the
-                // next side.
-                if (intersection_ref_coords.empty()) continue;
+            // Loop over the element boundaries that intersect the grid.
+            for (size_t side_idx = elem_begin; side_idx < elem_end; ++side_idx)
+            {
+                const unsigned int side = side_intersections[side_idx].side;
+                const std::vector<libMesh::Point>& intersection_ref_coords = side_intersections[side_idx].ref_coords;
+                const std::vector<SideIndex<NDIM> >& intersection_indices = side_intersections[side_idx].indices;
 
                 // Evaluate the jump conditions and apply them to the Eulerian
                 // grid.
@@ -2558,7 +2750,9 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
                     const std::vector<double>& G_data = fe_interp_var_data[qp][G_sys_idx];
                     std::copy(G_data.begin(), G_data.end(), &G(0));
 #if !defined(NDEBUG)
-                    for (unsigned int d = 0; d < NDIM; ++d)
+                    // Cached intersections are only accurate up to the cache
+                    // tolerance.
+                    for (unsigned int d = 0; !reuse_patch_intersections && d < NDIM; ++d)
                     {
                         if (d == axis)
                         {
@@ -2586,22 +2780,23 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (d_PK1_stress_fcn_data[part][k].fcn || d_PK1_stress_fcn_data[part][k].batch_fcn)
                         {
                             // Compute the value of the first Piola-Kirchhoff
                             // stress tensor at the quadrature point and compute
                             // the corresponding force.
                             fe.setInterpolatedDataPointers(
                                 PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               x,
-                                                               X,
-                                                               elem,
-                                                               PK1_var_data[k],
-                                                               PK1_grad_var_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            evaluatePK1StressFunction(PP,
+                                                      d_PK1_stress_fcn_data[part][k],
+                                                      FF,
+                                                      x,
+                                                      X,
+                                                      elem,
+                                                      PK1_var_data[k],
+                                                      PK1_grad_var_data[k],
+                                                      data_time,
+                                                      PK1_batch_scratch[k]);
                             F -= PP * normal_face[qp];
                         }
                     }
@@ -2780,6 +2975,12 @@ IBFEMethod::commonConstructor(const std::string& object_name,
     d_lag_body_source_fcn_data.resize(d_meshes.size());
     d_direct_forcing_kinematics_data.resize(d_meshes.size(), Pointer<IBFEDirectForcingKinematics>(nullptr));
 
+    // Set up the jump condition intersection caches.
+    d_jump_condition_intersections.resize(d_meshes.size());
+    d_jump_condition_intersection_X_vecs.resize(d_meshes.size());
+    d_num_jump_condition_impositions.resize(d_meshes.size(), 0);
+    d_num_jump_condition_intersection_searches.resize(d_meshes.size(), 0);
+
     // Determine whether we should use first-order or second-order shape
     // functions for each part of the structure.
     for (unsigned int part = 0; part < d_meshes.size(); ++part)
@@ -2875,6 +3076,13 @@ IBFEMethod::commonConstructor(const std::string& object_name,
                                         /*due to a bug in SAMRAI this *has* to be true*/ true);
     }
 
+    // Set up timers. The last one measures each time step, from
+    // preprocessIntegrateData() to postprocessIntegrateData().
+    IBAMR_DO_ONCE(t_interpolate_velocity =
+                      TimerManager::getManager()->getTimer("IBAMR::IBFEMethod::interpolateVelocity()", true);
+                  t_spread_force = TimerManager::getManager()->getTimer("IBAMR::IBFEMethod::spreadForce()", true);
+                  t_time_step = TimerManager::getManager()->getTimer("IBAMR::IBFEMethod::timeStep()", true););
+
     return;
 } // commonConstructor
 
@@ -2995,6 +3203,8 @@ IBFEMethod::getFromInput(const Pointer<Database>& db, bool /*is_from_restart*/)
     else if (db->isBool("split_forces"))
         d_split_tangential_force = db->getBool("split_forces");
     if (db->isBool("use_jump_conditions")) d_use_jump_conditions = db->getBool("use_jump_conditions");
+    if (db->isDouble("jump_condition_intersection_cache_tol"))
+        d_jump_condition_intersection_cache_tol = db->getDouble("jump_condition_intersection_cache_tol");
     if (db->isBool("use_consistent_mass_matrix"))
         d_use_consistent_mass_matrix = db->getBool("use_consistent_mass_matrix");
 
@@ -3033,6 +3243,34 @@ IBFEMethod::getFromInput(const Pointer<Database>& db, bool /*is_from_restart*/)
     {
         d_default_workload_spec.q_point_weight = db->getDouble("workload_quad_point_weight");
     }
+    if (db->isDatabase("workload_quad_point_weights"))
+    {
+        Pointer<Database> weights_db = db->getDatabase("workload_quad_point_weights");
+        const Array<std::string> elem_type_names = weights_db->getAllKeys();
+        for (int k = 0; k < elem_type_names.size(); ++k)
+        {
+            const ElemType elem_type = Utility::string_to_enum<ElemType>(elem_type_names[k]);
+            const double weight = weights_db->getDouble(elem_type_names[k]);
+            if (weight <= 0.0)
+            {
+                TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                         << "  workload weight for element type " << elem_type_names[k]
+                                         << " must be positive." << std::endl);
+            }
+            d_default_workload_spec.elem_type_q_point_weights[elem_type] = weight;
+        }
+    }
+    if (db->keyExists("workload_jump_condition_quad_point_weight"))
+    {
+        d_workload_jump_condition_q_point_weight = db->getDouble("workload_jump_condition_quad_point_weight");
+    }
+    if (db->keyExists("workload_calibration_steps"))
+    {
+        d_workload_calibration_steps = db->getInteger("workload_calibration_steps");
+    }
+
+    if (db->isBool("process_parts_concurrently"))
+        d_process_parts_concurrently = db->getBool("process_parts_concurrently");
 
     d_use_scratch_hierarchy = db->getBoolWithDefault("use_scratch_hierarchy", false);
     if (d_use_scratch_hierarchy)
@@ -3079,6 +3317,13 @@ IBFEMethod::getFromRestart()
     std::unique_ptr<bool[]> part_is_active_arr{ new bool[d_part_is_active.size()] };
     db->getBoolArray("part_is_active_arr", part_is_active_arr.get(), d_part_is_active.size());
     std::copy(part_is_active_arr.get(), part_is_active_arr.get() + part_is_active_arr_size, d_part_is_active.begin());
+    if (db->keyExists("d_workload_calibration_step_num"))
+    {
+        d_workload_calibration_step_num = db->getInteger("d_workload_calibration_step_num");
+        d_workload_interaction_time = db->getDouble("d_workload_interaction_time");
+        d_workload_step_time = db->getDouble("d_workload_step_time");
+        d_workload_calibration_scale = db->getDouble("d_workload_calibration_scale");
+    }
     return;
 } // getFromRestart
 
@@ -3099,6 +3344,51 @@ IBFEMethod::assertStructureOnFinestLevel() const
     }
 }
 
+void
+IBFEMethod::calibrateWorkloadSpecs()
+{
+    // The load balancer only sees the total workload on each processor, so it
+    // suffices to compare the total measured times over all processors.
+    double times[2] = { d_workload_interaction_time, d_workload_step_time };
+    SAMRAI_MPI::sumReduction(times, 2);
+    const double interaction_time = times[0];
+    const double fluid_time = times[1] - times[0];
+
+    double n_cells = 0.0;
+    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        const BoxArray<NDIM>& level_boxes = d_hierarchy->getPatchLevel(ln)->getBoxes();
+        for (int k = 0; k < level_boxes.getNumberOfBoxes(); ++k) n_cells += level_boxes[k].size();
+    }
+    double q_point_workload = 0.0;
+    for (unsigned int part = 0; part < d_meshes.size(); ++part)
+    {
+        q_point_workload += d_active_fe_data_managers[part]->computeTotalQuadPointWorkload();
+    }
+
+    if (interaction_time <= 0.0 || fluid_time <= 0.0 || q_point_workload <= 0.0)
+    {
+        plog << d_object_name << "::calibrateWorkloadSpecs(): insufficient timing data, workload weights are not "
+                                 "modified\n";
+        return;
+    }
+
+    // Each Eulerian cell has unit workload, so the measured cost of one unit
+    // of quadrature point workload relative to one cell is
+    const double scale = (interaction_time / q_point_workload) / (fluid_time / n_cells);
+    for (unsigned int part = 0; part < d_meshes.size(); ++part)
+    {
+        FEDataManager::WorkloadSpec workload_spec = d_primary_fe_data_managers[part]->getWorkloadSpec();
+        workload_spec.q_point_weight *= scale;
+        d_primary_fe_data_managers[part]->setWorkloadSpec(workload_spec);
+        if (d_use_scratch_hierarchy) d_scratch_fe_data_managers[part]->setWorkloadSpec(workload_spec);
+    }
+    d_workload_calibration_scale *= scale;
+    plog << d_object_name << "::calibrateWorkloadSpecs(): scaled quadrature point workload weights by " << scale
+         << '\n';
+    return;
+} // calibrateWorkloadSpecs
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
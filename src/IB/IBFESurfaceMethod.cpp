@@ -226,6 +226,20 @@ IBFESurfaceMethod::getFEDataManager(const unsigned int part) const
     return d_fe_data_managers[part];
 } // getFEDataManager
 
+unsigned int
+IBFESurfaceMethod::getNumJumpConditionImpositions(const unsigned int part) const
+{
+    TBOX_ASSERT(part < d_num_parts);
+    return d_num_jump_condition_impositions[part];
+} // getNumJumpConditionImpositions
+
+unsigned int
+IBFESurfaceMethod::getNumJumpConditionIntersectionSearches(const unsigned int part) const
+{
+    TBOX_ASSERT(part < d_num_parts);
+    return d_num_jump_condition_intersection_searches[part];
+} // getNumJumpConditionIntersectionSearches
+
 void
 IBFESurfaceMethod::registerInitialCoordinateMappingFunction(const CoordinateMappingFcnData& data,
                                                             const unsigned int part)
@@ -1222,10 +1236,22 @@ IBFESurfaceMethod::initializeFEEquationSystems()
         {
             const std::string& file_name = libmesh_restart_file_name(
                 d_libmesh_restart_read_dir, d_libmesh_restart_restore_number, part, d_libmesh_restart_file_extension);
-            const XdrMODE xdr_mode = (d_libmesh_restart_file_extension == "xdr" ? DECODE : READ);
-            const int read_mode =
-                EquationSystems::READ_HEADER | EquationSystems::READ_DATA | EquationSystems::READ_ADDITIONAL_DATA;
-            equation_systems->read(file_name, xdr_mode, read_mode, /*partition_agnostic*/ true);
+            const XdrMODE xdr_mode = get_xdr_mode(d_libmesh_restart_file_extension, /*write*/ false);
+            if (d_libmesh_restart_read_collective_io)
+            {
+                // Recreate the systems and their vectors from the header and
+                // then read the vectors, which do not depend on the current
+                // partitioning of the mesh.
+                equation_systems->read(
+                    file_name, xdr_mode, EquationSystems::READ_HEADER | EquationSystems::READ_ADDITIONAL_DATA);
+                read_equation_systems_data(*equation_systems, file_name + ".data");
+            }
+            else
+            {
+                const int read_mode =
+                    EquationSystems::READ_HEADER | EquationSystems::READ_DATA | EquationSystems::READ_ADDITIONAL_DATA;
+                equation_systems->read(file_name, xdr_mode, read_mode, /*partition_agnostic*/ true);
+            }
         }
         else
         {
@@ -1518,6 +1544,7 @@ IBFESurfaceMethod::putToDatabase(Pointer<Database> db)
     db->putBool("d_compute_fluid_traction", d_compute_fluid_traction);
     db->putBool("d_use_consistent_mass_matrix", d_use_consistent_mass_matrix);
     db->putBool("d_use_direct_forcing", d_use_direct_forcing);
+    db->putBool("d_libmesh_restart_use_collective_io", d_libmesh_restart_use_collective_io);
     return;
 } // putToDatabase
 
@@ -1528,9 +1555,17 @@ IBFESurfaceMethod::writeFEDataToRestartFile(const std::string& restart_dump_dirn
     {
         const std::string& file_name =
             libmesh_restart_file_name(restart_dump_dirname, time_step_number, part, d_libmesh_restart_file_extension);
-        const XdrMODE xdr_mode = (d_libmesh_restart_file_extension == "xdr" ? ENCODE : WRITE);
-        const int write_mode = EquationSystems::WRITE_DATA | EquationSystems::WRITE_ADDITIONAL_DATA;
-        d_equation_systems[part]->write(file_name, xdr_mode, write_mode, /*partition_agnostic*/ true);
+        const XdrMODE xdr_mode = get_xdr_mode(d_libmesh_restart_file_extension, /*write*/ true);
+        if (d_libmesh_restart_use_collective_io)
+        {
+            d_equation_systems[part]->write(file_name, xdr_mode, EquationSystems::WRITE_ADDITIONAL_DATA);
+            write_equation_systems_data(*d_equation_systems[part], file_name + ".data");
+        }
+        else
+        {
+            const int write_mode = EquationSystems::WRITE_DATA | EquationSystems::WRITE_ADDITIONAL_DATA;
+            d_equation_systems[part]->write(file_name, xdr_mode, write_mode, /*partition_agnostic*/ true);
+        }
     }
     return;
 }
@@ -1604,6 +1639,31 @@ IBFESurfaceMethod::imposeJumpConditions(const int f_data_idx,
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
     const IntVector<NDIM>& ratio = level->getRatio();
     const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
+
+    // Determine whether or not previously computed intersections can be
+    // reused.
+    const bool cache_intersections = d_jump_condition_intersection_cache_tol >= 0.0;
+    bool reuse_intersections = false;
+    if (cache_intersections)
+    {
+        std::unique_ptr<PetscVector<double> >& X_ref_vec = d_jump_condition_intersection_X_vecs[part];
+        reuse_intersections = max_norm_difference(X_ghost_vec, X_ref_vec.get()) <=
+                              d_jump_condition_intersection_cache_tol;
+        if (!reuse_intersections)
+        {
+            X_ref_vec.reset(static_cast<PetscVector<double>*>(X_ghost_vec.clone().release()));
+            d_jump_condition_intersections[part].clear();
+        }
+        d_jump_condition_intersections[part].resize(active_patch_element_map.size());
+    }
+    ++d_num_jump_condition_impositions[part];
+    if (!reuse_intersections) ++d_num_jump_condition_intersection_searches[part];
+    if (d_do_log && cache_intersections)
+    {
+        plog << d_object_name << "::imposeJumpConditions(): " << (reuse_intersections ? "reusing" : "recomputing")
+             << " grid line intersections for part " << part << "\n";
+    }
+
     int local_patch_num = 0;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
     {
@@ -1625,6 +1685,39 @@ IBFESurfaceMethod::imposeJumpConditions(const int f_data_idx,
         const double* const x_lower = patch_geom->getXLower();
         const double* const dx = patch_geom->getDx();
 
+        // If possible, impose the jump conditions at the cached intersection
+        // points and skip the search.
+        PatchJumpConditionIntersections* const patch_intersections =
+            cache_intersections ? &d_jump_condition_intersections[part][local_patch_num] : nullptr;
+        if (patch_intersections && reuse_intersections && patch_intersections->patch_box == patch_box &&
+            patch_intersections->patch_elems == patch_elems)
+        {
+            const Elem* prev_elem = nullptr;
+            for (const JumpConditionIntersection& intersection : patch_intersections->intersections)
+            {
+                if (intersection.elem != prev_elem)
+                {
+                    DP_dof_map.dof_indices(intersection.elem, DP_dof_indices);
+                    get_values_for_interpolation(DP_node, DP_ghost_vec, DP_dof_indices);
+                    prev_elem = intersection.elem;
+                }
+                double C_p = 0.0;
+                for (unsigned int k = 0; k < intersection.phi.size(); ++k)
+                {
+                    C_p += DP_node[k] * intersection.phi[k];
+                }
+                const unsigned int axis = intersection.i_s.getAxis();
+                (*f_data)(intersection.i_s) += intersection.sgn * (C_p / dx[axis]);
+            }
+            continue;
+        }
+        if (patch_intersections)
+        {
+            patch_intersections->patch_box = patch_box;
+            patch_intersections->patch_elems = patch_elems;
+            patch_intersections->intersections.clear();
+        }
+
         std::array<std::map<hier::Index<NDIM>, std::vector<libMesh::Point>, IndexOrder>, NDIM> intersection_points,
             intersection_ref_coords;
         std::array<std::map<hier::Index<NDIM>, std::vector<VectorValue<double> >, IndexOrder>, NDIM>
@@ -1804,6 +1897,13 @@ IBFESurfaceMethod::imposeJumpConditions(const int f_data_idx,
                                     const double C_p = interpolate(0, DP_node, phi);
                                     const double sgn = n(axis) > 0.0 ? 1.0 : n(axis) < 0.0 ? -1.0 : 0.0;
                                     (*f_data)(i_s) += sgn * (C_p / dx[axis]);
+                                    if (patch_intersections)
+                                    {
+                                        std::vector<double> phi_xi(phi.size());
+                                        for (unsigned int k = 0; k < phi.size(); ++k) phi_xi[k] = phi[k][0];
+                                        patch_intersections->intersections.push_back(
+                                            { elem, i_s, sgn, std::move(phi_xi) });
+                                    }
                                 }
 
                                 // Keep track of the positions where we have
@@ -2095,6 +2195,12 @@ IBFESurfaceMethod::commonConstructor(const std::string& object_name,
     d_interp_spec.resize(d_num_parts, d_default_interp_spec);
     d_spread_spec.resize(d_num_parts, d_default_spread_spec);
 
+    // Set up the jump condition intersection caches.
+    d_jump_condition_intersections.resize(d_num_parts);
+    d_jump_condition_intersection_X_vecs.resize(d_num_parts);
+    d_num_jump_condition_impositions.resize(d_num_parts, 0);
+    d_num_jump_condition_intersection_searches.resize(d_num_parts, 0);
+
     return;
 } // commonConstructor
 
@@ -2204,6 +2310,8 @@ IBFESurfaceMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
     if (d_use_pressure_jump_conditions || d_use_velocity_jump_conditions)
     {
         if (db->isBool("perturb_fe_mesh_nodes")) d_perturb_fe_mesh_nodes = db->getBool("perturb_fe_mesh_nodes");
+        if (db->isDouble("jump_condition_intersection_cache_tol"))
+            d_jump_condition_intersection_cache_tol = db->getDouble("jump_condition_intersection_cache_tol");
     }
     if (db->isBool("compute_fluid_traction")) d_compute_fluid_traction = db->getBool("compute_fluid_traction");
     if (d_compute_fluid_traction)
@@ -2217,6 +2325,8 @@ IBFESurfaceMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
     // Restart settings.
     if (db->isString("libmesh_restart_file_extension"))
         d_libmesh_restart_file_extension = db->getString("libmesh_restart_file_extension");
+    if (db->isBool("libmesh_restart_use_collective_io"))
+        d_libmesh_restart_use_collective_io = db->getBool("libmesh_restart_use_collective_io");
 
     // Other settings.
     if (db->isInteger("min_ghost_cell_width"))
@@ -2257,6 +2367,7 @@ IBFESurfaceMethod::getFromRestart()
     d_use_pressure_jump_conditions = db->getBool("d_use_pressure_jump_conditions");
     d_use_consistent_mass_matrix = db->getBool("d_use_consistent_mass_matrix");
     d_use_direct_forcing = db->getBool("d_use_direct_forcing");
+    d_libmesh_restart_read_collective_io = db->getBoolWithDefault("d_libmesh_restart_use_collective_io", false);
     return;
 } // getFromRestart
 
@@ -175,6 +175,7 @@ IBMethod::IBMethod(std::string object_name, Pointer<Database> input_db, bool reg
                                                 d_ghosts,
                                                 d_registered_for_restart);
     d_ghosts = d_l_data_manager->getGhostCellWidth();
+    d_l_data_manager->setWorkloadNodeWeight(d_workload_node_weight, d_scale_workload_by_kernel_width);
 
     // Create the instrument panel object.
     d_instrument_panel =
@@ -2024,6 +2025,9 @@ IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
     if (db->keyExists("error_if_points_leave_domain"))
         d_error_if_points_leave_domain = db->getBool("error_if_points_leave_domain");
     if (db->keyExists("force_jac_mffd")) d_force_jac_mffd = db->getBool("force_jac_mffd");
+    if (db->keyExists("workload_node_weight")) d_workload_node_weight = db->getDouble("workload_node_weight");
+    if (db->keyExists("scale_workload_by_kernel_width"))
+        d_scale_workload_by_kernel_width = db->getBool("scale_workload_by_kernel_width");
     if (db->keyExists("do_log"))
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
@@ -23,6 +23,8 @@
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
 #include "ibtk/CartExtrapPhysBdryOp.h"
+#include "ibtk/box_utilities.h"
+#include "ibtk/ibtk_macros.h"
 
 #include "Box.h"
 #include "CartesianGridGeometry.h"
@@ -542,9 +544,12 @@ AdvDiffCenteredConvectiveOperator::applyConvectiveOperator(const int Q_idx, cons
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+        const int num_patches = static_cast<int>(patches.size());
+        IBTK_OMP(parallel for schedule(dynamic))
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             const Box<NDIM>& patch_box = patch->getBox();
             const IntVector<NDIM>& patch_lower = patch_box.lower();
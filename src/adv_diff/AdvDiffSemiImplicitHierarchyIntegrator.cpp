@@ -24,6 +24,9 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/LaplaceOperator.h"
 #include "ibtk/PoissonSolver.h"
+#include "ibtk/SAMRAIDataCache.h"
+#include "ibtk/box_utilities.h"
+#include "ibtk/ibtk_utilities.h"
 
 #include "BasePatchHierarchy.h"
 #include "CartesianGridGeometry.h"
@@ -808,6 +811,10 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
         {
             // Solve for Q(n+1).
             Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
+            if (cycle_num == 0 && l < d_Q_solution_history.size() && d_Q_solution_history[l].size() > 1)
+            {
+                extrapolateSolutionHistory(l, Q_scratch_idx, new_time);
+            }
             helmholtz_solver->solveSystem(*d_sol_vecs[l], *d_rhs_vecs[l]);
             d_hier_cc_data_ops->copyData(Q_new_idx, Q_scratch_idx);
             if (d_enable_logging && d_enable_logging_solver_iterations)
@@ -877,9 +884,12 @@ AdvDiffSemiImplicitHierarchyIntegrator::postprocessIntegrateHierarchy(const doub
         for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
         {
             Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+            const int num_patches = static_cast<int>(patches.size());
+            IBTK_OMP(parallel for schedule(dynamic) reduction(max : cfl_max))
+            for (int k = 0; k < num_patches; ++k)
             {
-                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Pointer<Patch<NDIM> >& patch = patches[k];
                 const Box<NDIM>& patch_box = patch->getBox();
                 const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
                 const double* const dx = pgeom->getDx();
@@ -895,6 +905,9 @@ AdvDiffSemiImplicitHierarchyIntegrator::postprocessIntegrateHierarchy(const doub
     if (d_enable_logging)
         plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl_max << "\n";
 
+    // Store the new solutions for use in extrapolating initial guesses.
+    if (d_initial_guess_extrapolation_order > 0) updateSolutionHistory(new_time);
+
     // Execute any registered callbacks.
     executePostprocessIntegrateHierarchyCallbackFcns(
         current_time, new_time, skip_synchronize_new_state_data, num_cycles);
@@ -903,6 +916,17 @@ AdvDiffSemiImplicitHierarchyIntegrator::postprocessIntegrateHierarchy(const doub
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+void
+AdvDiffSemiImplicitHierarchyIntegrator::regridHierarchyBeginSpecialized()
+{
+    AdvDiffHierarchyIntegrator::regridHierarchyBeginSpecialized();
+
+    // The solution history is not transferred to the new patch hierarchy.
+    d_Q_solution_history.clear();
+    d_solution_history_cache.setPatchHierarchy(nullptr);
+    return;
+} // regridHierarchyBeginSpecialized
+
 void
 AdvDiffSemiImplicitHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
     const Pointer<BasePatchHierarchy<NDIM> > base_hierarchy,
@@ -983,6 +1007,8 @@ AdvDiffSemiImplicitHierarchyIntegrator::getFromInput(Pointer<Database> db, bool
         else if (db->keyExists("default_convective_op_db"))
             d_default_convective_op_input_db = db->getDatabase("default_convective_op_db");
     }
+    if (db->keyExists("initial_guess_extrapolation_order"))
+        d_initial_guess_extrapolation_order = db->getInteger("initial_guess_extrapolation_order");
     return;
 } // getFromInput
 
@@ -1008,6 +1034,62 @@ AdvDiffSemiImplicitHierarchyIntegrator::getFromRestart()
     return;
 } // getFromRestart
 
+void
+AdvDiffSemiImplicitHierarchyIntegrator::updateSolutionHistory(const double new_time)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    if (d_Q_solution_history.empty())
+    {
+        d_solution_history_cache.setPatchHierarchy(d_hierarchy);
+        d_solution_history_cache.resetLevels(0, d_hierarchy->getFinestLevelNumber());
+        d_Q_solution_history.resize(d_Q_var.size());
+    }
+    unsigned int l = 0;
+    for (auto cit = d_Q_var.begin(); cit != d_Q_var.end(); ++cit, ++l)
+    {
+        Pointer<CellVariable<NDIM, double> > Q_var = *cit;
+        if (!(isDiffusionCoefficientVariable(Q_var) || (d_Q_diffusion_coef[Q_var] != 0.0))) continue;
+        std::deque<SolutionHistoryEntry>& Q_history = d_Q_solution_history[l];
+
+        // Replace the most recent entry if the time step is being repeated, and
+        // discard the oldest entry if the history is full.
+        if (!Q_history.empty() && MathUtilities<double>::equalEps(Q_history.back().time, new_time))
+        {
+            Q_history.pop_back();
+        }
+        if (static_cast<int>(Q_history.size()) > d_initial_guess_extrapolation_order)
+        {
+            Q_history.pop_front();
+        }
+
+        const int Q_new_idx = var_db->mapVariableAndContextToIndex(Q_var, getNewContext());
+        SolutionHistoryEntry entry = { new_time, d_solution_history_cache.getCachedPatchDataIndex(Q_new_idx) };
+        d_hier_cc_data_ops->copyData(entry.Q_idx, Q_new_idx);
+        Q_history.push_back(entry);
+    }
+    return;
+} // updateSolutionHistory
+
+void
+AdvDiffSemiImplicitHierarchyIntegrator::extrapolateSolutionHistory(const unsigned int l,
+                                                                   const int Q_idx,
+                                                                   const double new_time)
+{
+    const std::deque<SolutionHistoryEntry>& Q_history = d_Q_solution_history[l];
+    std::vector<double> times;
+    for (const auto& entry : Q_history)
+    {
+        times.push_back(entry.time);
+    }
+    const std::vector<double> wgts = lagrange_interpolation_weights(times, new_time);
+    d_hier_cc_data_ops->scale(Q_idx, wgts[0], Q_history[0].Q_idx);
+    for (unsigned int k = 1; k < Q_history.size(); ++k)
+    {
+        d_hier_cc_data_ops->axpy(Q_idx, wgts[k], Q_history[k].Q_idx, Q_idx);
+    }
+    return;
+} // extrapolateSolutionHistory
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
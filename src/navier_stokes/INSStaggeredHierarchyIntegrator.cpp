@@ -48,8 +48,10 @@
 #include "ibtk/LinearSolver.h"
 #include "ibtk/NewtonKrylovSolver.h"
 #include "ibtk/PoissonSolver.h"
+#include "ibtk/SAMRAIDataCache.h"
 #include "ibtk/SCPoissonSolverManager.h"
 #include "ibtk/SideDataSynchronization.h"
+#include "ibtk/box_utilities.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
 
@@ -542,6 +544,11 @@ INSStaggeredHierarchyIntegrator::INSStaggeredHierarchyIntegrator(std::string obj
     if (input_db->keyExists("explicitly_remove_nullspace"))
         d_explicitly_remove_nullspace = input_db->getBool("explicitly_remove_nullspace");
 
+    // Optionally extrapolate previous solutions to obtain the initial guess for
+    // the Stokes solver.
+    if (input_db->keyExists("initial_guess_extrapolation_order"))
+        d_initial_guess_extrapolation_order = input_db->getInteger("initial_guess_extrapolation_order");
+
     // Setup physical boundary conditions objects.
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_U_bc_coefs.resize(NDIM);
@@ -1497,6 +1504,9 @@ INSStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(const double curr
         synchronizeHierarchyData(NEW_DATA);
     }
 
+    // Store the new solution for use in extrapolating initial guesses.
+    if (d_initial_guess_extrapolation_order > 0) updateSolutionHistory(current_time, new_time);
+
     // Determine the CFL number.
     if (!d_parent_integrator)
     {
@@ -1505,9 +1515,12 @@ INSStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(const double curr
         for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
         {
             Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            const std::vector<Pointer<Patch<NDIM> > > patches = get_local_patches(level);
+            const int num_patches = static_cast<int>(patches.size());
+            IBTK_OMP(parallel for schedule(dynamic) reduction(max : cfl_max))
+            for (int k = 0; k < num_patches; ++k)
             {
-                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Pointer<Patch<NDIM> >& patch = patches[k];
                 const Box<NDIM>& patch_box = patch->getBox();
                 const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
                 const double* const dx = pgeom->getDx();
@@ -1798,9 +1811,14 @@ INSStaggeredHierarchyIntegrator::setupSolverVectors(const Pointer<SAMRAIVectorRe
     }
 
     // Set solution components to equal most recent approximations to u(n+1) and
-    // p(n+1/2).
+    // p(n+1/2).  In the first cycle, these are optionally extrapolated from the
+    // solutions computed during previous time steps.
     d_hier_sc_data_ops->copyData(sol_vec->getComponentDescriptorIndex(0), d_U_new_idx);
     d_hier_cc_data_ops->copyData(sol_vec->getComponentDescriptorIndex(1), d_P_new_idx);
+    if (cycle_num == 0 && d_solution_history.size() > 1)
+    {
+        extrapolateSolutionHistory(sol_vec, current_time, new_time);
+    }
 
     // Synchronize solution and right-hand-side data before solve.
     using SynchronizationTransactionComponent = SideDataSynchronization::SynchronizationTransactionComponent;
@@ -1947,6 +1965,10 @@ INSStaggeredHierarchyIntegrator::regridHierarchyBeginSpecialized()
     d_div_U_norm_1_pre = d_hier_cc_data_ops->L1Norm(d_Div_U_idx, wgt_cc_idx);
     d_div_U_norm_2_pre = d_hier_cc_data_ops->L2Norm(d_Div_U_idx, wgt_cc_idx);
     d_div_U_norm_oo_pre = d_hier_cc_data_ops->maxNorm(d_Div_U_idx, wgt_cc_idx);
+
+    // The solution history is not transferred to the new patch hierarchy.
+    d_solution_history.clear();
+    d_solution_history_cache.setPatchHierarchy(nullptr);
     return;
 } // regridHierarchyBeginSpecialized
 
@@ -2542,10 +2564,12 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
     P_problem_coefs.setCZero();
     P_problem_coefs.setDConstant(rho == 0.0 ? -1.0 : -1.0 / rho);
 
-    // Ensure that solver components are appropriately reinitialized when the
-    // time step size changes.
-    const bool dt_change = initial_time || !MathUtilities<double>::equalEps(dt, d_dt_previous[0]);
-    if (dt_change)
+    // Ensure that solver components are appropriately updated when the time
+    // step size changes.  Solvers are first asked to update their problem
+    // coefficients in place, and are only reinitialized when they cannot do
+    // so.
+    const bool dt_change = !initial_time && !MathUtilities<double>::equalEps(dt, d_dt_previous[0]);
+    if (initial_time)
     {
         d_velocity_solver_needs_init = true;
         d_stokes_solver_needs_init = true;
@@ -2685,6 +2709,15 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
         d_velocity_solver->setPhysicalBcCoefs(d_U_star_bc_coefs);
         d_velocity_solver->setSolutionTime(new_time);
         d_velocity_solver->setTimeInterval(current_time, new_time);
+        if (dt_change && !d_velocity_solver_needs_init)
+        {
+            d_velocity_solver_needs_init = !d_velocity_solver->updateProblemCoefficients();
+            if (d_enable_logging && !d_velocity_solver_needs_init)
+                plog << d_object_name
+                     << "::preprocessIntegrateHierarchy(): updated velocity "
+                        "subdomain solver coefficients"
+                     << std::endl;
+        }
         if (d_velocity_solver_needs_init)
         {
             if (d_enable_logging)
@@ -2783,6 +2816,15 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
             TBOX_WARNING("No special BCs set for the preconditioner \n");
         }
     }
+    if (dt_change && !d_stokes_solver_needs_init)
+    {
+        d_stokes_solver_needs_init = !d_stokes_solver->updateProblemCoefficients();
+        if (d_enable_logging && !d_stokes_solver_needs_init)
+            plog << d_object_name
+                 << "::preprocessIntegrateHierarchy(): updated incompressible "
+                    "Stokes solver coefficients"
+                 << std::endl;
+    }
     if (d_stokes_solver_needs_init)
     {
         if (d_enable_logging)
@@ -3007,6 +3049,62 @@ INSStaggeredHierarchyIntegrator::getConvectiveTimeSteppingType(const int cycle_n
     return convective_time_stepping_type;
 } // getConvectiveTimeSteppingType
 
+void
+INSStaggeredHierarchyIntegrator::updateSolutionHistory(const double current_time, const double new_time)
+{
+    if (d_solution_history.empty())
+    {
+        d_solution_history_cache.setPatchHierarchy(d_hierarchy);
+        d_solution_history_cache.resetLevels(0, d_hierarchy->getFinestLevelNumber());
+    }
+
+    // Replace the most recent entry if the time step is being repeated, and
+    // discard the oldest entry if the history is full.
+    if (!d_solution_history.empty() && MathUtilities<double>::equalEps(d_solution_history.back().U_time, new_time))
+    {
+        d_solution_history.pop_back();
+    }
+    if (static_cast<int>(d_solution_history.size()) > d_initial_guess_extrapolation_order)
+    {
+        d_solution_history.pop_front();
+    }
+
+    SolutionHistoryEntry entry = { new_time,
+                                   0.5 * (current_time + new_time),
+                                   d_solution_history_cache.getCachedPatchDataIndex(d_U_new_idx),
+                                   d_solution_history_cache.getCachedPatchDataIndex(d_P_new_idx) };
+    d_hier_sc_data_ops->copyData(entry.U_idx, d_U_new_idx);
+    d_hier_cc_data_ops->copyData(entry.P_idx, d_P_new_idx);
+    d_solution_history.push_back(entry);
+    return;
+} // updateSolutionHistory
+
+void
+INSStaggeredHierarchyIntegrator::extrapolateSolutionHistory(const Pointer<SAMRAIVectorReal<NDIM, double> >& sol_vec,
+                                                            const double current_time,
+                                                            const double new_time)
+{
+    std::vector<double> U_times, P_times;
+    for (const auto& entry : d_solution_history)
+    {
+        U_times.push_back(entry.U_time);
+        P_times.push_back(entry.P_time);
+    }
+    const std::vector<double> U_wgts = lagrange_interpolation_weights(U_times, new_time);
+    const std::vector<double> P_wgts = lagrange_interpolation_weights(P_times, 0.5 * (current_time + new_time));
+
+    const int U_sol_idx = sol_vec->getComponentDescriptorIndex(0);
+    const int P_sol_idx = sol_vec->getComponentDescriptorIndex(1);
+    d_hier_sc_data_ops->scale(U_sol_idx, U_wgts[0], d_solution_history[0].U_idx);
+    d_hier_cc_data_ops->scale(P_sol_idx, P_wgts[0], d_solution_history[0].P_idx);
+    for (unsigned int k = 1; k < d_solution_history.size(); ++k)
+    {
+        d_hier_sc_data_ops->axpy(U_sol_idx, U_wgts[k], d_solution_history[k].U_idx, U_sol_idx);
+        d_hier_cc_data_ops->axpy(P_sol_idx, P_wgts[k], d_solution_history[k].P_idx, P_sol_idx);
+    }
+    return;
+} // extrapolateSolutionHistory
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
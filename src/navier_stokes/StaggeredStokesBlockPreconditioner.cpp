@@ -174,6 +174,12 @@ StaggeredStokesBlockPreconditioner::deallocateSolverState()
     return;
 } // deallocateSolverState
 
+bool
+StaggeredStokesBlockPreconditioner::updateProblemCoefficients()
+{
+    return d_is_initialized;
+} // updateProblemCoefficients
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 void
@@ -18,7 +18,6 @@
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
-#include "ibtk/IBTK_CHKERRQ.h"
 
 #include "ArrayData.h"
 #include "BasePatchLevel.h"
@@ -44,15 +43,9 @@
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
-#include "petscksp.h"
-#include "petscmat.h"
-#include "petscpc.h"
-#include "petscsys.h"
-#include "petscvec.h"
-
 #include <algorithm>
 #include <array>
-#include <limits>
+#include <cmath>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -69,363 +62,202 @@ namespace
 // Number of ghosts cells used for each variable quantity.
 static const int GHOSTS = 1;
 
-inline int
-compute_side_index(const hier::Index<NDIM>& i, const Box<NDIM>& box, const unsigned int axis)
-{
-    const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-    if (!side_box.contains(i)) return -1;
-    int offset = 0;
-    for (unsigned int d = 0; d < axis; ++d)
-    {
-        offset += SideGeometry<NDIM>::toSideBox(box, d).size();
-    }
-    return offset + side_box.offset(i);
-} // compute_side_index
+// Number of degrees of freedom in a single-cell box: the 2*NDIM velocity
+// components stored on the faces of the cell and the pressure stored at the
+// cell center.  Velocity degrees of freedom are numbered first (lower face
+// then upper face, for each axis), followed by the pressure.
+static const int BOX_SIZE = 2 * NDIM + 1;
+static const int BOX_CELL_DOF = 2 * NDIM;
+
+using BoxVector = std::array<double, BOX_SIZE>;
+using BoxMatrix = std::array<double, BOX_SIZE * BOX_SIZE>;
 
 inline int
-compute_cell_index(const hier::Index<NDIM>& i, const Box<NDIM>& box)
+box_side_dof(const unsigned int axis, const unsigned int side)
 {
-    if (!box.contains(i)) return -1;
-    int offset = 0;
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        offset += SideGeometry<NDIM>::toSideBox(box, axis).size();
-    }
-    return box.offset(i) + offset;
-} // compute_cell_index
+    return 2 * axis + side;
+} // box_side_dof
 
 void
-buildBoxOperator(Mat& A,
-                 const PoissonSpecifications& U_problem_coefs,
-                 const Box<NDIM>& box,
-                 const Box<NDIM>& ghost_box,
-                 const std::array<double, NDIM>& dx)
+buildBoxOperator(BoxMatrix& A, const PoissonSpecifications& U_problem_coefs, const std::array<double, NDIM>& dx)
 {
-    int ierr;
-
     const double C = U_problem_coefs.getCConstant();
     const double D = U_problem_coefs.getDConstant();
 
-    // Allocate a PETSc matrix for the box operator.
-    std::array<Box<NDIM>, NDIM> side_boxes;
-    std::array<BoxList<NDIM>, NDIM> side_ghost_boxes;
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        side_boxes[axis] = SideGeometry<NDIM>::toSideBox(box, axis);
-        side_ghost_boxes[axis] = SideGeometry<NDIM>::toSideBox(ghost_box, axis);
-        side_ghost_boxes[axis].removeIntersections(side_boxes[axis]);
-    }
-    BoxList<NDIM> cell_ghost_boxes(ghost_box);
-    cell_ghost_boxes.removeIntersections(box);
-
-    int size = 0;
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        size += SideGeometry<NDIM>::toSideBox(ghost_box, axis).size();
-    }
-    size += ghost_box.size();
-
-    static const int U_stencil_sz = 2 * NDIM + 3;
-    static const int P_stencil_sz = 2 * NDIM + 1;
-    std::vector<int> nnz(size, 0);
-
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        for (Box<NDIM>::Iterator b(side_boxes[axis]); b; b++)
-        {
-            nnz[compute_side_index(b(), ghost_box, axis)] = std::min(size, U_stencil_sz);
-        }
-        for (BoxList<NDIM>::Iterator bl(side_ghost_boxes[axis]); bl; bl++)
-        {
-            for (Box<NDIM>::Iterator b(bl()); b; b++)
-            {
-                nnz[compute_side_index(b(), ghost_box, axis)] = 1;
-            }
-        }
-    }
-
-    for (Box<NDIM>::Iterator b(box); b; b++)
-    {
-        nnz[compute_cell_index(b(), ghost_box)] = std::min(size, P_stencil_sz);
-    }
-    for (BoxList<NDIM>::Iterator bl(cell_ghost_boxes); bl; bl++)
-    {
-        for (Box<NDIM>::Iterator b(bl()); b; b++)
-        {
-            nnz[compute_cell_index(b(), ghost_box)] = 1;
-        }
-    }
-
-    ierr = MatCreateSeqAIJ(PETSC_COMM_SELF, size, size, 0, size ? &nnz[0] : nullptr, &A);
-    IBTK_CHKERRQ(ierr);
-
-// Set some general matrix options.
-#if !defined(NDEBUG)
-    ierr = MatSetOption(A, MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatSetOption(A, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);
-    IBTK_CHKERRQ(ierr);
-#endif
-
     // Set the matrix coefficients to correspond to the standard finite
     // difference approximation to the time-dependent incompressible Stokes
-    // operator.
+    // operator, restricted to the degrees of freedom of a single cell.
     //
     // Note that boundary conditions at both physical boundaries and at
     // coarse-fine interfaces are implicitly treated by setting ghost cell
     // values appropriately.  Thus the matrix coefficients are independent of
     // any boundary conditions.
+    A.fill(0.0);
     for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
-        for (Box<NDIM>::Iterator b(side_boxes[axis]); b; b++)
+        for (unsigned int side = 0; side <= 1; ++side)
         {
-            hier::Index<NDIM> i = b();
-            const int mat_row = compute_side_index(i, ghost_box, axis);
-
-            std::vector<int> mat_cols(U_stencil_sz, -1);
-            std::vector<double> mat_vals(U_stencil_sz, 0.0);
-
-            mat_cols[0] = mat_row;
-            mat_vals[0] = C;
-
+            const int row = box_side_dof(axis, side);
+            double& diag = A[row * BOX_SIZE + row];
+            diag = C;
             for (unsigned int d = 0; d < NDIM; ++d)
             {
-                hier::Index<NDIM> shift = 0;
-                shift(d) = 1;
-                const hier::Index<NDIM> u_left = i - shift;
-                const hier::Index<NDIM> u_rght = i + shift;
-                mat_cols[2 * d + 1] = compute_side_index(u_left, ghost_box, axis);
-                mat_cols[2 * d + 2] = compute_side_index(u_rght, ghost_box, axis);
-
-                mat_vals[0] -= 2.0 * D / (dx[d] * dx[d]);
-                mat_vals[2 * d + 1] = D / (dx[d] * dx[d]);
-                mat_vals[2 * d + 2] = D / (dx[d] * dx[d]);
+                diag -= 2.0 * D / (dx[d] * dx[d]);
             }
 
-            hier::Index<NDIM> shift = 0;
-            shift(axis) = 1;
-            const hier::Index<NDIM> p_left = i - shift;
-            const hier::Index<NDIM> p_rght = i;
-            mat_cols[2 * NDIM + 1] = compute_cell_index(p_left, ghost_box);
-            mat_cols[2 * NDIM + 2] = compute_cell_index(p_rght, ghost_box);
-
-            mat_vals[2 * NDIM + 1] = -1.0 / dx[axis];
-            mat_vals[2 * NDIM + 2] = 1.0 / dx[axis];
-
-            static const int m = 1;
-            static const int n = U_stencil_sz;
-            ierr = MatSetValues(A, m, &mat_row, n, &mat_cols[0], &mat_vals[0], INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
+            // The only velocity neighbor within the box is the opposite face
+            // of the cell; all other neighbors are treated as ghost values.
+            A[row * BOX_SIZE + box_side_dof(axis, 1 - side)] = D / (dx[axis] * dx[axis]);
+            A[row * BOX_SIZE + BOX_CELL_DOF] = (side == 0 ? 1.0 : -1.0) / dx[axis];
         }
     }
 
-    for (Box<NDIM>::Iterator b(box); b; b++)
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
-        hier::Index<NDIM> i = b();
-        const int mat_row = compute_cell_index(i, ghost_box);
-
-        std::vector<int> mat_cols(P_stencil_sz, -1);
-        std::vector<double> mat_vals(P_stencil_sz, 0.0);
-
-        mat_cols[0] = mat_row;
-        mat_vals[0] = 0.0;
-
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            hier::Index<NDIM> shift = 0;
-            shift(axis) = 1;
-            const hier::Index<NDIM> u_left = i;
-            const hier::Index<NDIM> u_rght = i + shift;
-            mat_cols[2 * axis + 1] = compute_side_index(u_left, ghost_box, axis);
-            mat_cols[2 * axis + 2] = compute_side_index(u_rght, ghost_box, axis);
-
-            mat_vals[2 * axis + 1] = 1.0 / dx[axis];
-            mat_vals[2 * axis + 2] = -1.0 / dx[axis];
-        }
-
-        static const int m = 1;
-        static const int n = P_stencil_sz;
-        ierr = MatSetValues(A, m, &mat_row, n, &mat_cols[0], &mat_vals[0], INSERT_VALUES);
-        IBTK_CHKERRQ(ierr);
+        A[BOX_CELL_DOF * BOX_SIZE + box_side_dof(axis, 0)] = 1.0 / dx[axis];
+        A[BOX_CELL_DOF * BOX_SIZE + box_side_dof(axis, 1)] = -1.0 / dx[axis];
     }
+    return;
+} // buildBoxOperator
 
-    // Set the entries in the ghost cell region so that ghost cell values are
-    // not modified by the smoother.
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
+// Compute the inverse of the box operator via a dense LU factorization with
+// partial pivoting.  The box operator is a saddle point matrix with a zero
+// pressure diagonal entry, so pivoting is required.
+void
+invertBoxOperator(BoxMatrix& A_inv, BoxMatrix A)
+{
+    std::array<int, BOX_SIZE> perm;
+    for (int k = 0; k < BOX_SIZE; ++k) perm[k] = k;
+    for (int k = 0; k < BOX_SIZE; ++k)
     {
-        for (BoxList<NDIM>::Iterator bl(side_ghost_boxes[axis]); bl; bl++)
+        int pivot = k;
+        for (int i = k + 1; i < BOX_SIZE; ++i)
         {
-            for (Box<NDIM>::Iterator b(bl()); b; b++)
-            {
-                const int i = compute_side_index(b(), ghost_box, axis);
-                ierr = MatSetValue(A, i, i, 1.0, INSERT_VALUES);
-                IBTK_CHKERRQ(ierr);
-            }
+            if (std::abs(A[i * BOX_SIZE + k]) > std::abs(A[pivot * BOX_SIZE + k])) pivot = i;
+        }
+        if (A[pivot * BOX_SIZE + k] == 0.0)
+        {
+            TBOX_ERROR("StaggeredStokesBoxRelaxationFACOperator::invertBoxOperator():\n"
+                       << "  box operator is singular" << std::endl);
+        }
+        if (pivot != k)
+        {
+            for (int j = 0; j < BOX_SIZE; ++j) std::swap(A[k * BOX_SIZE + j], A[pivot * BOX_SIZE + j]);
+            std::swap(perm[k], perm[pivot]);
+        }
+        for (int i = k + 1; i < BOX_SIZE; ++i)
+        {
+            const double l_ik = A[i * BOX_SIZE + k] / A[k * BOX_SIZE + k];
+            A[i * BOX_SIZE + k] = l_ik;
+            for (int j = k + 1; j < BOX_SIZE; ++j) A[i * BOX_SIZE + j] -= l_ik * A[k * BOX_SIZE + j];
         }
     }
 
-    for (BoxList<NDIM>::Iterator bl(cell_ghost_boxes); bl; bl++)
+    // Solve LU x = P e_j for each column of the inverse.
+    for (int j = 0; j < BOX_SIZE; ++j)
     {
-        for (Box<NDIM>::Iterator b(bl()); b; b++)
+        BoxVector x;
+        for (int i = 0; i < BOX_SIZE; ++i) x[i] = (perm[i] == j ? 1.0 : 0.0);
+        for (int i = 0; i < BOX_SIZE; ++i)
+        {
+            for (int k = 0; k < i; ++k) x[i] -= A[i * BOX_SIZE + k] * x[k];
+        }
+        for (int i = BOX_SIZE - 1; i >= 0; --i)
         {
-            const int i = compute_cell_index(b(), ghost_box);
-            ierr = MatSetValue(A, i, i, 1.0, INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
+            for (int k = i + 1; k < BOX_SIZE; ++k) x[i] -= A[i * BOX_SIZE + k] * x[k];
+            x[i] /= A[i * BOX_SIZE + i];
         }
+        for (int i = 0; i < BOX_SIZE; ++i) A_inv[i * BOX_SIZE + j] = x[i];
     }
-
-    // Assemble the matrices.
-    ierr = MatAssemblyBegin(A, MAT_FINAL_ASSEMBLY);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatAssemblyEnd(A, MAT_FINAL_ASSEMBLY);
-    IBTK_CHKERRQ(ierr);
     return;
-} // buildBoxOperator
+} // invertBoxOperator
 
-void
-modifyRhsForBcs(Vec& v,
-                const SideData<NDIM, double>& U_data,
-                const CellData<NDIM, double>& P_data,
-                const PoissonSpecifications& U_problem_coefs,
-                const Box<NDIM>& box,
-                const Box<NDIM>& ghost_box,
-                const double* const dx)
+// Compute e = A^{-1} r.  The loop bounds are compile-time constants, so the
+// compiler fully unrolls and vectorizes this kernel.
+inline void
+applyBoxInverse(BoxVector& e, const BoxMatrix& A_inv, const BoxVector& r)
 {
-    int ierr;
+    for (int i = 0; i < BOX_SIZE; ++i)
+    {
+        double e_i = 0.0;
+        for (int j = 0; j < BOX_SIZE; ++j) e_i += A_inv[i * BOX_SIZE + j] * r[j];
+        e[i] = e_i;
+    }
+    return;
+} // applyBoxInverse
 
+// Set up the right-hand side of the box problem associated with cell i,
+// including the contributions from the (fixed) values outside of the box.
+inline void
+buildBoxRhs(BoxVector& r,
+            const SideData<NDIM, double>& U_residual_data,
+            const CellData<NDIM, double>& P_residual_data,
+            const SideData<NDIM, double>& U_data,
+            const CellData<NDIM, double>& P_data,
+            const PoissonSpecifications& U_problem_coefs,
+            const hier::Index<NDIM>& i,
+            const double* const dx)
+{
     const double D = U_problem_coefs.getDConstant();
     for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
+        hier::Index<NDIM> shift_axis = 0;
+        shift_axis(axis) = 1;
+        for (unsigned int side = 0; side <= 1; ++side)
         {
-            hier::Index<NDIM> i = b();
-            const int idx = compute_side_index(i, ghost_box, axis);
-
+            const hier::Index<NDIM> f = side == 0 ? i : i + shift_axis;
+            double r_f = U_residual_data(SideIndex<NDIM>(f, axis, SideIndex<NDIM>::Lower));
             for (unsigned int d = 0; d < NDIM; ++d)
             {
                 hier::Index<NDIM> shift = 0;
                 shift(d) = 1;
-                const hier::Index<NDIM> u_left = i - shift;
-                const hier::Index<NDIM> u_rght = i + shift;
-                if (!side_box.contains(u_left))
+                const double fac = D / (dx[d] * dx[d]);
+                if (d != axis || side == 0)
                 {
-                    ierr = VecSetValue(v,
-                                       idx,
-                                       +D * U_data(SideIndex<NDIM>(u_left, axis, SideIndex<NDIM>::Lower)) /
-                                           (dx[d] * dx[d]),
-                                       ADD_VALUES);
-                    IBTK_CHKERRQ(ierr);
+                    r_f += fac * U_data(SideIndex<NDIM>(f - shift, axis, SideIndex<NDIM>::Lower));
                 }
-                if (!side_box.contains(u_rght))
+                if (d != axis || side == 1)
                 {
-                    ierr = VecSetValue(v,
-                                       idx,
-                                       +D * U_data(SideIndex<NDIM>(u_rght, axis, SideIndex<NDIM>::Lower)) /
-                                           (dx[d] * dx[d]),
-                                       ADD_VALUES);
-                    IBTK_CHKERRQ(ierr);
+                    r_f += fac * U_data(SideIndex<NDIM>(f + shift, axis, SideIndex<NDIM>::Lower));
                 }
             }
-
-            hier::Index<NDIM> shift = 0;
-            shift(axis) = 1;
-            const hier::Index<NDIM> p_left = i - shift;
-            const hier::Index<NDIM> p_rght = i;
-            if (!box.contains(p_left))
+            if (side == 0)
             {
-                ierr = VecSetValue(v, idx, +P_data(p_left) / dx[axis], ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
+                r_f += P_data(i - shift_axis) / dx[axis];
             }
-            if (!box.contains(p_rght))
+            else
             {
-                ierr = VecSetValue(v, idx, -P_data(p_rght) / dx[axis], ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
+                r_f -= P_data(i + shift_axis) / dx[axis];
             }
+            r[box_side_dof(axis, side)] = r_f;
         }
     }
-
-    ierr = VecAssemblyBegin(v);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(v);
-    IBTK_CHKERRQ(ierr);
-    return;
-} // modifyRhsForBcs
-
-inline void
-copyToVec(Vec& v,
-          const SideData<NDIM, double>& U_data,
-          const CellData<NDIM, double>& P_data,
-          const Box<NDIM>& box,
-          const Box<NDIM>& ghost_box)
-{
-    int ierr;
-
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
-        {
-            const hier::Index<NDIM>& i = b();
-            const SideIndex<NDIM> s_i(i, axis, 0);
-            const int idx = compute_side_index(i, ghost_box, axis);
-            ierr = VecSetValue(v, idx, U_data(s_i), INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
-        }
-    }
-
-    for (Box<NDIM>::Iterator b(box); b; b++)
-    {
-        const hier::Index<NDIM>& i = b();
-        const int idx = compute_cell_index(i, ghost_box);
-        ierr = VecSetValue(v, idx, P_data(i), INSERT_VALUES);
-        IBTK_CHKERRQ(ierr);
-    }
-
-    ierr = VecAssemblyBegin(v);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(v);
-    IBTK_CHKERRQ(ierr);
+    r[BOX_CELL_DOF] = P_residual_data(i);
     return;
-} // copyToVec
+} // buildBoxRhs
 
+// Update the solution in cell i using an under-relaxed box correction.
 inline void
-copyFromVec(Vec& v,
-            SideData<NDIM, double>& U_data,
-            CellData<NDIM, double>& P_data,
-            const Box<NDIM>& box,
-            const Box<NDIM>& ghost_box)
+updateFromBox(const BoxVector& e,
+              SideData<NDIM, double>& U_data,
+              CellData<NDIM, double>& P_data,
+              const hier::Index<NDIM>& i)
 {
-    int ierr;
-
     const double omega = 0.65;
 
-    double U;
     for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
+        hier::Index<NDIM> shift_axis = 0;
+        shift_axis(axis) = 1;
+        for (unsigned int side = 0; side <= 1; ++side)
         {
-            const hier::Index<NDIM>& i = b();
-            const SideIndex<NDIM> s_i(i, axis, SideIndex<NDIM>::Lower);
-            const int idx = compute_side_index(i, ghost_box, axis);
-            ierr = VecGetValues(v, 1, &idx, &U);
-            IBTK_CHKERRQ(ierr);
-            U_data(s_i) = (1.0 - omega) * U_data(s_i) + omega * U;
+            const SideIndex<NDIM> s_i(side == 0 ? i : i + shift_axis, axis, SideIndex<NDIM>::Lower);
+            U_data(s_i) = (1.0 - omega) * U_data(s_i) + omega * e[box_side_dof(axis, side)];
         }
     }
-
-    double P;
-    for (Box<NDIM>::Iterator b(box); b; b++)
-    {
-        const hier::Index<NDIM>& i = b();
-        const int idx = compute_cell_index(i, ghost_box);
-        ierr = VecGetValues(v, 1, &idx, &P);
-        IBTK_CHKERRQ(ierr);
-        P_data(i) = (1.0 - omega) * P_data(i) + omega * P;
-    }
+    P_data(i) = (1.0 - omega) * P_data(i) + omega * e[BOX_CELL_DOF];
     return;
-} // copyFromVec
+} // updateFromBox
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -456,7 +288,6 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
 {
     if (num_sweeps == 0) return;
 
-    int ierr;
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
     const int U_error_idx = error.getComponentDescriptorIndex(0);
     const int P_error_idx = error.getComponentDescriptorIndex(1);
@@ -569,9 +400,8 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
         }
 
         // Smooth the error on the patches.
-        Vec& e = d_box_e[level_num];
-        Vec& r = d_box_r[level_num];
-        KSP& ksp = d_box_ksp[level_num];
+        const BoxMatrix& A_inv = d_box_inv[level_num];
+        BoxVector e, r;
         int patch_counter = 0;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
         {
@@ -599,13 +429,10 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
             for (Box<NDIM>::Iterator b(patch_box); b; b++)
             {
                 const hier::Index<NDIM>& i = b();
-                const Box<NDIM> box(i, i);
-                copyToVec(e, *U_error_data, *P_error_data, box, box);
-                copyToVec(r, *U_residual_data, *P_residual_data, box, box);
-                modifyRhsForBcs(r, *U_error_data, *P_error_data, d_U_problem_coefs, box, box, dx);
-                ierr = KSPSolve(ksp, r, e);
-                IBTK_CHKERRQ(ierr);
-                copyFromVec(e, *U_error_data, *P_error_data, box, box);
+                buildBoxRhs(
+                    r, *U_residual_data, *P_residual_data, *U_error_data, *P_error_data, d_U_problem_coefs, i, dx);
+                applyBoxInverse(e, A_inv, r);
+                updateFromBox(e, *U_error_data, *P_error_data, i);
             }
         }
     }
@@ -626,11 +453,9 @@ StaggeredStokesBoxRelaxationFACOperator::initializeOperatorStateSpecialized(cons
                                                                             const int finest_reset_ln)
 {
     // Initialize the box relaxation data on each level of the patch hierarchy.
-    d_box_op.resize(d_finest_ln + 1);
-    d_box_e.resize(d_finest_ln + 1);
-    d_box_r.resize(d_finest_ln + 1);
-    d_box_ksp.resize(d_finest_ln + 1);
-    const Box<NDIM> box(hier::Index<NDIM>(0), hier::Index<NDIM>(0));
+    // Because the box operator is the same for every cell on a level, it is
+    // factored and inverted once per level.
+    d_box_inv.resize(d_finest_ln + 1);
     Pointer<CartesianGridGeometry<NDIM> > geometry = d_hierarchy->getGridGeometry();
     const double* const dx_coarsest = geometry->getDx();
     std::array<double, NDIM> dx;
@@ -641,27 +466,9 @@ StaggeredStokesBoxRelaxationFACOperator::initializeOperatorStateSpecialized(cons
         {
             dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
         }
-        buildBoxOperator(d_box_op[ln], d_U_problem_coefs, box, box, dx);
-        int ierr;
-        ierr = MatCreateVecs(d_box_op[ln], &d_box_e[ln], &d_box_r[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPCreate(PETSC_COMM_SELF, &d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetOperators(d_box_ksp[ln], d_box_op[ln], d_box_op[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetReusePreconditioner(d_box_ksp[ln], PETSC_TRUE);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetType(d_box_ksp[ln], KSPPREONLY);
-        IBTK_CHKERRQ(ierr);
-        PC box_pc;
-        ierr = KSPGetPC(d_box_ksp[ln], &box_pc);
-        IBTK_CHKERRQ(ierr);
-        ierr = PCSetType(box_pc, PCLU);
-        IBTK_CHKERRQ(ierr);
-        ierr = PCFactorReorderForNonzeroDiagonal(box_pc, std::numeric_limits<double>::epsilon());
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetUp(d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
+        BoxMatrix A;
+        buildBoxOperator(A, d_U_problem_coefs, dx);
+        invertBoxOperator(d_box_inv[ln], A);
     }
 
     // Get overlap information for setting patch boundary conditions.
@@ -715,15 +522,6 @@ StaggeredStokesBoxRelaxationFACOperator::deallocateOperatorStateSpecialized(cons
     if (!d_is_initialized) return;
     for (int ln = coarsest_reset_ln; ln <= std::min(d_finest_ln, finest_reset_ln); ++ln)
     {
-        int ierr;
-        ierr = MatDestroy(&d_box_op[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecDestroy(&d_box_e[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecDestroy(&d_box_r[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPDestroy(&d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
         d_patch_side_bc_box_overlap[ln].resize(0);
         d_patch_cell_bc_box_overlap[ln].resize(0);
     }
@@ -358,6 +358,12 @@ StaggeredStokesOperator::deallocateOperatorState()
     return;
 } // deallocateOperatorState
 
+bool
+StaggeredStokesOperator::updateProblemCoefficients()
+{
+    return d_is_initialized;
+} // updateProblemCoefficients
+
 void
 StaggeredStokesOperator::modifyRhsForBcs(SAMRAIVectorReal<NDIM, double>& y)
 {
@@ -0,0 +1,285 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/boundary_info.h>
+#include <libmesh/equation_systems.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+#include <libmesh/numeric_vector.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEInstrumentPanel.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/muParserCartGridFunction.h>
+#include <ibtk/muParserRobinBcCoefs.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+/*
+ * Verify that IBFEInstrumentPanel gives the same flow rates and mean
+ * pressures when it reuses the assignment of the meter quadrature points to
+ * patches as when it recomputes the assignment every time. An elastic block,
+ * with two meters on cross sections, is carried around a lid-driven cavity,
+ * so the meters move at every time step. The hierarchy is regridded by the
+ * integrator and, in addition, once in the middle of the run. The panel that
+ * reuses the assignment is read twice after every step: the second read
+ * reuses the assignment computed by the first one.
+ */
+
+// Elasticity model data.
+namespace ModelData
+{
+static double c1_s = 0.05;
+
+// Stress tensor function.
+void
+PK1_stress_function(TensorValue<double>& PP,
+                    const TensorValue<double>& FF,
+                    const libMesh::Point& /*x*/,
+                    const libMesh::Point& /*X*/,
+                    Elem* const /*elem*/,
+                    const std::vector<const std::vector<double>*>& /*var_data*/,
+                    const std::vector<const std::vector<VectorValue<double> >*>& /*grad_var_data*/,
+                    double /*time*/,
+                    void* /*ctx*/)
+{
+    PP = 2.0 * c1_s * (FF - tensor_inverse_transpose(FF, NDIM));
+    return;
+} // PK1_stress_function
+} // namespace ModelData
+using namespace ModelData;
+
+namespace
+{
+// Set the coordinate mapping system to the current displacement of the
+// structure, which is what the instrument panel reads to locate the meters.
+void
+update_coordinate_mapping(EquationSystems& equation_systems)
+{
+    MeshBase& mesh = equation_systems.get_mesh();
+    System& X_system = equation_systems.get_system(IBFEMethod::COORDS_SYSTEM_NAME);
+    System& dX_system = equation_systems.get_system(IBFEMethod::COORD_MAPPING_SYSTEM_NAME);
+    const unsigned int X_sys_num = X_system.number();
+    const unsigned int dX_sys_num = dX_system.number();
+    const auto end_node = mesh.local_nodes_end();
+    for (auto node_it = mesh.local_nodes_begin(); node_it != end_node; ++node_it)
+    {
+        const Node* const node = *node_it;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const dof_id_type X_dof = node->dof_number(X_sys_num, d, 0);
+            const dof_id_type dX_dof = node->dof_number(dX_sys_num, d, 0);
+            dX_system.solution->set(dX_dof, (*X_system.solution)(X_dof) - (*node)(d));
+        }
+    }
+    dX_system.solution->close();
+    dX_system.update();
+}
+
+// Check that two sets of meter readings agree to the relative tolerance tol.
+bool
+readings_agree(const std::vector<double>& a, const std::vector<double>& b, const double tol)
+{
+    if (a.size() != b.size()) return false;
+    for (unsigned int k = 0; k < a.size(); ++k)
+    {
+        if (std::abs(a[k] - b[k]) > tol * std::max(std::abs(a[k]), 1.0)) return false;
+    }
+    return true;
+}
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize libMesh, PETSc, MPI, and SAMRAI.
+    LibMeshInit init(argc, argv);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        c1_s = input_db->getDouble("C1_S");
+
+        // Create a block-shaped FE mesh. The nodes on the lateral faces of
+        // two cross sections of the block form the meters.
+        const double ds = input_db->getDouble("MFAC") * input_db->getDouble("DX");
+        const double w = input_db->getDouble("BLOCK_WIDTH");
+        const double h = input_db->getDouble("BLOCK_HEIGHT");
+        const int n_x = static_cast<int>(std::ceil(w / ds));
+        const int n_z = 4 * static_cast<int>(std::ceil(h / (4.0 * ds)));
+        const double x_lo = 0.5 - 0.5 * w, x_up = 0.5 + 0.5 * w;
+        const double z_lo = 0.5 - 0.5 * h, z_up = 0.5 + 0.5 * h;
+        Mesh mesh(init.comm(), NDIM);
+        MeshTools::Generation::build_cube(mesh, n_x, n_x, n_z, x_lo, x_up, x_lo, x_up, z_lo, z_up, libMesh::HEX8);
+        const double eps = 1.0e-8 * w;
+        const std::vector<double> meter_z = { z_lo + 0.25 * h, z_lo + 0.75 * h };
+        const auto end_node = mesh.nodes_end();
+        for (auto node_it = mesh.nodes_begin(); node_it != end_node; ++node_it)
+        {
+            const Node* const node = *node_it;
+            const bool on_lateral_face = std::abs((*node)(0) - x_lo) < eps || std::abs((*node)(0) - x_up) < eps ||
+                                         std::abs((*node)(1) - x_lo) < eps || std::abs((*node)(1) - x_up) < eps;
+            for (unsigned int k = 0; k < meter_z.size(); ++k)
+            {
+                if (on_lateral_face && std::abs((*node)(2) - meter_z[k]) < eps)
+                    mesh.get_boundary_info().add_node(node, 10 + k);
+            }
+        }
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBFEMethod> ib_method_ops =
+            new IBFEMethod("IBFEMethod",
+                           app_initializer->getComponentDatabase("IBFEMethod"),
+                           &mesh,
+                           app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IBFE solver.
+        ib_method_ops->registerPK1StressFunction(IBFEMethod::PK1StressFcnData(PK1_stress_function));
+        ib_method_ops->initializeFEEquationSystems();
+        EquationSystems* equation_systems = ib_method_ops->getFEDataManager()->getEquationSystems();
+
+        // Create Eulerian initial and boundary condition specification objects.
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+        std::vector<RobinBcCoefStrategy<NDIM>*> u_bc_coefs(NDIM);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const std::string bc_coefs_name = "u_bc_coefs_" + std::to_string(d);
+            const std::string bc_coefs_db_name = "VelocityBcCoefs_" + std::to_string(d);
+            u_bc_coefs[d] = new muParserRobinBcCoefs(
+                bc_coefs_name, app_initializer->getComponentDatabase(bc_coefs_db_name), grid_geometry);
+        }
+        navier_stokes_integrator->registerPhysicalBoundaryConditions(u_bc_coefs);
+
+        // Initialize hierarchy configuration and data on all patches.
+        ib_method_ops->initializeFEData();
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Set up the two instrument panels: the first one reuses the
+        // assignment of quadrature points to patches and the second one
+        // recomputes it every time.
+        IBFEInstrumentPanel cached_panel(app_initializer->getComponentDatabase("CachedInstrumentPanel"), 0);
+        IBFEInstrumentPanel uncached_panel(app_initializer->getComponentDatabase("UncachedInstrumentPanel"), 0);
+
+        // Deallocate initialization objects.
+        app_initializer.setNull();
+
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        const int U_idx = var_db->mapVariableAndContextToIndex(navier_stokes_integrator->getVelocityVariable(),
+                                                               navier_stokes_integrator->getCurrentContext());
+        const int P_idx = var_db->mapVariableAndContextToIndex(navier_stokes_integrator->getPressureVariable(),
+                                                               navier_stokes_integrator->getCurrentContext());
+
+        // Read both panels after every time step and compare the results.
+        const double tol = input_db->getDouble("TOL");
+        const int n_steps = input_db->getInteger("NUM_STEPS");
+        bool flow_agrees = true, pressure_agrees = true, meters_moved = false;
+        double loop_time = time_integrator->getIntegratorTime();
+        for (int step = 1; step <= n_steps; ++step)
+        {
+            const double dt = time_integrator->getMaximumTimeStepSize();
+            time_integrator->advanceHierarchy(dt);
+            loop_time += dt;
+            if (step == n_steps / 2) time_integrator->regridHierarchy();
+            update_coordinate_mapping(*equation_systems);
+            meters_moved = meters_moved ||
+                           equation_systems->get_system(IBFEMethod::COORD_MAPPING_SYSTEM_NAME).solution->linfty_norm() >
+                               0.0;
+
+            uncached_panel.initializeHierarchyDependentData(ib_method_ops.getPointer(), patch_hierarchy);
+            uncached_panel.readInstrumentData(U_idx, P_idx, patch_hierarchy, loop_time);
+            for (int read = 0; read < 2; ++read)
+            {
+                cached_panel.initializeHierarchyDependentData(ib_method_ops.getPointer(), patch_hierarchy);
+                cached_panel.readInstrumentData(U_idx, P_idx, patch_hierarchy, loop_time);
+                flow_agrees = flow_agrees &&
+                              readings_agree(cached_panel.getFlowValues(), uncached_panel.getFlowValues(), tol);
+                pressure_agrees =
+                    pressure_agrees &&
+                    readings_agree(cached_panel.getMeanPressureValues(), uncached_panel.getMeanPressureValues(), tol);
+            }
+        }
+
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "number of meters: " << cached_panel.getNumberOfMeterMeshes() << '\n';
+            out << "meters moved: " << meters_moved << '\n';
+            out << "cached and uncached flow rates agree: " << flow_agrees << '\n';
+            out << "cached and uncached mean pressures agree: " << pressure_agrees << '\n';
+        }
+
+        for (unsigned int d = 0; d < NDIM; ++d) delete u_bc_coefs[d];
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+} // main
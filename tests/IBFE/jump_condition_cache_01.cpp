@@ -0,0 +1,204 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+#include <libmesh/periodic_boundary.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/StableCentroidPartitioner.h>
+
+#include <fstream>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+/*
+ * Verify that the grid line intersections used to impose jump conditions are
+ * reused while the structure has moved by less than
+ * jump_condition_intersection_cache_tol and are recomputed otherwise. The
+ * structure is the pressurized ring used by explicit_ex1.
+ */
+
+// Elasticity model data.
+namespace ModelData
+{
+// Problem parameters.
+static const double R = 0.25;
+static const double w = 0.0625;
+static const double gamma = 0.15;
+static const double mu = 1.0;
+
+// Coordinate mapping function.
+void
+coordinate_mapping_function(libMesh::Point& X, const libMesh::Point& s, void* /*ctx*/)
+{
+    X(0) = (R + s(1)) * cos(s(0) / R) + 0.5;
+    X(1) = (R + gamma + s(1)) * sin(s(0) / R) + 0.5;
+    return;
+} // coordinate_mapping_function
+
+// Stress tensor function.
+void
+PK1_stress_function(TensorValue<double>& PP,
+                    const TensorValue<double>& FF,
+                    const libMesh::Point& /*X*/,
+                    const libMesh::Point& /*s*/,
+                    Elem* const /*elem*/,
+                    const std::vector<const std::vector<double>*>& /*var_data*/,
+                    const std::vector<const std::vector<VectorValue<double> >*>& /*grad_var_data*/,
+                    double /*time*/,
+                    void* /*ctx*/)
+{
+    PP = (mu / w) * FF;
+    return;
+} // PK1_stress_function
+} // namespace ModelData
+using namespace ModelData;
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize libMesh, PETSc, MPI, and SAMRAI.
+    LibMeshInit init(argc, argv);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create a ring-shaped FE mesh with periodic boundary conditions in
+        // the "x" direction.
+        Mesh mesh(init.comm(), NDIM);
+        const double ds = input_db->getDouble("MFAC") * input_db->getDouble("DX");
+        const int n_x = ceil(2.0 * M_PI * R / ds);
+        const int n_y = ceil(w / ds);
+        MeshTools::Generation::build_square(mesh,
+                                            n_x,
+                                            n_y,
+                                            0.0,
+                                            2.0 * M_PI * R,
+                                            0.0,
+                                            w,
+                                            Utility::string_to_enum<ElemType>(input_db->getString("ELEM_TYPE")));
+        IBTK::StableCentroidPartitioner partitioner;
+        partitioner.partition(mesh);
+
+        VectorValue<double> boundary_translation(2.0 * M_PI * R, 0.0, 0.0);
+        PeriodicBoundary pbc(boundary_translation);
+        pbc.myboundary = 3;
+        pbc.pairedboundary = 1;
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBFEMethod> ib_method_ops =
+            new IBFEMethod("IBFEMethod",
+                           app_initializer->getComponentDatabase("IBFEMethod"),
+                           &mesh,
+                           app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IBFE solver.
+        ib_method_ops->initializeFEEquationSystems();
+        ib_method_ops->registerInitialCoordinateMappingFunction(coordinate_mapping_function);
+        ib_method_ops->registerPK1StressFunction(IBFEMethod::PK1StressFcnData(PK1_stress_function));
+
+        // Initialize hierarchy configuration and data on all patches.
+        EquationSystems* equation_systems = ib_method_ops->getFEDataManager()->getEquationSystems();
+        for (unsigned int k = 0; k < equation_systems->n_systems(); ++k)
+        {
+            System& system = equation_systems->get_system(k);
+            system.get_dof_map().add_periodic_boundary(pbc);
+        }
+        ib_method_ops->initializeFEData();
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        app_initializer.setNull();
+
+        // Take one time step to populate the cache and then record how many
+        // of the remaining time steps had to recompute the intersections.
+        time_integrator->advanceHierarchy(time_integrator->getMaximumTimeStepSize());
+        const unsigned int n_impositions_0 = ib_method_ops->getNumJumpConditionImpositions();
+        const unsigned int n_searches_0 = ib_method_ops->getNumJumpConditionIntersectionSearches();
+        const int n_steps = input_db->getInteger("NUM_STEPS");
+        for (int step = 1; step < n_steps; ++step)
+        {
+            time_integrator->advanceHierarchy(time_integrator->getMaximumTimeStepSize());
+        }
+        const unsigned int n_impositions = ib_method_ops->getNumJumpConditionImpositions() - n_impositions_0;
+        const unsigned int n_searches = ib_method_ops->getNumJumpConditionIntersectionSearches() - n_searches_0;
+
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "jump_condition_intersection_cache_tol = "
+                << input_db->getDatabase("IBFEMethod")->getDouble("jump_condition_intersection_cache_tol") << '\n';
+            out << "jump conditions imposed after the first time step: " << (n_impositions >= 1) << '\n';
+            out << "intersections recomputed every time: " << (n_searches == n_impositions) << '\n';
+            out << "intersections reused every time: " << (n_searches == 0) << '\n';
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+} // main
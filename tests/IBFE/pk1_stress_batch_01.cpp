@@ -0,0 +1,266 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+#include <libmesh/numeric_vector.h>
+#include <libmesh/periodic_boundary.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/StableCentroidPartitioner.h>
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+/*
+ * Verify that a batched PK1 stress function gives the same forces as the
+ * equivalent pointwise function. Two copies of the pressurized ring used by
+ * explicit_ex1 are placed on top of each other: the first registers the
+ * pointwise function and the second registers the batched one. Since both
+ * parts see the same fluid velocity, their forces and positions must agree at
+ * every time step. The input files select either split forces (which
+ * exercise the boundary terms of the interior force and the transmission
+ * force) or jump conditions.
+ */
+
+// Elasticity model data.
+namespace ModelData
+{
+// Problem parameters.
+static const double R = 0.25;
+static const double w = 0.0625;
+static const double gamma = 0.15;
+static const double mu = 1.0;
+
+// Coordinate mapping function.
+void
+coordinate_mapping_function(libMesh::Point& X, const libMesh::Point& s, void* /*ctx*/)
+{
+    X(0) = (R + s(1)) * cos(s(0) / R) + 0.5;
+    X(1) = (R + gamma + s(1)) * sin(s(0) / R) + 0.5;
+    return;
+} // coordinate_mapping_function
+
+// Stress tensor function: a neo-Hookean material whose shear modulus varies
+// with the reference coordinates, so that the test also checks that the
+// batched function sees the right point.
+void
+PK1_stress_function(TensorValue<double>& PP,
+                    const TensorValue<double>& FF,
+                    const libMesh::Point& /*x*/,
+                    const libMesh::Point& X,
+                    Elem* const /*elem*/,
+                    const std::vector<const std::vector<double>*>& /*var_data*/,
+                    const std::vector<const std::vector<VectorValue<double> >*>& /*grad_var_data*/,
+                    double /*time*/,
+                    void* /*ctx*/)
+{
+    PP = (mu / w) * (1.0 + X(1) / w) * (FF - tensor_inverse_transpose(FF, NDIM));
+    return;
+} // PK1_stress_function
+
+// The same stress function, evaluated at all quadrature points at once.
+void
+PK1_stress_batch_function(TensorValue<double>* PP,
+                          const TensorValue<double>* FF,
+                          const libMesh::Point* x,
+                          const libMesh::Point* X,
+                          const unsigned int n_qp,
+                          Elem* const elem,
+                          const std::vector<std::vector<const std::vector<double>*> >& var_data,
+                          const std::vector<std::vector<const std::vector<VectorValue<double> >*> >& grad_var_data,
+                          double time,
+                          void* ctx)
+{
+    TBOX_ASSERT(var_data.size() >= n_qp);
+    TBOX_ASSERT(grad_var_data.size() >= n_qp);
+    for (unsigned int qp = 0; qp < n_qp; ++qp)
+    {
+        PK1_stress_function(PP[qp], FF[qp], x[qp], X[qp], elem, var_data[qp], grad_var_data[qp], time, ctx);
+    }
+    return;
+} // PK1_stress_batch_function
+} // namespace ModelData
+using namespace ModelData;
+
+namespace
+{
+// Return the max norm of the difference between the solutions of the named
+// system on parts 0 and 1, relative to the max norm of the solution on part 0.
+double
+relative_part_difference(IBFEMethod& ib_method_ops, const std::string& system_name)
+{
+    const NumericVector<double>& u0 =
+        *ib_method_ops.getFEDataManager(0)->getEquationSystems()->get_system(system_name).solution;
+    const NumericVector<double>& u1 =
+        *ib_method_ops.getFEDataManager(1)->getEquationSystems()->get_system(system_name).solution;
+    std::unique_ptr<NumericVector<double> > diff = u0.clone();
+    diff->add(-1.0, u1);
+    return diff->linfty_norm() / std::max(u0.linfty_norm(), 1.0e-300);
+}
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize libMesh, PETSc, MPI, and SAMRAI.
+    LibMeshInit init(argc, argv);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create two identical ring-shaped FE meshes with periodic boundary
+        // conditions in the "x" direction.
+        const double ds = input_db->getDouble("MFAC") * input_db->getDouble("DX");
+        const int n_x = ceil(2.0 * M_PI * R / ds);
+        const int n_y = ceil(w / ds);
+        Mesh mesh_0(init.comm(), NDIM), mesh_1(init.comm(), NDIM);
+        IBTK::StableCentroidPartitioner partitioner;
+        for (Mesh* mesh : { &mesh_0, &mesh_1 })
+        {
+            MeshTools::Generation::build_square(*mesh,
+                                                n_x,
+                                                n_y,
+                                                0.0,
+                                                2.0 * M_PI * R,
+                                                0.0,
+                                                w,
+                                                Utility::string_to_enum<ElemType>(input_db->getString("ELEM_TYPE")));
+            partitioner.partition(*mesh);
+        }
+
+        VectorValue<double> boundary_translation(2.0 * M_PI * R, 0.0, 0.0);
+        PeriodicBoundary pbc(boundary_translation);
+        pbc.myboundary = 3;
+        pbc.pairedboundary = 1;
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBFEMethod> ib_method_ops =
+            new IBFEMethod("IBFEMethod",
+                           app_initializer->getComponentDatabase("IBFEMethod"),
+                           std::vector<MeshBase*>{ &mesh_0, &mesh_1 },
+                           app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IBFE solver. Part 0 uses the pointwise stress function
+        // and part 1 uses the batched one.
+        ib_method_ops->initializeFEEquationSystems();
+        for (unsigned int part = 0; part < 2; ++part)
+        {
+            ib_method_ops->registerInitialCoordinateMappingFunction(coordinate_mapping_function, part);
+        }
+        ib_method_ops->registerPK1StressFunction(IBFEMethod::PK1StressFcnData(PK1_stress_function), 0);
+        ib_method_ops->registerPK1StressFunction(IBFEMethod::PK1StressFcnData(PK1_stress_batch_function), 1);
+
+        // Initialize hierarchy configuration and data on all patches.
+        for (unsigned int part = 0; part < 2; ++part)
+        {
+            EquationSystems* equation_systems = ib_method_ops->getFEDataManager(part)->getEquationSystems();
+            for (unsigned int k = 0; k < equation_systems->n_systems(); ++k)
+            {
+                System& system = equation_systems->get_system(k);
+                system.get_dof_map().add_periodic_boundary(pbc);
+            }
+        }
+        ib_method_ops->initializeFEData();
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        app_initializer.setNull();
+
+        // Compare the forces and positions of the two parts after every time
+        // step.
+        const double tol = input_db->getDouble("TOL");
+        bool forces_agree = true, positions_agree = true;
+        const int n_steps = input_db->getInteger("NUM_STEPS");
+        for (int step = 0; step < n_steps; ++step)
+        {
+            time_integrator->advanceHierarchy(time_integrator->getMaximumTimeStepSize());
+            forces_agree =
+                forces_agree && relative_part_difference(*ib_method_ops, IBFEMethod::FORCE_SYSTEM_NAME) <= tol;
+            positions_agree =
+                positions_agree && relative_part_difference(*ib_method_ops, IBFEMethod::COORDS_SYSTEM_NAME) <= tol;
+        }
+
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "split_forces = " << input_db->getDatabase("IBFEMethod")->getBool("split_forces") << '\n';
+            out << "use_jump_conditions = " << input_db->getDatabase("IBFEMethod")->getBool("use_jump_conditions")
+                << '\n';
+            out << "batched and pointwise forces agree: " << forces_agree << '\n';
+            out << "batched and pointwise positions agree: " << positions_agree << '\n';
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+} // main
@@ -0,0 +1,247 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+#include <libmesh/periodic_boundary.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/StableCentroidPartitioner.h>
+
+#include <cmath>
+#include <fstream>
+#include <limits>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+/*
+ * Verify that the workload weights computed by IBFEMethod's workload
+ * calibration are saved in restart files: a restarted run must use the
+ * calibrated weights and must not calibrate again. The structure is the
+ * pressurized ring used by explicit_ex1.
+ */
+
+// Elasticity model data.
+namespace ModelData
+{
+// Problem parameters.
+static const double R = 0.25;
+static const double w = 0.0625;
+static const double gamma = 0.15;
+static const double mu = 1.0;
+
+// Coordinate mapping function.
+void
+coordinate_mapping_function(libMesh::Point& X, const libMesh::Point& s, void* /*ctx*/)
+{
+    X(0) = (R + s(1)) * cos(s(0) / R) + 0.5;
+    X(1) = (R + gamma + s(1)) * sin(s(0) / R) + 0.5;
+    return;
+} // coordinate_mapping_function
+
+// Stress tensor function.
+void
+PK1_stress_function(TensorValue<double>& PP,
+                    const TensorValue<double>& FF,
+                    const libMesh::Point& /*X*/,
+                    const libMesh::Point& /*s*/,
+                    Elem* const /*elem*/,
+                    const std::vector<const std::vector<double>*>& /*var_data*/,
+                    const std::vector<const std::vector<VectorValue<double> >*>& /*grad_var_data*/,
+                    double /*time*/,
+                    void* /*ctx*/)
+{
+    PP = (mu / w) * FF;
+    return;
+} // PK1_stress_function
+} // namespace ModelData
+using namespace ModelData;
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize libMesh, PETSc, MPI, and SAMRAI.
+    LibMeshInit init(argc, argv);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const bool from_restart = RestartManager::getManager()->isFromRestart();
+        const int restart_dump_interval = app_initializer->getRestartDumpInterval();
+        const string restart_dump_dirname = app_initializer->getRestartDumpDirectory();
+        const string restart_read_dirname = app_initializer->getRestartReadDirectory();
+        const int restart_restore_num = app_initializer->getRestartRestoreNumber();
+
+        // Create a ring-shaped FE mesh with periodic boundary conditions in
+        // the "x" direction.
+        Mesh mesh(init.comm(), NDIM);
+        const double ds = input_db->getDouble("MFAC") * input_db->getDouble("DX");
+        const int n_x = ceil(2.0 * M_PI * R / ds);
+        const int n_y = ceil(w / ds);
+        MeshTools::Generation::build_square(mesh,
+                                            n_x,
+                                            n_y,
+                                            0.0,
+                                            2.0 * M_PI * R,
+                                            0.0,
+                                            w,
+                                            Utility::string_to_enum<ElemType>(input_db->getString("ELEM_TYPE")));
+        IBTK::StableCentroidPartitioner partitioner;
+        partitioner.partition(mesh);
+
+        VectorValue<double> boundary_translation(2.0 * M_PI * R, 0.0, 0.0);
+        PeriodicBoundary pbc(boundary_translation);
+        pbc.myboundary = 3;
+        pbc.pairedboundary = 1;
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBFEMethod> ib_method_ops =
+            new IBFEMethod("IBFEMethod",
+                           app_initializer->getComponentDatabase("IBFEMethod"),
+                           &mesh,
+                           app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"),
+                           /*register_for_restart*/ true,
+                           restart_read_dirname,
+                           restart_restore_num);
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IBFE solver.
+        ib_method_ops->initializeFEEquationSystems();
+        ib_method_ops->registerInitialCoordinateMappingFunction(coordinate_mapping_function);
+        ib_method_ops->registerPK1StressFunction(IBFEMethod::PK1StressFcnData(PK1_stress_function));
+
+        // Initialize hierarchy configuration and data on all patches.
+        EquationSystems* equation_systems = ib_method_ops->getFEDataManager()->getEquationSystems();
+        for (unsigned int k = 0; k < equation_systems->n_systems(); ++k)
+        {
+            System& system = equation_systems->get_system(k);
+            system.get_dof_map().add_periodic_boundary(pbc);
+        }
+        ib_method_ops->initializeFEData();
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        app_initializer.setNull();
+
+        // The first run saves the calibrated weight next to the restart
+        // files so that the restarted run can check it.
+        const std::string weight_file_name = restart_dump_dirname + "/calibrated_weight.txt";
+        const double input_weight =
+            input_db->getDatabase("IBFEMethod")->getDouble("workload_quad_point_weight");
+        double restored_weight = std::numeric_limits<double>::quiet_NaN();
+        double calibrated_weight = std::numeric_limits<double>::quiet_NaN();
+        if (from_restart)
+        {
+            restored_weight = ib_method_ops->getFEDataManager()->getWorkloadSpec().q_point_weight;
+            std::ifstream weight_file(weight_file_name);
+            weight_file >> calibrated_weight;
+        }
+
+        // Main time step loop.
+        const double loop_time_end = time_integrator->getEndTime();
+        double loop_time = time_integrator->getIntegratorTime();
+        while (!MathUtilities<double>::equalEps(loop_time, loop_time_end) && time_integrator->stepsRemaining())
+        {
+            const double dt = time_integrator->getMaximumTimeStepSize();
+            time_integrator->advanceHierarchy(dt);
+            loop_time += dt;
+
+            const int iteration_num = time_integrator->getIntegratorStep();
+            if (iteration_num % restart_dump_interval == 0)
+            {
+                RestartManager::getManager()->writeRestartFile(restart_dump_dirname, iteration_num);
+                ib_method_ops->writeFEDataToRestartFile(restart_dump_dirname, iteration_num);
+                if (!from_restart && SAMRAI_MPI::getRank() == 0)
+                {
+                    std::ofstream weight_file(weight_file_name);
+                    weight_file.precision(17);
+                    weight_file << ib_method_ops->getFEDataManager()->getWorkloadSpec().q_point_weight << '\n';
+                }
+            }
+        }
+        const double final_weight = ib_method_ops->getFEDataManager()->getWorkloadSpec().q_point_weight;
+
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            if (from_restart)
+            {
+                out << "calibrated weight differs from the input weight: " << (calibrated_weight != input_weight)
+                    << '\n';
+                out << "calibrated weight restored from restart: "
+                    << (std::abs(restored_weight - calibrated_weight) <= 1.0e-12 * std::abs(calibrated_weight))
+                    << '\n';
+                out << "calibrated weight unchanged after restart: " << (final_weight == restored_weight) << '\n';
+            }
+            else
+            {
+                out << "calibrated weight differs from the input weight: " << (final_weight != input_weight) << '\n';
+            }
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+} // main
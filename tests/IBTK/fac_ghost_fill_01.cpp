@@ -0,0 +1,245 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCLaplaceOperator.h>
+#include <ibtk/CCPoissonPointRelaxationFACOperator.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/PoissonFACPreconditioner.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Compare the red-black Gauss-Seidel FAC preconditioner that exchanges ghost
+// cell values before every half-sweep with the one that exchanges them once
+// every ghost_fill_interval half-sweeps. Without physical boundaries or
+// coarse-fine interfaces the two must agree to round-off. With coarse-fine
+// interfaces, the V-cycle convergence rate of the stationary iteration
+//
+//    u <- u + B (f - A u)
+//
+// must be comparable.
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "fac_ghost_fill.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_cc");
+        Pointer<CellVariable<NDIM, double> > f_cc_var = new CellVariable<NDIM, double>("f_cc");
+        Pointer<CellVariable<NDIM, double> > r_cc_var = new CellVariable<NDIM, double>("r_cc");
+        Pointer<CellVariable<NDIM, double> > g_cc_var = new CellVariable<NDIM, double>("g_cc");
+        Pointer<CellVariable<NDIM, double> > e_cc_var = new CellVariable<NDIM, double>("e_cc");
+        Pointer<CellVariable<NDIM, double> > e_ref_cc_var = new CellVariable<NDIM, double>("e_ref_cc");
+
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, ctx, IntVector<NDIM>(1));
+        const int f_cc_idx = var_db->registerVariableAndContext(f_cc_var, ctx, IntVector<NDIM>(1));
+        const int r_cc_idx = var_db->registerVariableAndContext(r_cc_var, ctx, IntVector<NDIM>(1));
+        const int g_cc_idx = var_db->registerVariableAndContext(g_cc_var, ctx, IntVector<NDIM>(1));
+        const int e_cc_idx = var_db->registerVariableAndContext(e_cc_var, ctx, IntVector<NDIM>(1));
+        const int e_ref_cc_idx = var_db->registerVariableAndContext(e_ref_cc_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+
+        // Allocate data on each level of the patch hierarchy.
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_cc_idx, 0.0);
+            level->allocatePatchData(f_cc_idx, 0.0);
+            level->allocatePatchData(r_cc_idx, 0.0);
+            level->allocatePatchData(g_cc_idx, 0.0);
+            level->allocatePatchData(e_cc_idx, 0.0);
+            level->allocatePatchData(e_ref_cc_idx, 0.0);
+        }
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+        SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> r_vec("r", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> g_vec("g", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> e_vec("e", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> e_ref_vec("e_ref", patch_hierarchy, 0, finest_ln);
+
+        u_vec.addComponent(u_cc_var, u_cc_idx, h_cc_idx);
+        f_vec.addComponent(f_cc_var, f_cc_idx, h_cc_idx);
+        r_vec.addComponent(r_cc_var, r_cc_idx, h_cc_idx);
+        g_vec.addComponent(g_cc_var, g_cc_idx, h_cc_idx);
+        e_vec.addComponent(e_cc_var, e_cc_idx, h_cc_idx);
+        e_ref_vec.addComponent(e_ref_cc_var, e_ref_cc_idx, h_cc_idx);
+
+        Pointer<SAMRAIVectorReal<NDIM, double> > u_ptr(&u_vec, false);
+        Pointer<SAMRAIVectorReal<NDIM, double> > f_ptr(&f_vec, false);
+        Pointer<SAMRAIVectorReal<NDIM, double> > r_ptr(&r_vec, false);
+        Pointer<SAMRAIVectorReal<NDIM, double> > e_ptr(&e_vec, false);
+        Pointer<SAMRAIVectorReal<NDIM, double> > e_ref_ptr(&e_ref_vec, false);
+
+        // Setup the right-hand side and ensure that it has no components in
+        // the nullspace of the operator.
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        f_fcn.setDataOnPatchHierarchy(f_cc_idx, f_cc_var, patch_hierarchy, 0.0);
+        r_vec.setToScalar(1.0);
+        f_vec.addScalar(f_ptr, -f_vec.dot(r_ptr) / r_vec.dot(r_ptr));
+
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCZero();
+        poisson_spec.setDConstant(-1.0);
+        RobinBcCoefStrategy<NDIM>* bc_coef = NULL;
+        CCLaplaceOperator laplace_op("laplace_op");
+        laplace_op.setPoissonSpecifications(poisson_spec);
+        laplace_op.setPhysicalBcCoef(bc_coef);
+        laplace_op.initializeOperatorState(u_vec, f_vec);
+
+        Pointer<Database> precond_db = input_db->getDatabase("precond_db");
+        const bool compare_solutions = input_db->getBool("compare_solutions");
+        const int num_cycles = input_db->getInteger("num_cycles");
+        const int num_intervals = input_db->getArraySize("ghost_fill_intervals");
+        std::vector<int> ghost_fill_intervals(num_intervals);
+        input_db->getIntegerArray("ghost_fill_intervals", ghost_fill_intervals.data(), num_intervals);
+        ghost_fill_intervals.insert(ghost_fill_intervals.begin(), 1);
+
+        std::ofstream out;
+        if (SAMRAI_MPI::getRank() == 0) out.open("output");
+
+        double ref_rate = 0.0;
+        for (const int ghost_fill_interval : ghost_fill_intervals)
+        {
+            const std::string suffix = "_" + std::to_string(ghost_fill_interval);
+            Pointer<CCPoissonPointRelaxationFACOperator> fac_op =
+                new CCPoissonPointRelaxationFACOperator("fac_op" + suffix, precond_db, "");
+            fac_op->setGhostFillInterval(ghost_fill_interval);
+            Pointer<PoissonFACPreconditioner> fac_pc =
+                new PoissonFACPreconditioner("fac_pc" + suffix, fac_op, precond_db, "");
+            fac_pc->setPoissonSpecifications(poisson_spec);
+            fac_pc->setPhysicalBcCoef(bc_coef);
+            fac_pc->initializeSolverState(u_vec, f_vec);
+
+            // Apply a single V-cycle to the right-hand side.
+            g_vec.copyVector(f_ptr);
+            fac_pc->solveSystem(e_vec, g_vec);
+            const std::string prefix = "ghost_fill_interval = " + std::to_string(ghost_fill_interval) + ": ";
+            if (ghost_fill_interval == 1)
+            {
+                e_ref_vec.copyVector(e_ptr);
+            }
+            else if (compare_solutions)
+            {
+                e_vec.subtract(e_ptr, e_ref_ptr);
+                const double rel_diff = e_vec.maxNorm() / e_ref_vec.maxNorm();
+                plog << prefix << "relative difference after one V-cycle = " << rel_diff << "\n";
+                out << prefix << "one V-cycle agrees with ghost_fill_interval = 1: " << (rel_diff < 1.0e-12) << "\n";
+            }
+
+            // Run the stationary iteration and record the average residual
+            // reduction per cycle.
+            u_vec.setToScalar(0.0);
+            r_vec.copyVector(f_ptr);
+            const double r0_norm = r_vec.L2Norm();
+            for (int cycle = 0; cycle < num_cycles; ++cycle)
+            {
+                g_vec.copyVector(r_ptr);
+                fac_pc->solveSystem(e_vec, g_vec);
+                u_vec.add(u_ptr, e_ptr);
+                laplace_op.apply(u_vec, r_vec);
+                r_vec.subtract(f_ptr, r_ptr);
+            }
+            const double rate = std::pow(r_vec.L2Norm() / r0_norm, 1.0 / num_cycles);
+            plog << prefix << "convergence rate = " << rate << "\n";
+            out << prefix << "residual reduced: " << (rate < 1.0) << "\n";
+            if (ghost_fill_interval == 1)
+            {
+                ref_rate = rate;
+            }
+            else
+            {
+                out << prefix << "convergence rate comparable to ghost_fill_interval = 1: "
+                    << (rate <= 1.1 * ref_rate + 0.01) << "\n";
+            }
+
+            fac_pc->deallocateSolverState();
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,163 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/dense_vector.h>
+#include <libmesh/dof_map.h>
+#include <libmesh/equation_systems.h>
+#include <libmesh/explicit_system.h>
+#include <libmesh/fe_base.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+#include <libmesh/petsc_linear_solver.h>
+#include <libmesh/petsc_vector.h>
+#include <libmesh/quadrature.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/FEProjector.h>
+#include <ibtk/ibtk_enums.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify that the Cholesky and Chebyshev L2 projection solvers compute the
+// same projections as a tightly converged CG solve.
+
+double
+relative_difference(PetscVector<double>& u, PetscVector<double>& v)
+{
+    std::unique_ptr<NumericVector<double> > diff = u.clone();
+    diff->add(-1.0, v);
+    return diff->l2_norm() / v.l2_norm();
+}
+
+void
+test(LibMeshInit& init, const ElemType elem_type, const Order order)
+{
+    const std::string system_name = "projection system";
+    const double tol = 1.0e-12;
+    const unsigned int max_its = 1000;
+
+    ReplicatedMesh mesh(init.comm(), NDIM);
+    MeshTools::Generation::build_square(mesh, 8, 8, 0.0, 1.0, 0.0, 2.0, elem_type);
+
+    EquationSystems equation_systems(mesh);
+    auto& system = equation_systems.add_system<ExplicitSystem>(system_name);
+    system.add_variable("u", order, LAGRANGE);
+    equation_systems.init();
+
+    // Assemble the right-hand side of the projection of a smooth function.
+    const DofMap& dof_map = system.get_dof_map();
+    const FEType fe_type = dof_map.variable_type(0);
+    std::unique_ptr<QBase> qrule = fe_type.default_quadrature_rule(NDIM);
+    std::unique_ptr<FEBase> fe = FEBase::build(NDIM, fe_type);
+    fe->attach_quadrature_rule(qrule.get());
+    const std::vector<double>& JxW = fe->get_JxW();
+    const std::vector<std::vector<double> >& phi = fe->get_phi();
+    const std::vector<libMesh::Point>& q_point = fe->get_xyz();
+
+    std::unique_ptr<NumericVector<double> > F = system.solution->zero_clone();
+    std::vector<dof_id_type> dof_indices;
+    DenseVector<double> F_e;
+    for (auto el_it = mesh.active_local_elements_begin(); el_it != mesh.active_local_elements_end(); ++el_it)
+    {
+        const Elem* const elem = *el_it;
+        fe->reinit(elem);
+        dof_map.dof_indices(elem, dof_indices);
+        F_e.resize(static_cast<unsigned int>(dof_indices.size()));
+        for (unsigned int qp = 0; qp < qrule->n_points(); ++qp)
+        {
+            const double f = std::sin(2.0 * M_PI * q_point[qp](0)) * std::cos(M_PI * q_point[qp](1)) +
+                             q_point[qp](0) * q_point[qp](1);
+            for (unsigned int i = 0; i < phi.size(); ++i) F_e(i) += f * phi[i][qp] * JxW[qp];
+        }
+        F->add_vector(F_e, dof_indices);
+    }
+    F->close();
+    auto& F_vec = dynamic_cast<PetscVector<double>&>(*F);
+
+    // Compute the reference solution with CG and a Jacobi preconditioner.
+    std::unique_ptr<NumericVector<double> > U_ref = system.solution->zero_clone();
+    auto& U_ref_vec = dynamic_cast<PetscVector<double>&>(*U_ref);
+    {
+        FEProjector projector(&equation_systems, /*enable_logging*/ false);
+        TBOX_ASSERT(projector.getL2ProjectionSolverType() == L2_PROJECTION_KRYLOV);
+        KSP ksp = projector.buildL2ProjectionSolver(system_name).first->ksp();
+        int ierr = KSPSetType(ksp, KSPCG);
+        IBTK_CHKERRQ(ierr);
+        PC pc;
+        ierr = KSPGetPC(ksp, &pc);
+        IBTK_CHKERRQ(ierr);
+        ierr = PCSetType(pc, PCJACOBI);
+        IBTK_CHKERRQ(ierr);
+        const bool converged =
+            projector.computeL2Projection(U_ref_vec, F_vec, system_name, true, true, false, tol, max_its);
+        plog << IBTK::enum_to_string(L2_PROJECTION_KRYLOV) << " converged: " << converged << '\n';
+    }
+
+    // Use the same projector for both solver types: switching types must
+    // discard the previously built solver.
+    FEProjector projector(&equation_systems, /*enable_logging*/ false);
+    for (const L2ProjectionSolverType solver_type : { L2_PROJECTION_CHOLESKY, L2_PROJECTION_CHEBYSHEV })
+    {
+        projector.setL2ProjectionSolverType(solver_type);
+        std::unique_ptr<NumericVector<double> > U = system.solution->zero_clone();
+        auto& U_vec = dynamic_cast<PetscVector<double>&>(*U);
+        const bool converged =
+            projector.computeL2Projection(U_vec, F_vec, system_name, true, true, false, tol, max_its);
+        plog << IBTK::enum_to_string(solver_type) << " converged: " << converged << '\n';
+        plog << IBTK::enum_to_string(solver_type)
+             << " agrees with CG: " << (relative_difference(U_vec, U_ref_vec) < 1.0e-8) << '\n';
+    }
+
+    // A Chebyshev solve limited to a single iteration cannot reach the
+    // tolerance and must say so.
+    {
+        std::unique_ptr<NumericVector<double> > U = system.solution->zero_clone();
+        auto& U_vec = dynamic_cast<PetscVector<double>&>(*U);
+        const bool converged = projector.computeL2Projection(U_vec, F_vec, system_name, true, true, false, tol, 1);
+        plog << IBTK::enum_to_string(L2_PROJECTION_CHEBYSHEV) << " converged with one iteration: " << converged
+             << '\n';
+    }
+}
+
+int
+main(int argc, char** argv)
+{
+    LibMeshInit init(argc, argv);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+
+        plog << "Test 1: QUAD4" << std::endl;
+        test(init, QUAD4, FIRST);
+
+        plog << "Test 2: QUAD9" << std::endl;
+        test(init, QUAD9, SECOND);
+
+        plog << "Test 3: TRI6" << std::endl;
+        test(init, TRI6, SECOND);
+    }
+
+    SAMRAIManager::shutdown();
+} // main
@@ -150,6 +150,54 @@ test(LibMeshInit& init, const MeshType mesh_type = MeshType::libmesh)
             }
         }
     }
+
+    // Batched values should match the unbatched ones, lane by lane:
+    std::unique_ptr<QBase> quad_3 = QBase::build(QGAUSS, dim, THIRD);
+    IBTK::FEValuesBatch<dim> ibtk_fe_batch(quad_3.get(),
+                                           IBTK::update_quadrature_points | IBTK::update_JxW | IBTK::update_dphi);
+    std::vector<const Elem*> elems;
+    for (auto elem_iter = mesh.active_local_elements_begin(); elem_iter != mesh.active_local_elements_end();
+         ++elem_iter)
+    {
+        elems.push_back(*elem_iter);
+    }
+    const unsigned int width = IBTK::FEValuesBatch<dim>::batch_width;
+    for (std::size_t e = 0; e < elems.size(); e += width)
+    {
+        const unsigned int n_elems = std::min<std::size_t>(width, elems.size() - e);
+        ibtk_fe_batch.reinit(&elems[e], n_elems);
+        TBOX_ASSERT(ibtk_fe_batch.getNumberOfElements() == n_elems);
+        for (unsigned int l = 0; l < n_elems; ++l)
+        {
+            ibtk_fe.reinit(elems[e + l]);
+            const double tol = mesh_type == MeshType::readin ? 1e-11 : 1e-12;
+
+            const std::vector<double>& JxW = ibtk_fe.getJxW();
+            for (unsigned int q = 0; q < JxW.size(); ++q)
+            {
+                TBOX_ASSERT(std::abs(JxW[q] - ibtk_fe_batch.getJxW()[q][l]) < tol * std::max(1.0, std::abs(JxW[q])));
+            }
+
+            const std::vector<libMesh::Point>& q_points = ibtk_fe.getQuadraturePoints();
+            const std::vector<std::vector<libMesh::VectorValue<double> > >& dphi = ibtk_fe.getShapeGradients();
+            for (unsigned int q = 0; q < q_points.size(); ++q)
+            {
+                libMesh::Point q_point;
+                for (unsigned int d = 0; d < dim; ++d) q_point(d) = ibtk_fe_batch.getQuadraturePoints()[q][d][l];
+                TBOX_ASSERT(q_points[q].relative_fuzzy_equals(q_point, tol));
+
+                for (unsigned int i = 0; i < dphi.size(); ++i)
+                {
+                    libMesh::VectorValue<double> shape_grad;
+                    for (unsigned int d = 0; d < dim; ++d)
+                    {
+                        shape_grad(d) = ibtk_fe_batch.getShapeGradients()[i][q][d][l];
+                    }
+                    TBOX_ASSERT(dphi[i][q].relative_fuzzy_equals(shape_grad, tol));
+                }
+            }
+        }
+    }
 }
 
 int
@@ -0,0 +1,226 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCPoissonHypreLevelSolver.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/SCPoissonHypreLevelSolver.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Verify that the hypre level solvers give the same results when their hypre
+// data structures and solver setups are reused (see setup_reuse_tol) as when
+// they are set up from scratch.
+
+namespace
+{
+double
+max_difference(SAMRAIVectorReal<NDIM, double>& d_vec,
+               SAMRAIVectorReal<NDIM, double>& a_vec,
+               SAMRAIVectorReal<NDIM, double>& b_vec)
+{
+    d_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&a_vec, false),
+                   Pointer<SAMRAIVectorReal<NDIM, double> >(&b_vec, false));
+    return d_vec.maxNorm();
+}
+
+// Solve (C I + D L) u = f with a solver that reuses its setup and compare the
+// results to those obtained by solvers that are set up from scratch.
+void
+test_setup_reuse(std::ostream& out,
+                 const std::string& label,
+                 Pointer<PoissonSolver> reuse_solver,
+                 const std::function<Pointer<PoissonSolver>()>& make_fresh_solver,
+                 SAMRAIVectorReal<NDIM, double>& f_vec,
+                 SAMRAIVectorReal<NDIM, double>& u0_vec,
+                 SAMRAIVectorReal<NDIM, double>& u1_vec,
+                 SAMRAIVectorReal<NDIM, double>& d_vec,
+                 const double tol)
+{
+    PoissonSpecifications poisson_spec("poisson_spec");
+    poisson_spec.setCConstant(1.0);
+    poisson_spec.setDConstant(-1.0);
+    reuse_solver->setPoissonSpecifications(poisson_spec);
+
+    // Reinitializing the solver on the same level with the same coefficients
+    // reuses all of the hypre data, so the solution must not change.
+    reuse_solver->initializeSolverState(u0_vec, f_vec);
+    u0_vec.setToScalar(0.0);
+    reuse_solver->solveSystem(u0_vec, f_vec);
+    reuse_solver->deallocateSolverState();
+    reuse_solver->initializeSolverState(u1_vec, f_vec);
+    u1_vec.setToScalar(0.0);
+    reuse_solver->solveSystem(u1_vec, f_vec);
+    out << label << ": reinitialized solver reproduces solution: "
+        << (max_difference(d_vec, u1_vec, u0_vec) == 0.0) << "\n";
+
+    // A small change in C keeps the old solver setup, a large one does not.
+    // Either way, the converged solution must agree with that of a new solver.
+    for (const double C : { 1.001, 2.0 })
+    {
+        poisson_spec.setCConstant(C);
+        reuse_solver->setPoissonSpecifications(poisson_spec);
+        reuse_solver->updateProblemCoefficients();
+        u0_vec.setToScalar(0.0);
+        reuse_solver->solveSystem(u0_vec, f_vec);
+
+        Pointer<PoissonSolver> fresh_solver = make_fresh_solver();
+        fresh_solver->setPoissonSpecifications(poisson_spec);
+        fresh_solver->initializeSolverState(u1_vec, f_vec);
+        u1_vec.setToScalar(0.0);
+        fresh_solver->solveSystem(u1_vec, f_vec);
+
+        out << label << ": C = " << C << ": solution agrees with new solver: "
+            << (max_difference(d_vec, u0_vec, u1_vec) <= tol * u1_vec.maxNorm()) << "\n";
+    }
+    reuse_solver->deallocateSolverState();
+}
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "hypre_reuse.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > cc_var = new CellVariable<NDIM, double>("cc");
+        Pointer<SideVariable<NDIM, double> > sc_var = new SideVariable<NDIM, double>("sc");
+        const int cc_idx = var_db->registerVariableAndContext(cc_var, ctx, IntVector<NDIM>(1));
+        const int sc_idx = var_db->registerVariableAndContext(sc_var, ctx, IntVector<NDIM>(1));
+        std::vector<int> cc_idxs, sc_idxs;
+        for (int k = 0; k < 4; ++k)
+        {
+            cc_idxs.push_back(var_db->registerClonedPatchDataIndex(cc_var, cc_idx));
+            sc_idxs.push_back(var_db->registerClonedPatchDataIndex(sc_var, sc_idx));
+        }
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        for (int k = 0; k < 4; ++k)
+        {
+            level->allocatePatchData(cc_idxs[k], 0.0);
+            level->allocatePatchData(sc_idxs[k], 0.0);
+        }
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        const int h_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+        const std::vector<std::string> vec_names = { "f", "u0", "u1", "d" };
+        std::vector<std::unique_ptr<SAMRAIVectorReal<NDIM, double> > > cc_vecs, sc_vecs;
+        for (int k = 0; k < 4; ++k)
+        {
+            cc_vecs.emplace_back(new SAMRAIVectorReal<NDIM, double>(vec_names[k] + "_cc", patch_hierarchy, 0, 0));
+            cc_vecs[k]->addComponent(cc_var, cc_idxs[k], h_cc_idx);
+            sc_vecs.emplace_back(new SAMRAIVectorReal<NDIM, double>(vec_names[k] + "_sc", patch_hierarchy, 0, 0));
+            sc_vecs[k]->addComponent(sc_var, sc_idxs[k], h_sc_idx);
+        }
+
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        f_fcn.setDataOnPatchHierarchy(cc_idxs[0], cc_var, patch_hierarchy, 0.0);
+        f_fcn.setDataOnPatchHierarchy(sc_idxs[0], sc_var, patch_hierarchy, 0.0);
+
+        std::ofstream out;
+        if (SAMRAI_MPI::getRank() == 0) out.open("output");
+        const double tol = input_db->getDouble("tol");
+
+        // Only the first solver created for each centering reuses its setup.
+        for (const std::string centering : { "cc", "sc" })
+        {
+            Pointer<Database> solver_db = input_db->getDatabase(centering + "_solver_db");
+            std::function<Pointer<PoissonSolver>()> make_solver;
+            if (centering == "cc")
+            {
+                make_solver = [&]() -> Pointer<PoissonSolver> {
+                    return new CCPoissonHypreLevelSolver("cc_hypre_solver", solver_db, "cc_");
+                };
+            }
+            else
+            {
+                make_solver = [&]() -> Pointer<PoissonSolver> {
+                    return new SCPoissonHypreLevelSolver("sc_hypre_solver", solver_db, "sc_");
+                };
+            }
+            std::vector<std::unique_ptr<SAMRAIVectorReal<NDIM, double> > >& vecs =
+                centering == "cc" ? cc_vecs : sc_vecs;
+
+            solver_db->putDouble("setup_reuse_tol", input_db->getDouble("setup_reuse_tol"));
+            Pointer<PoissonSolver> reuse_solver = make_solver();
+            solver_db->putDouble("setup_reuse_tol", -1.0);
+            test_setup_reuse(out, centering, reuse_solver, make_solver, *vecs[0], *vecs[1], *vecs[2], *vecs[3], tol);
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -39,13 +39,59 @@
 // Verify that JacobianCalc and descendants output the same values as libMesh::FEMap.
 using key_type = std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>;
 
+// Verify that the two calculators for boundary elements output the same
+// values as libMesh::FEMap on the boundary elements whose type matches the
+// first entry of boundary_key.
+void
+test_boundary(MeshBase& mesh,
+              JacobianCalculator& jc_boundary_1,
+              JacobianCalculator& jc_boundary_2,
+              const key_type boundary_key)
+{
+    const int dim = mesh.mesh_dimension();
+    BoundaryMesh boundary_mesh(mesh.comm(), dim - 1);
+    mesh.boundary_info->sync(boundary_mesh);
+    boundary_mesh.prepare_for_use();
+    TBOX_ASSERT(boundary_mesh.spatial_dimension() == mesh.mesh_dimension());
+    TBOX_ASSERT(boundary_mesh.mesh_dimension() == mesh.mesh_dimension() - 1);
+
+    FEMapCache boundary_map_cache(dim - 1);
+    QuadratureCache boundary_quad_cache(dim - 1);
+
+    unsigned int n_checked_elems = 0;
+    for (auto elem_iter = boundary_mesh.active_local_elements_begin();
+         elem_iter != boundary_mesh.active_local_elements_end();
+         ++elem_iter)
+    {
+        // meshes of prisms have both triangular and quadrilateral faces:
+        if ((*elem_iter)->type() != std::get<0>(boundary_key)) continue;
+
+        FEMap& fe_map = boundary_map_cache[boundary_key];
+        QBase& quad = boundary_quad_cache[boundary_key];
+        fe_map.compute_map(dim - 1, quad.get_weights(), *elem_iter, false);
+        // all computed JxW values should agree
+        const std::vector<double>& JxW = jc_boundary_1.get_JxW(*elem_iter);
+        const std::vector<double>& JxW_2 = jc_boundary_2.get_JxW(*elem_iter);
+        const std::vector<double>& JxW_3 = fe_map.get_JxW();
+        for (unsigned int i = 0; i < JxW.size(); ++i)
+        {
+            TBOX_ASSERT(std::abs(JxW[i] - JxW_2[i]) < 1e-14 * std::max(1.0, std::abs(JxW[i])));
+            TBOX_ASSERT(std::abs(JxW[i] - JxW_3[i]) < 1e-14 * std::max(1.0, std::abs(JxW[i])));
+        }
+        ++n_checked_elems;
+    }
+    TBOX_ASSERT(n_checked_elems > 0);
+}
+
 void
 test_cube(LibMeshInit& init,
           JacobianCalculator& jc_1,
           JacobianCalculator& jc_2,
-          JacobianCalculator& jc_boundary,
+          JacobianCalculator& jc_boundary_1,
+          JacobianCalculator& jc_boundary_2,
           const int dim,
-          const key_type key)
+          const key_type key,
+          const key_type boundary_key)
 {
     const auto elem_type = std::get<0>(key);
 
@@ -87,46 +133,41 @@ test_cube(LibMeshInit& init,
     TBOX_ASSERT(std::abs(volume - volume_2) < 1e-15 * volume);
     plog << "volume is " << volume << '\n';
 
-    // also test the surface mesh:
+    // every element uses the same rule, so only the first lookup should miss:
+    TBOX_ASSERT(map_cache.getStatistics().n_misses == 1);
+    TBOX_ASSERT(map_cache.getStatistics().n_hits == mesh.n_active_local_elem() - 1);
+    TBOX_ASSERT(quad_cache.getStatistics().n_misses == 1);
+
+    // a bounded cache should recreate evicted rules on demand:
     {
-        BoundaryMesh boundary_mesh(mesh.comm(), mesh.mesh_dimension() - 1);
-        mesh.boundary_info->sync(boundary_mesh);
-        boundary_mesh.prepare_for_use();
-        TBOX_ASSERT(boundary_mesh.spatial_dimension() == mesh.mesh_dimension());
-        TBOX_ASSERT(boundary_mesh.mesh_dimension() == mesh.mesh_dimension() - 1);
-
-        FEMapCache boundary_map_cache(dim - 1);
-        QuadratureCache boundary_quad_cache(dim - 1);
-
-        for (auto elem_iter = boundary_mesh.active_local_elements_begin();
-             elem_iter != boundary_mesh.active_local_elements_end();
-             ++elem_iter)
+        QuadratureCache bounded_quad_cache(dim, 1);
+        const key_type key_2(elem_type, std::get<1>(key), static_cast<Order>(std::get<2>(key) + 2));
+        for (unsigned int i = 0; i < 4; ++i)
         {
-            key_type boundary_key = key;
-            std::get<0>(boundary_key) = (*elem_iter)->type();
-
-            FEMap& fe_map = boundary_map_cache[boundary_key];
-            QBase& quad = boundary_quad_cache[boundary_key];
-            fe_map.compute_map(dim - 1, quad.get_weights(), *elem_iter, false);
-            // all computed JxW values should agree
-            const std::vector<double>& JxW = jc_boundary.get_JxW(*elem_iter);
-            const std::vector<double>& JxW_2 = fe_map.get_JxW();
-            for (unsigned int i = 0; i < JxW.size(); ++i)
-            {
-                TBOX_ASSERT(std::abs(JxW[i] - JxW_2[i]) < 1e-14 * std::max(1.0, std::abs(JxW[i])));
-            }
+            const key_type& current_key = i % 2 == 0 ? key : key_2;
+            const QBase& bounded_quad = bounded_quad_cache[current_key];
+            TBOX_ASSERT(bounded_quad.get_order() == std::get<2>(current_key));
+            TBOX_ASSERT(bounded_quad.n_points() == quad_cache[current_key].n_points());
         }
+        TBOX_ASSERT(bounded_quad_cache.getStatistics().n_misses == 4);
+        TBOX_ASSERT(bounded_quad_cache.getStatistics().n_evictions == 3);
     }
+
+    // also test the surface mesh:
+    test_boundary(mesh, jc_boundary_1, jc_boundary_2, boundary_key);
 }
 
 void
 test_circle(LibMeshInit& init,
             JacobianCalculator& jc_1,
             JacobianCalculator& jc_2,
-            JacobianCalculator& jc_boundary,
+            JacobianCalculator& jc_boundary_1,
+            JacobianCalculator& jc_boundary_2,
             const int n_refines,
             const int dim,
-            const key_type key)
+            const key_type key,
+            const key_type boundary_key,
+            const bool print_values = true)
 {
     const auto elem_type = std::get<0>(key);
 
@@ -157,8 +198,11 @@ test_circle(LibMeshInit& init,
     mesh.prepare_for_use();
 
     // check that we get the same thing with both calculators and libMesh's general code:
-    const std::vector<double>& JxW = jc_1.get_JxW(*mesh.active_local_elements_begin());
-    for (const double jxw : JxW) plog << std::setprecision(12) << jxw << '\n';
+    if (print_values)
+    {
+        const std::vector<double>& JxW = jc_1.get_JxW(*mesh.active_local_elements_begin());
+        for (const double jxw : JxW) plog << std::setprecision(12) << jxw << '\n';
+    }
 
     double volume = 0;
     double volume_2 = 0;
@@ -181,38 +225,21 @@ test_circle(LibMeshInit& init,
         volume_2 += std::accumulate(JxW_2.begin(), JxW_2.end(), 0.0);
     }
     TBOX_ASSERT(std::abs(volume - volume_2) < 1e-15 * volume);
-    plog << "volume is " << volume << '\n';
-
-    // also test the surface mesh:
+    if (print_values)
     {
-        BoundaryMesh boundary_mesh(mesh.comm(), mesh.mesh_dimension() - 1);
-        mesh.boundary_info->sync(boundary_mesh);
-        boundary_mesh.prepare_for_use();
-        TBOX_ASSERT(boundary_mesh.spatial_dimension() == mesh.mesh_dimension());
-        TBOX_ASSERT(boundary_mesh.mesh_dimension() == mesh.mesh_dimension() - 1);
-
-        FEMapCache boundary_map_cache(dim - 1);
-        QuadratureCache boundary_quad_cache(dim - 1);
-
-        for (auto elem_iter = boundary_mesh.active_local_elements_begin();
-             elem_iter != boundary_mesh.active_local_elements_end();
-             ++elem_iter)
-        {
-            key_type boundary_key = key;
-            std::get<0>(boundary_key) = (*elem_iter)->type();
-
-            FEMap& fe_map = boundary_map_cache[boundary_key];
-            QBase& quad = boundary_quad_cache[boundary_key];
-            fe_map.compute_map(dim - 1, quad.get_weights(), *elem_iter, false);
-            // all computed JxW values should agree
-            const std::vector<double>& JxW = jc_boundary.get_JxW(*elem_iter);
-            const std::vector<double>& JxW_2 = fe_map.get_JxW();
-            for (unsigned int i = 0; i < JxW.size(); ++i)
-            {
-                TBOX_ASSERT(std::abs(JxW[i] - JxW_2[i]) < 1e-14 * std::max(1.0, std::abs(JxW[i])));
-            }
-        }
+        plog << "volume is " << volume << '\n';
+    }
+    else
+    {
+        // the values depend on how libMesh builds the mesh, so only compare
+        // against the exact volume:
+        const double exact_volume = dim == 2 ? M_PI * radius * radius : 4.0 / 3.0 * M_PI * std::pow(radius, 3);
+        plog << "volume is close to the exact volume: " << (std::abs(volume - exact_volume) < 1e-2 * exact_volume)
+             << '\n';
     }
+
+    // also test the surface mesh:
+    test_boundary(mesh, jc_boundary_1, jc_boundary_2, boundary_key);
 }
 
 int
@@ -235,8 +262,9 @@ main(int argc, char** argv)
             Tri3Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
             LagrangeMapping<2> jac_calc_2(key, FEUpdateFlags::update_JxW);
             const key_type boundary_key(EDGE2, QGAUSS, THIRD);
-            LagrangeMapping<1, 2> jac_calc_b(boundary_key, FEUpdateFlags::update_JxW);
-            test_cube(init, jac_calc_1, jac_calc_2, jac_calc_b, 2, key);
+            Edge2Mapping jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<1, 2> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_cube(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 2, key, boundary_key);
             ++test_n;
         }
 
@@ -246,8 +274,9 @@ main(int argc, char** argv)
             Tri3Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
             LagrangeMapping<2> jac_calc_2(key, FEUpdateFlags::update_JxW);
             const key_type boundary_key(EDGE2, QGAUSS, THIRD);
-            LagrangeMapping<1, 2> jac_calc_b(boundary_key, FEUpdateFlags::update_JxW);
-            test_cube(init, jac_calc_1, jac_calc_2, jac_calc_b, 2, key);
+            Edge2Mapping jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<1, 2> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_cube(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 2, key, boundary_key);
             ++test_n;
         }
 
@@ -257,8 +286,9 @@ main(int argc, char** argv)
             Quad4Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
             LagrangeMapping<2> jac_calc_2(key, FEUpdateFlags::update_JxW);
             const key_type boundary_key(EDGE2, QGAUSS, THIRD);
-            LagrangeMapping<1, 2> jac_calc_b(boundary_key, FEUpdateFlags::update_JxW);
-            test_cube(init, jac_calc_1, jac_calc_2, jac_calc_b, 2, key);
+            Edge2Mapping jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<1, 2> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_cube(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 2, key, boundary_key);
             ++test_n;
         }
 
@@ -268,8 +298,9 @@ main(int argc, char** argv)
             Quad4Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
             LagrangeMapping<2> jac_calc_2(key, FEUpdateFlags::update_JxW);
             const key_type boundary_key(EDGE2, QGAUSS, THIRD);
-            LagrangeMapping<1, 2> jac_calc_b(boundary_key, FEUpdateFlags::update_JxW);
-            test_circle(init, jac_calc_1, jac_calc_2, jac_calc_b, 5, 2, key);
+            Edge2Mapping jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<1, 2> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_circle(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 5, 2, key, boundary_key);
             ++test_n;
         }
 
@@ -279,8 +310,9 @@ main(int argc, char** argv)
             Quad9Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
             LagrangeMapping<2> jac_calc_2(key, FEUpdateFlags::update_JxW);
             const key_type boundary_key(EDGE3, QGAUSS, FOURTH);
-            LagrangeMapping<1, 2> jac_calc_b(boundary_key, FEUpdateFlags::update_JxW);
-            test_cube(init, jac_calc_1, jac_calc_2, jac_calc_b, 2, key);
+            LagrangeMapping<1, 2> jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<1, 2> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_cube(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 2, key, boundary_key);
             ++test_n;
         }
 
@@ -290,8 +322,9 @@ main(int argc, char** argv)
             Quad9Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
             LagrangeMapping<2> jac_calc_2(key, FEUpdateFlags::update_JxW);
             const key_type boundary_key(EDGE3, QGAUSS, FOURTH);
-            LagrangeMapping<1, 2> jac_calc_b(boundary_key, FEUpdateFlags::update_JxW);
-            test_circle(init, jac_calc_1, jac_calc_2, jac_calc_b, 4, 2, key);
+            LagrangeMapping<1, 2> jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<1, 2> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_circle(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 4, 2, key, boundary_key);
             ++test_n;
         }
 
@@ -301,56 +334,177 @@ main(int argc, char** argv)
             Tet4Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
             LagrangeMapping<3> jac_calc_2(key, FEUpdateFlags::update_JxW);
             const key_type boundary_key(TRI3, QGAUSS, THIRD);
-            LagrangeMapping<2, 3> jac_calc_b(boundary_key, FEUpdateFlags::update_JxW);
-            test_cube(init, jac_calc_1, jac_calc_2, jac_calc_b, 3, key);
+            Tri3SurfaceMapping jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<2, 3> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_cube(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 3, key, boundary_key);
             ++test_n;
         }
 
         {
             plog << "Test " << test_n << ": HEX8 square" << std::endl;
             const key_type key(HEX8, QGAUSS, THIRD);
-            // HEX8 doesn't have a custom calculator yet
-            LagrangeMapping<3> jac_calc_1(key, FEUpdateFlags::update_JxW);
+            Hex8Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
             LagrangeMapping<3> jac_calc_2(key, FEUpdateFlags::update_JxW);
             const key_type boundary_key(QUAD4, QGAUSS, THIRD);
-            LagrangeMapping<2, 3> jac_calc_b(boundary_key, FEUpdateFlags::update_JxW);
-            test_cube(init, jac_calc_1, jac_calc_2, jac_calc_b, 3, key);
+            Quad4SurfaceMapping jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<2, 3> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_cube(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 3, key, boundary_key);
             ++test_n;
         }
 
         {
             plog << "Test " << test_n << ": HEX8 circle" << std::endl;
             const key_type key(HEX8, QGAUSS, THIRD);
-            // HEX8 doesn't have a custom calculator yet
-            LagrangeMapping<3> jac_calc_1(key, FEUpdateFlags::update_JxW);
+            Hex8Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
             LagrangeMapping<3> jac_calc_2(key, FEUpdateFlags::update_JxW);
             const key_type boundary_key(QUAD4, QGAUSS, THIRD);
-            LagrangeMapping<2, 3> jac_calc_b(boundary_key, FEUpdateFlags::update_JxW);
-            test_circle(init, jac_calc_1, jac_calc_2, jac_calc_b, 4, 3, key);
+            Quad4SurfaceMapping jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<2, 3> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_circle(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 4, 3, key, boundary_key);
             ++test_n;
         }
 
         {
             plog << "Test " << test_n << ": HEX27 square" << std::endl;
             const key_type key(HEX27, QGAUSS, FOURTH);
-            // HEX27 doesn't have a custom calculator yet
-            LagrangeMapping<3> jac_calc_1(key, FEUpdateFlags::update_JxW);
+            Hex27Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
             LagrangeMapping<3> jac_calc_2(key, FEUpdateFlags::update_JxW);
             const key_type boundary_key(QUAD9, QGAUSS, FOURTH);
-            LagrangeMapping<2, 3> jac_calc_b(boundary_key, FEUpdateFlags::update_JxW);
-            test_cube(init, jac_calc_1, jac_calc_2, jac_calc_b, 3, key);
+            LagrangeMapping<2, 3> jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<2, 3> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_cube(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 3, key, boundary_key);
             ++test_n;
         }
 
         {
             plog << "Test " << test_n << ": HEX27 circle" << std::endl;
             const key_type key(HEX27, QGAUSS, FOURTH);
-            // HEX27 doesn't have a custom calculator yet
-            LagrangeMapping<3> jac_calc_1(key, FEUpdateFlags::update_JxW);
+            Hex27Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
             LagrangeMapping<3> jac_calc_2(key, FEUpdateFlags::update_JxW);
             const key_type boundary_key(QUAD9, QGAUSS, FOURTH);
-            LagrangeMapping<2, 3> jac_calc_b(boundary_key, FEUpdateFlags::update_JxW);
-            test_circle(init, jac_calc_1, jac_calc_2, jac_calc_b, 2, 3, key);
+            LagrangeMapping<2, 3> jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<2, 3> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_circle(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 2, 3, key, boundary_key);
+            ++test_n;
+        }
+
+        {
+            plog << "Test " << test_n << ": TRI6 square" << std::endl;
+            const key_type key(TRI6, QGAUSS, THIRD);
+            Tri6Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<2> jac_calc_2(key, FEUpdateFlags::update_JxW);
+            const key_type boundary_key(EDGE3, QGAUSS, THIRD);
+            LagrangeMapping<1, 2> jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<1, 2> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_cube(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 2, key, boundary_key);
+            ++test_n;
+        }
+
+        {
+            plog << "Test " << test_n << ": TRI6 circle" << std::endl;
+            const key_type key(TRI6, QGAUSS, THIRD);
+            Tri6Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<2> jac_calc_2(key, FEUpdateFlags::update_JxW);
+            const key_type boundary_key(EDGE3, QGAUSS, THIRD);
+            LagrangeMapping<1, 2> jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<1, 2> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_circle(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 4, 2, key, boundary_key, false);
+            ++test_n;
+        }
+
+        {
+            plog << "Test " << test_n << ": QUAD8 square" << std::endl;
+            const key_type key(QUAD8, QGAUSS, FOURTH);
+            Quad8Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<2> jac_calc_2(key, FEUpdateFlags::update_JxW);
+            const key_type boundary_key(EDGE3, QGAUSS, FOURTH);
+            LagrangeMapping<1, 2> jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<1, 2> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_cube(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 2, key, boundary_key);
+            ++test_n;
+        }
+
+        {
+            plog << "Test " << test_n << ": QUAD8 circle" << std::endl;
+            const key_type key(QUAD8, QGAUSS, FOURTH);
+            Quad8Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<2> jac_calc_2(key, FEUpdateFlags::update_JxW);
+            const key_type boundary_key(EDGE3, QGAUSS, FOURTH);
+            LagrangeMapping<1, 2> jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<1, 2> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_circle(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 4, 2, key, boundary_key, false);
+            ++test_n;
+        }
+
+        {
+            plog << "Test " << test_n << ": TET10 cube" << std::endl;
+            const key_type key(TET10, QGAUSS, THIRD);
+            Tet10Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<3> jac_calc_2(key, FEUpdateFlags::update_JxW);
+            const key_type boundary_key(TRI6, QGAUSS, THIRD);
+            Tri6SurfaceMapping jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<2, 3> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_cube(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 3, key, boundary_key);
+            ++test_n;
+        }
+
+        {
+            plog << "Test " << test_n << ": TET10 circle" << std::endl;
+            const key_type key(TET10, QGAUSS, THIRD);
+            Tet10Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<3> jac_calc_2(key, FEUpdateFlags::update_JxW);
+            const key_type boundary_key(TRI6, QGAUSS, THIRD);
+            Tri6SurfaceMapping jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<2, 3> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_circle(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 2, 3, key, boundary_key, false);
+            ++test_n;
+        }
+
+        {
+            plog << "Test " << test_n << ": HEX20 cube" << std::endl;
+            const key_type key(HEX20, QGAUSS, FOURTH);
+            Hex20Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<3> jac_calc_2(key, FEUpdateFlags::update_JxW);
+            const key_type boundary_key(QUAD8, QGAUSS, FOURTH);
+            LagrangeMapping<2, 3> jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<2, 3> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_cube(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 3, key, boundary_key);
+            ++test_n;
+        }
+
+        {
+            plog << "Test " << test_n << ": HEX20 circle" << std::endl;
+            const key_type key(HEX20, QGAUSS, FOURTH);
+            Hex20Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<3> jac_calc_2(key, FEUpdateFlags::update_JxW);
+            const key_type boundary_key(QUAD8, QGAUSS, FOURTH);
+            LagrangeMapping<2, 3> jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<2, 3> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_circle(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 2, 3, key, boundary_key, false);
+            ++test_n;
+        }
+
+        {
+            plog << "Test " << test_n << ": PRISM6 cube" << std::endl;
+            const key_type key(PRISM6, QGAUSS, THIRD);
+            Prism6Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<3> jac_calc_2(key, FEUpdateFlags::update_JxW);
+            const key_type boundary_key(QUAD4, QGAUSS, THIRD);
+            Quad4SurfaceMapping jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<2, 3> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_cube(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 3, key, boundary_key);
+            ++test_n;
+        }
+
+        {
+            plog << "Test " << test_n << ": PRISM15 cube" << std::endl;
+            const key_type key(PRISM15, QGAUSS, THIRD);
+            Prism15Mapping jac_calc_1(key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<3> jac_calc_2(key, FEUpdateFlags::update_JxW);
+            const key_type boundary_key(TRI6, QGAUSS, THIRD);
+            Tri6SurfaceMapping jac_calc_b_1(boundary_key, FEUpdateFlags::update_JxW);
+            LagrangeMapping<2, 3> jac_calc_b_2(boundary_key, FEUpdateFlags::update_JxW);
+            test_cube(init, jac_calc_1, jac_calc_2, jac_calc_b_1, jac_calc_b_2, 3, key, boundary_key);
             ++test_n;
         }
     }
@@ -0,0 +1,193 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCLaplaceOperator.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/PETScKrylovLinearSolver.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Verify that PETSc's pipelined Krylov methods, which use split-phase
+// reductions of PETScSAMRAIVectorReal, solve a cell-centered Helmholtz problem
+// on a locally refined grid as well as the corresponding standard methods:
+// pipecg is compared to cg and pgmres and pipefgmres are compared to gmres.
+
+namespace
+{
+// Solve (I - L) u = f with the given KSP type. Return whether the solver
+// converged and the number of iterations.
+std::pair<bool, int>
+solve(const std::string& ksp_type,
+      Pointer<Database> solver_db,
+      Pointer<CCLaplaceOperator> laplace_op,
+      SAMRAIVectorReal<NDIM, double>& u_vec,
+      SAMRAIVectorReal<NDIM, double>& f_vec)
+{
+    solver_db->putString("ksp_type", ksp_type);
+    PETScKrylovLinearSolver solver("solver_" + ksp_type, solver_db, ksp_type + "_");
+    solver.setOperator(laplace_op);
+    solver.initializeSolverState(u_vec, f_vec);
+    u_vec.setToScalar(0.0);
+    const bool converged = solver.solveSystem(u_vec, f_vec);
+    const int n_iterations = solver.getNumIterations();
+    solver.deallocateSolverState();
+    return std::make_pair(converged, n_iterations);
+}
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "krylov_pipelined.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > cc_var = new CellVariable<NDIM, double>("cc");
+        const int cc_idx = var_db->registerVariableAndContext(cc_var, ctx, IntVector<NDIM>(1));
+        std::vector<int> cc_idxs;
+        for (int k = 0; k < 4; ++k) cc_idxs.push_back(var_db->registerClonedPatchDataIndex(cc_var, cc_idx));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (const int idx : cc_idxs) level->allocatePatchData(idx, 0.0);
+        }
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> u_ref_vec("u_ref", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> d_vec("d", patch_hierarchy, 0, finest_ln);
+        f_vec.addComponent(cc_var, cc_idxs[0], h_cc_idx);
+        u_ref_vec.addComponent(cc_var, cc_idxs[1], h_cc_idx);
+        u_vec.addComponent(cc_var, cc_idxs[2], h_cc_idx);
+        d_vec.addComponent(cc_var, cc_idxs[3], h_cc_idx);
+
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        f_fcn.setDataOnPatchHierarchy(cc_idxs[0], cc_var, patch_hierarchy, 0.0);
+
+        // Setup the operator I - L, which is symmetric and positive definite.
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCConstant(1.0);
+        poisson_spec.setDConstant(-1.0);
+        Pointer<CCLaplaceOperator> laplace_op = new CCLaplaceOperator("laplace_op");
+        laplace_op->setPoissonSpecifications(poisson_spec);
+        laplace_op->setPhysicalBcCoef(nullptr);
+
+        std::ofstream out;
+        if (SAMRAI_MPI::getRank() == 0) out.open("output");
+        const double tol = input_db->getDouble("tol");
+        Pointer<Database> solver_db = input_db->getDatabase("solver_db");
+
+        const std::vector<std::pair<std::string, std::string> > pipelined_and_reference_types = {
+            { "pipecg", "cg" }, { "pgmres", "gmres" }, { "pipefgmres", "gmres" }
+        };
+        for (const auto& types : pipelined_and_reference_types)
+        {
+            const std::string& ksp_type = types.first;
+            const std::string& ref_ksp_type = types.second;
+            const std::pair<bool, int> ref_result = solve(ref_ksp_type, solver_db, laplace_op, u_ref_vec, f_vec);
+            const std::pair<bool, int> result = solve(ksp_type, solver_db, laplace_op, u_vec, f_vec);
+
+            d_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&u_vec, false),
+                           Pointer<SAMRAIVectorReal<NDIM, double> >(&u_ref_vec, false));
+            const bool solutions_agree = d_vec.maxNorm() <= tol * u_ref_vec.maxNorm();
+
+            // Pipelined methods are mathematically equivalent to the standard
+            // ones but round off differently, so allow for a few extra
+            // iterations.
+            const int max_extra_iterations = std::max(3, ref_result.second / 5);
+            const bool iterations_agree = std::abs(result.second - ref_result.second) <= max_extra_iterations;
+
+            out << ref_ksp_type << ": converged: " << ref_result.first << "\n";
+            out << ksp_type << ": converged: " << result.first << "\n";
+            out << ksp_type << ": solution agrees with " << ref_ksp_type << ": " << solutions_agree << "\n";
+            out << ksp_type << ": iteration count agrees with " << ref_ksp_type << ": " << iterations_agree << "\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
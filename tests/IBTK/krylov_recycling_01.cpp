@@ -0,0 +1,213 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCLaplaceOperator.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/PETScKrylovLinearSolver.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Verify that Krylov subspace recycling in PETScKrylovLinearSolver reduces the
+// number of iterations needed to solve a sequence of slowly varying
+// cell-centered Helmholtz problems (C_k I - L) u_k = f_k without changing the
+// solutions, and that the recycled subspace is discarded when the solver state
+// is deallocated.
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "krylov_recycling.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > cc_var = new CellVariable<NDIM, double>("cc");
+        const int cc_idx = var_db->registerVariableAndContext(cc_var, ctx, IntVector<NDIM>(1));
+        std::vector<int> cc_idxs;
+        for (int k = 0; k < 6; ++k) cc_idxs.push_back(var_db->registerClonedPatchDataIndex(cc_var, cc_idx));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (const int idx : cc_idxs) level->allocatePatchData(idx, 0.0);
+        }
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> g_vec("g", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> b_vec("b", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> u_ref_vec("u_ref", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> d_vec("d", patch_hierarchy, 0, finest_ln);
+        f_vec.addComponent(cc_var, cc_idxs[0], h_cc_idx);
+        g_vec.addComponent(cc_var, cc_idxs[1], h_cc_idx);
+        b_vec.addComponent(cc_var, cc_idxs[2], h_cc_idx);
+        u_ref_vec.addComponent(cc_var, cc_idxs[3], h_cc_idx);
+        u_vec.addComponent(cc_var, cc_idxs[4], h_cc_idx);
+        d_vec.addComponent(cc_var, cc_idxs[5], h_cc_idx);
+
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        f_fcn.setDataOnPatchHierarchy(cc_idxs[0], cc_var, patch_hierarchy, 0.0);
+        muParserCartGridFunction g_fcn("g", app_initializer->getComponentDatabase("g"), grid_geometry);
+        g_fcn.setDataOnPatchHierarchy(cc_idxs[1], cc_var, patch_hierarchy, 0.0);
+
+        // Setup a reference solver and a solver that recycles a subspace. Each
+        // solver gets its own copy of the operator.
+        Pointer<Database> solver_db = input_db->getDatabase("solver_db");
+        const int recycle_subspace_dim = input_db->getInteger("recycle_subspace_dim");
+        solver_db->putInteger("recycle_subspace_dim", 0);
+        PETScKrylovLinearSolver ref_solver("ref_solver", solver_db, "ref_");
+        solver_db->putInteger("recycle_subspace_dim", recycle_subspace_dim);
+        PETScKrylovLinearSolver solver("solver", solver_db, "recycle_");
+        Pointer<CCLaplaceOperator> ref_laplace_op = new CCLaplaceOperator("ref_laplace_op");
+        Pointer<CCLaplaceOperator> laplace_op = new CCLaplaceOperator("laplace_op");
+        ref_laplace_op->setPhysicalBcCoef(nullptr);
+        laplace_op->setPhysicalBcCoef(nullptr);
+        ref_solver.setOperator(ref_laplace_op);
+        solver.setOperator(laplace_op);
+
+        // Solve the sequence of problems. The coefficients are changed with
+        // updateProblemCoefficients(), which keeps the recycled subspace.
+        const double C0 = input_db->getDouble("C0");
+        const double dC = input_db->getDouble("dC");
+        const double dg = input_db->getDouble("dg");
+        const int num_solves = input_db->getInteger("num_solves");
+        const double tol = input_db->getDouble("tol");
+        bool all_converged = true, solutions_agree = true;
+        int n_ref_iterations = 0, n_iterations = 0;
+        for (int k = 0; k < num_solves; ++k)
+        {
+            PoissonSpecifications poisson_spec("poisson_spec");
+            poisson_spec.setCConstant(C0 + k * dC);
+            poisson_spec.setDConstant(-1.0);
+            ref_laplace_op->setPoissonSpecifications(poisson_spec);
+            laplace_op->setPoissonSpecifications(poisson_spec);
+            b_vec.linearSum(1.0,
+                            Pointer<SAMRAIVectorReal<NDIM, double> >(&f_vec, false),
+                            std::sin(k * dg),
+                            Pointer<SAMRAIVectorReal<NDIM, double> >(&g_vec, false));
+            if (k == 0)
+            {
+                ref_solver.initializeSolverState(u_ref_vec, b_vec);
+                solver.initializeSolverState(u_vec, b_vec);
+            }
+            else
+            {
+                ref_solver.updateProblemCoefficients();
+                solver.updateProblemCoefficients();
+            }
+
+            u_ref_vec.setToScalar(0.0);
+            all_converged = ref_solver.solveSystem(u_ref_vec, b_vec) && all_converged;
+            u_vec.setToScalar(0.0);
+            all_converged = solver.solveSystem(u_vec, b_vec) && all_converged;
+
+            // The first solve does not benefit from recycling.
+            if (k > 0)
+            {
+                n_ref_iterations += ref_solver.getNumIterations();
+                n_iterations += solver.getNumIterations();
+            }
+
+            d_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&u_vec, false),
+                           Pointer<SAMRAIVectorReal<NDIM, double> >(&u_ref_vec, false));
+            solutions_agree = solutions_agree && d_vec.maxNorm() <= tol * u_ref_vec.maxNorm();
+        }
+        const int subspace_dim = solver.getRecycledSubspaceDimension();
+        solver.deallocateSolverState();
+        ref_solver.deallocateSolverState();
+
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "all solves converged: " << all_converged << "\n";
+            out << "recycled solutions agree with reference solutions: " << solutions_agree << "\n";
+            out << "recycling reduces the number of iterations: " << (n_iterations < n_ref_iterations) << "\n";
+            out << "recycled subspace is nonempty before deallocation: " << (subspace_dim > 0) << "\n";
+            out << "recycled subspace dimension after deallocation: " << solver.getRecycledSubspaceDimension()
+                << "\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,98 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#include <ibtk/ibtk_utilities.h>
+
+#include <tbox/SAMRAIManager.h>
+#include <tbox/SAMRAI_MPI.h>
+
+#include <petscsys.h>
+
+#include <SAMRAI_config.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+using namespace SAMRAI;
+
+// Check that the weights computed by lagrange_interpolation_weights() reproduce
+// polynomials of degree up to one less than the number of (unequally spaced)
+// times, both when interpolating and when extrapolating.
+
+namespace
+{
+// Evaluate a polynomial with fixed, nonzero coefficients of degree @p degree.
+double
+polynomial(const int degree, const double t)
+{
+    double value = 0.0;
+    for (int k = degree; k >= 0; --k) value = value * t + (1.0 + 0.5 * k);
+    return value;
+}
+
+// Return true if the weights reproduce the polynomial of degree @p degree at
+// time @p t.
+bool
+reproduces_polynomial(const std::vector<double>& times, const int degree, const double t)
+{
+    const std::vector<double> weights = IBTK::lagrange_interpolation_weights(times, t);
+    double value = 0.0;
+    for (std::size_t i = 0; i < times.size(); ++i) value += weights[i] * polynomial(degree, times[i]);
+    const double exact = polynomial(degree, t);
+    return std::abs(value - exact) <= 1.0e-12 * std::max(1.0, std::abs(exact));
+}
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    tbox::SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    tbox::SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    tbox::SAMRAIManager::startup();
+
+    std::ofstream out("output");
+
+    // Time levels with variable time step sizes, as used by the integrators to
+    // extrapolate the advection velocity and the pressure.
+    const std::vector<double> all_times = { 0.0, 0.1, 0.25, 0.32, 0.5 };
+    const std::vector<double> eval_times = { 0.05, 0.3, 0.6, 0.75 };
+    for (std::size_t n = 1; n <= all_times.size(); ++n)
+    {
+        const std::vector<double> times(all_times.begin(), all_times.begin() + n);
+        for (const double t : eval_times)
+        {
+            out << n << " times, t = " << t << ":";
+            const std::vector<double> weights = IBTK::lagrange_interpolation_weights(times, t);
+            double weight_sum = 0.0;
+            for (const double w : weights) weight_sum += w;
+            out << " weights sum to one: " << (std::abs(weight_sum - 1.0) <= 1.0e-12);
+
+            // The weights reproduce polynomials of degree n - 1, but not those
+            // of degree n.
+            bool reproduces_all = true;
+            for (int degree = 0; degree < static_cast<int>(n); ++degree)
+            {
+                reproduces_all = reproduces_all && reproduces_polynomial(times, degree, t);
+            }
+            out << ", reproduces degree " << n - 1 << ": " << reproduces_all;
+            out << ", reproduces degree " << n << ": " << reproduces_polynomial(times, n, t) << "\n";
+        }
+    }
+
+    tbox::SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
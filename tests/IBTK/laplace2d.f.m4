@@ -0,0 +1,272 @@
+c ---------------------------------------------------------------------
+c
+c Copyright (c) 2011 - 2017 by the IBAMR developers
+c All rights reserved.
+c
+c This file is part of IBAMR.
+c
+c IBAMR is free software and is distributed under the 3-clause BSD
+c license. The full text of the license can be found in the file
+c COPYRIGHT at the top level directory of IBAMR.
+c
+c ---------------------------------------------------------------------
+c
+c Reference implementations of the constant-coefficient Laplacians that
+c PatchMathOps applies with C++ kernels. These routines are only compiled
+c into patch_math_ops_laplace_01, which checks the C++ kernels against them.
+c
+define(NDIM,2)dnl
+define(REAL,`double precision')dnl
+define(INTEGER,`integer')dnl
+include(SAMRAI_FORTDIR/pdat_m4arrdim2d.i)dnl
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Computes F = alpha div grad U.
+c
+c     Uses the five point stencil to compute the discrete Laplacian of a
+c     variable U.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine laplace2d(
+     &     F,F_gcw,
+     &     alpha,
+     &     U,U_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER F_gcw,U_gcw
+
+      REAL alpha
+
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL    fac0,fac1
+c
+c     Compute the discrete Laplacian of U.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            F(i0,i1) =
+     &           fac0*(U(i0-1,i1)+U(i0+1,i1)-2.d0*U(i0,i1)) +
+     &           fac1*(U(i0,i1-1)+U(i0,i1+1)-2.d0*U(i0,i1))
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Computes F = alpha div grad U + beta V.
+c
+c     Uses the five point stencil to compute the discrete Laplacian of a
+c     variable U.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine laplaceadd2d(
+     &     F,F_gcw,
+     &     alpha,
+     &     U,U_gcw,
+     &     beta,
+     &     V,V_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER F_gcw,U_gcw,V_gcw
+
+      REAL alpha
+
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw)
+
+      REAL beta
+
+      REAL V(ilower0-V_gcw:iupper0+V_gcw,
+     &       ilower1-V_gcw:iupper1+V_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL    fac0,fac1
+c
+c     Compute the discrete Laplacian of U.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            F(i0,i1) =
+     &           fac0*(U(i0-1,i1)+U(i0+1,i1)-2.d0*U(i0,i1)) +
+     &           fac1*(U(i0,i1-1)+U(i0,i1+1)-2.d0*U(i0,i1)) +
+     &           beta* V(i0,i1)
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Computes F = alpha div grad U + beta U.
+c
+c     Uses the five point stencil to compute the damped discrete
+c     Laplacian of a variable U.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine dampedlaplace2d(
+     &     F,F_gcw,
+     &     alpha,beta,
+     &     U,U_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER F_gcw,U_gcw
+
+      REAL alpha,beta
+
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL    fac0,fac1
+c
+c     Compute the discrete Laplacian of U.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            F(i0,i1) =
+     &           fac0*(U(i0-1,i1)+U(i0+1,i1)-2.d0*U(i0,i1)) +
+     &           fac1*(U(i0,i1-1)+U(i0,i1+1)-2.d0*U(i0,i1)) +
+     &           beta* U(i0,i1)
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Computes F = alpha div grad U + beta U + gamma V.
+c
+c     Uses the five point stencil to compute the damped discrete
+c     Laplacian of a variable U.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine dampedlaplaceadd2d(
+     &     F,F_gcw,
+     &     alpha,beta,
+     &     U,U_gcw,
+     &     gamma,
+     &     V,V_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER F_gcw,U_gcw,V_gcw
+
+      REAL alpha,beta
+
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw)
+
+      REAL gamma
+
+      REAL V(ilower0-V_gcw:iupper0+V_gcw,
+     &       ilower1-V_gcw:iupper1+V_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL    fac0,fac1
+c
+c     Compute the discrete Laplacian of U.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            F(i0,i1) =
+     &           fac0*(U(i0-1,i1)+U(i0+1,i1)-2.d0*U(i0,i1)) +
+     &           fac1*(U(i0,i1-1)+U(i0,i1+1)-2.d0*U(i0,i1)) +
+     &           beta* U(i0,i1)                             +
+     &           gamma*V(i0,i1)
+         enddo
+      enddo
+c
+      return
+      end
+c
@@ -0,0 +1,359 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Check that the constant-coefficient Laplacians computed by PatchMathOps agree
+// with the Fortran routines that they replace, for cell-centered and
+// side-centered data and for all four variants (with and without the damping
+// term beta U and the added term gamma V).
+
+#include <IBTK_config.h>
+
+#include <ibtk/PatchMathOps.h>
+
+#include <tbox/Array.h>
+#include <tbox/Pointer.h>
+#include <tbox/SAMRAIManager.h>
+#include <tbox/SAMRAI_MPI.h>
+
+#include <petscsys.h>
+
+#include <ArrayData.h>
+#include <Box.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <Patch.h>
+#include <PatchDescriptor.h>
+#include <SideData.h>
+
+#include <SAMRAI_config.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+using namespace SAMRAI;
+
+// Reference Fortran implementations of the constant-coefficient Laplacians,
+// compiled from laplace2d.f.m4 and laplace3d.f.m4 in this directory.
+#if (NDIM == 2)
+#define LAPLACE_FC IBTK_FC_FUNC(laplace2d, LAPLACE2D)
+#define LAPLACE_ADD_FC IBTK_FC_FUNC(laplaceadd2d, LAPLACEADD2D)
+#define DAMPED_LAPLACE_FC IBTK_FC_FUNC(dampedlaplace2d, DAMPEDLAPLACE2D)
+#define DAMPED_LAPLACE_ADD_FC IBTK_FC_FUNC(dampedlaplaceadd2d, DAMPEDLAPLACEADD2D)
+#endif
+#if (NDIM == 3)
+#define LAPLACE_FC IBTK_FC_FUNC(laplace3d, LAPLACE3D)
+#define LAPLACE_ADD_FC IBTK_FC_FUNC(laplaceadd3d, LAPLACEADD3D)
+#define DAMPED_LAPLACE_FC IBTK_FC_FUNC(dampedlaplace3d, DAMPEDLAPLACE3D)
+#define DAMPED_LAPLACE_ADD_FC IBTK_FC_FUNC(dampedlaplaceadd3d, DAMPEDLAPLACEADD3D)
+#endif
+
+extern "C"
+{
+    void LAPLACE_FC(double* F,
+                    const int& F_gcw,
+                    const double& alpha,
+                    const double* U,
+                    const int& U_gcw,
+                    const int& ilower0,
+                    const int& iupper0,
+                    const int& ilower1,
+                    const int& iupper1,
+#if (NDIM == 3)
+                    const int& ilower2,
+                    const int& iupper2,
+#endif
+                    const double* dx);
+
+    void LAPLACE_ADD_FC(double* F,
+                        const int& F_gcw,
+                        const double& alpha,
+                        const double* U,
+                        const int& U_gcw,
+                        const double& beta,
+                        const double* V,
+                        const int& V_gcw,
+                        const int& ilower0,
+                        const int& iupper0,
+                        const int& ilower1,
+                        const int& iupper1,
+#if (NDIM == 3)
+                        const int& ilower2,
+                        const int& iupper2,
+#endif
+                        const double* dx);
+
+    void DAMPED_LAPLACE_FC(double* F,
+                           const int& F_gcw,
+                           const double& alpha,
+                           const double& beta,
+                           const double* U,
+                           const int& U_gcw,
+                           const int& ilower0,
+                           const int& iupper0,
+                           const int& ilower1,
+                           const int& iupper1,
+#if (NDIM == 3)
+                           const int& ilower2,
+                           const int& iupper2,
+#endif
+                           const double* dx);
+
+    void DAMPED_LAPLACE_ADD_FC(double* F,
+                               const int& F_gcw,
+                               const double& alpha,
+                               const double& beta,
+                               const double* U,
+                               const int& U_gcw,
+                               const double& gamma,
+                               const double* V,
+                               const int& V_gcw,
+                               const int& ilower0,
+                               const int& iupper0,
+                               const int& ilower1,
+                               const int& iupper1,
+#if (NDIM == 3)
+                               const int& ilower2,
+                               const int& iupper2,
+#endif
+                               const double* dx);
+}
+
+#if (NDIM == 2)
+#define BOX_BOUNDS(box) box.lower(0), box.upper(0), box.lower(1), box.upper(1)
+#endif
+#if (NDIM == 3)
+#define BOX_BOUNDS(box) box.lower(0), box.upper(0), box.lower(1), box.upper(1), box.lower(2), box.upper(2)
+#endif
+
+namespace
+{
+// Fill the data (including ghost cells) with deterministic values in the range
+// [-1, 1].
+void
+fill_data(pdat::ArrayData<NDIM, double>& data, const double seed)
+{
+    const int n_vals = data.getBox().size();
+    for (int depth = 0; depth < data.getDepth(); ++depth)
+    {
+        double* const vals = data.getPointer(depth);
+        for (int k = 0; k < n_vals; ++k) vals[k] = std::sin(seed + 0.37 * k + 0.001 * k * k + 1.3 * depth);
+    }
+    return;
+}
+
+void
+fill_data(pdat::SideData<NDIM, double>& data, const double seed)
+{
+    for (unsigned int axis = 0; axis < NDIM; ++axis) fill_data(data.getArrayData(axis), seed + 0.5 * axis);
+    return;
+}
+
+// Return the largest difference between the values (including ghost cells)
+// relative to the largest value of u.
+double
+relative_difference(const pdat::ArrayData<NDIM, double>& u, const pdat::ArrayData<NDIM, double>& v)
+{
+    double max_diff = 0.0, max_val = 0.0;
+    const int n_vals = u.getBox().size();
+    for (int depth = 0; depth < u.getDepth(); ++depth)
+    {
+        for (int k = 0; k < n_vals; ++k)
+        {
+            max_diff = std::max(max_diff, std::abs(u.getPointer(depth)[k] - v.getPointer(depth)[k]));
+            max_val = std::max(max_val, std::abs(u.getPointer(depth)[k]));
+        }
+    }
+    return max_diff / max_val;
+}
+
+double
+relative_difference(const pdat::SideData<NDIM, double>& u, const pdat::SideData<NDIM, double>& v)
+{
+    double diff = 0.0;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        diff = std::max(diff, relative_difference(u.getArrayData(axis), v.getArrayData(axis)));
+    }
+    return diff;
+}
+
+// Compute F = alpha div grad U + beta U + gamma V on the index box @p box with
+// the Fortran routine that PatchMathOps::laplace() used to call.
+void
+fortran_laplace(double* const F,
+                const int F_gcw,
+                const double alpha,
+                const double beta,
+                const double* const U,
+                const int U_gcw,
+                const double gamma,
+                const double* const V,
+                const int V_gcw,
+                const hier::Box<NDIM>& box,
+                const double* const dx)
+{
+    if (beta == 0.0 && !V)
+    {
+        LAPLACE_FC(F, F_gcw, alpha, U, U_gcw, BOX_BOUNDS(box), dx);
+    }
+    else if (beta == 0.0)
+    {
+        LAPLACE_ADD_FC(F, F_gcw, alpha, U, U_gcw, gamma, V, V_gcw, BOX_BOUNDS(box), dx);
+    }
+    else if (!V)
+    {
+        DAMPED_LAPLACE_FC(F, F_gcw, alpha, beta, U, U_gcw, BOX_BOUNDS(box), dx);
+    }
+    else
+    {
+        DAMPED_LAPLACE_ADD_FC(F, F_gcw, alpha, beta, U, U_gcw, gamma, V, V_gcw, BOX_BOUNDS(box), dx);
+    }
+    return;
+}
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    tbox::SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    tbox::SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    tbox::SAMRAIManager::startup();
+
+    std::ofstream out("output");
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // Use a box that spans several tiles along each axis and whose extents
+        // are not multiples of the tile widths.
+#if (NDIM == 2)
+        const hier::Box<NDIM> box(hier::Index<NDIM>(3, 2), hier::Index<NDIM>(80, 40));
+        const double dx[NDIM] = { 0.1, 0.07 };
+#endif
+#if (NDIM == 3)
+        const hier::Box<NDIM> box(hier::Index<NDIM>(1, 4, 0), hier::Index<NDIM>(40, 25, 37));
+        const double dx[NDIM] = { 0.1, 0.07, 0.12 };
+#endif
+        double x_lower[NDIM], x_upper[NDIM];
+        tbox::Array<tbox::Array<bool> > touches_regular_bdry(NDIM), touches_periodic_bdry(NDIM);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            x_lower[axis] = box.lower(axis) * dx[axis];
+            x_upper[axis] = (box.upper(axis) + 1) * dx[axis];
+            touches_regular_bdry[axis].resizeArray(2);
+            touches_periodic_bdry[axis].resizeArray(2);
+            for (int upperlower = 0; upperlower < 2; ++upperlower)
+            {
+                touches_regular_bdry[axis][upperlower] = false;
+                touches_periodic_bdry[axis][upperlower] = false;
+            }
+        }
+        tbox::Pointer<hier::Patch<NDIM> > patch = new hier::Patch<NDIM>(box, new hier::PatchDescriptor<NDIM>());
+        patch->setPatchGeometry(new geom::CartesianPatchGeometry<NDIM>(
+            hier::IntVector<NDIM>(1), touches_regular_bdry, touches_periodic_bdry, dx, x_lower, x_upper));
+
+        // Use different ghost cell widths and data depths for each argument so
+        // that the indexing of each one is checked.
+        const int depth = 2;
+        const int F_gcw = 2, U_gcw = 1, V_gcw = 3;
+        const hier::IntVector<NDIM> F_ghosts(F_gcw), U_ghosts(U_gcw), V_ghosts(V_gcw);
+        const int l = 1, m = 0, n = 1;
+        const double alpha = -1.3, tol = 1.0e-12;
+        IBTK::PatchMathOps patch_math_ops;
+
+        // Cell-centered data.
+        {
+            using CellDataType = pdat::CellData<NDIM, double>;
+            tbox::Pointer<CellDataType> u = new CellDataType(box, depth, U_ghosts);
+            tbox::Pointer<CellDataType> v = new CellDataType(box, depth, V_ghosts);
+            fill_data(u->getArrayData(), 1.0);
+            fill_data(v->getArrayData(), 2.0);
+            for (const bool damped : { false, true })
+            {
+                for (const bool add : { false, true })
+                {
+                    const double beta = damped ? 0.4 : 0.0;
+                    const double gamma = add ? 0.7 : 0.0;
+                    tbox::Pointer<CellDataType> f_cxx = new CellDataType(box, depth, F_ghosts);
+                    tbox::Pointer<CellDataType> f_fortran = new CellDataType(box, depth, F_ghosts);
+                    fill_data(f_cxx->getArrayData(), 3.0);
+                    f_fortran->copy(*f_cxx);
+
+                    const tbox::Pointer<CellDataType> src2 = add ? v : tbox::Pointer<CellDataType>();
+                    patch_math_ops.laplace(f_cxx, alpha, beta, u, gamma, src2, patch, l, m, n);
+                    fortran_laplace(f_fortran->getPointer(l),
+                                    F_gcw,
+                                    alpha,
+                                    beta,
+                                    u->getPointer(m),
+                                    U_gcw,
+                                    gamma,
+                                    add ? v->getPointer(n) : nullptr,
+                                    V_gcw,
+                                    box,
+                                    dx);
+                    out << "cell-centered laplace (damped = " << damped << ", add = " << add
+                        << ") agrees with Fortran: "
+                        << (relative_difference(f_cxx->getArrayData(), f_fortran->getArrayData()) < tol) << "\n";
+                }
+            }
+        }
+
+        // Side-centered data.  Each component is computed on the patch box
+        // extended by one index along the component's axis.
+        {
+            using SideDataType = pdat::SideData<NDIM, double>;
+            tbox::Pointer<SideDataType> u = new SideDataType(box, depth, U_ghosts);
+            tbox::Pointer<SideDataType> v = new SideDataType(box, depth, V_ghosts);
+            fill_data(*u, 1.0);
+            fill_data(*v, 2.0);
+            for (const bool damped : { false, true })
+            {
+                for (const bool add : { false, true })
+                {
+                    const double beta = damped ? 0.4 : 0.0;
+                    const double gamma = add ? 0.7 : 0.0;
+                    tbox::Pointer<SideDataType> f_cxx = new SideDataType(box, depth, F_ghosts);
+                    tbox::Pointer<SideDataType> f_fortran = new SideDataType(box, depth, F_ghosts);
+                    fill_data(*f_cxx, 3.0);
+                    f_fortran->copy(*f_cxx);
+
+                    const tbox::Pointer<SideDataType> src2 = add ? v : tbox::Pointer<SideDataType>();
+                    patch_math_ops.laplace(f_cxx, alpha, beta, u, gamma, src2, patch, l, m, n);
+                    for (unsigned int axis = 0; axis < NDIM; ++axis)
+                    {
+                        hier::Box<NDIM> side_box = box;
+                        side_box.upper(axis) += 1;
+                        fortran_laplace(f_fortran->getPointer(axis, l),
+                                        F_gcw,
+                                        alpha,
+                                        beta,
+                                        u->getPointer(axis, m),
+                                        U_gcw,
+                                        gamma,
+                                        add ? v->getPointer(axis, n) : nullptr,
+                                        V_gcw,
+                                        side_box,
+                                        dx);
+                    }
+                    out << "side-centered laplace (damped = " << damped << ", add = " << add
+                        << ") agrees with Fortran: " << (relative_difference(*f_cxx, *f_fortran) < tol) << "\n";
+                }
+            }
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    tbox::SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,718 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Check that the C++ patch smoothers give the same results as the Fortran
+// smoothers that they replace after a fixed number of sweeps.
+
+#include <IBTK_config.h>
+
+#include <ibtk/patch_smoothers.h>
+
+#include <tbox/SAMRAIManager.h>
+#include <tbox/SAMRAI_MPI.h>
+
+#include <petscsys.h>
+
+#include <ArrayData.h>
+#include <Box.h>
+#include <EdgeData.h>
+#include <NodeData.h>
+#include <SideData.h>
+
+#include <SAMRAI_config.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+using namespace SAMRAI;
+
+// Reference Fortran implementations of the patch smoothers.
+#if (NDIM == 2)
+#define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth2d, GSSMOOTH2D)
+#define GS_SMOOTH_MASK_FC IBTK_FC_FUNC(gssmoothmask2d, GSSMOOTHMASK2D)
+#define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth2d, RBGSSMOOTH2D)
+#define RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(rbgssmoothmask2d, RBGSSMOOTHMASK2D)
+#define VC_CELL_GS_SMOOTH_FC IBTK_FC_FUNC(vccellgssmooth2d, VCCELLGSSMOOTH2D)
+#define VC_CELL_RB_GS_SMOOTH_FC IBTK_FC_FUNC(vccellrbgssmooth2d, VCCELLRBGSSMOOTH2D)
+#define VC_GS_SMOOTH_FC IBTK_FC_FUNC(vcgssmooth2d, VCGSSMOOTH2D)
+#define VC_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(vcgssmoothmask2d, VCGSSMOOTHMASK2D)
+#define VC_RB_GS_SMOOTH_FC IBTK_FC_FUNC(vcrbgssmooth2d, VCRBGSSMOOTH2D)
+#define VC_RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(vcrbgssmoothmask2d, VCRBGSSMOOTHMASK2D)
+#endif
+#if (NDIM == 3)
+#define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth3d, GSSMOOTH3D)
+#define GS_SMOOTH_MASK_FC IBTK_FC_FUNC(gssmoothmask3d, GSSMOOTHMASK3D)
+#define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth3d, RBGSSMOOTH3D)
+#define RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(rbgssmoothmask3d, RBGSSMOOTHMASK3D)
+#define VC_CELL_GS_SMOOTH_FC IBTK_FC_FUNC(vccellgssmooth3d, VCCELLGSSMOOTH3D)
+#define VC_CELL_RB_GS_SMOOTH_FC IBTK_FC_FUNC(vccellrbgssmooth3d, VCCELLRBGSSMOOTH3D)
+#define VC_GS_SMOOTH_FC IBTK_FC_FUNC(vcgssmooth3d, VCGSSMOOTH3D)
+#define VC_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(vcgssmoothmask3d, VCGSSMOOTHMASK3D)
+#define VC_RB_GS_SMOOTH_FC IBTK_FC_FUNC(vcrbgssmooth3d, VCRBGSSMOOTH3D)
+#define VC_RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(vcrbgssmoothmask3d, VCRBGSSMOOTHMASK3D)
+#endif
+
+extern "C"
+{
+    void GS_SMOOTH_FC(double* U,
+                      const int& U_gcw,
+                      const double& alpha,
+                      const double& beta,
+                      const double* F,
+                      const int& F_gcw,
+                      const int& ilower0,
+                      const int& iupper0,
+                      const int& ilower1,
+                      const int& iupper1,
+#if (NDIM == 3)
+                      const int& ilower2,
+                      const int& iupper2,
+#endif
+                      const double* dx);
+
+    void GS_SMOOTH_MASK_FC(double* U,
+                           const int& U_gcw,
+                           const double& alpha,
+                           const double& beta,
+                           const double* F,
+                           const int& F_gcw,
+                           const int* mask,
+                           const int& mask_gcw,
+                           const int& ilower0,
+                           const int& iupper0,
+                           const int& ilower1,
+                           const int& iupper1,
+#if (NDIM == 3)
+                           const int& ilower2,
+                           const int& iupper2,
+#endif
+                           const double* dx);
+
+    void RB_GS_SMOOTH_FC(double* U,
+                         const int& U_gcw,
+                         const double& alpha,
+                         const double& beta,
+                         const double* F,
+                         const int& F_gcw,
+                         const int& ilower0,
+                         const int& iupper0,
+                         const int& ilower1,
+                         const int& iupper1,
+#if (NDIM == 3)
+                         const int& ilower2,
+                         const int& iupper2,
+#endif
+                         const double* dx,
+                         const int& red_or_black);
+
+    void RB_GS_SMOOTH_MASK_FC(double* U,
+                              const int& U_gcw,
+                              const double& alpha,
+                              const double& beta,
+                              const double* F,
+                              const int& F_gcw,
+                              const int* mask,
+                              const int& mask_gcw,
+                              const int& ilower0,
+                              const int& iupper0,
+                              const int& ilower1,
+                              const int& iupper1,
+#if (NDIM == 3)
+                              const int& ilower2,
+                              const int& iupper2,
+#endif
+                              const double* dx,
+                              const int& red_or_black);
+
+    void VC_CELL_GS_SMOOTH_FC(double* U,
+                              const int& U_gcw,
+                              const double* alpha0,
+                              const double* alpha1,
+#if (NDIM == 3)
+                              const double* alpha2,
+#endif
+                              const int& alpha_gcw,
+                              const double& beta,
+                              const double* F,
+                              const int& F_gcw,
+                              const int& ilower0,
+                              const int& iupper0,
+                              const int& ilower1,
+                              const int& iupper1,
+#if (NDIM == 3)
+                              const int& ilower2,
+                              const int& iupper2,
+#endif
+                              const double* dx);
+
+    void VC_CELL_RB_GS_SMOOTH_FC(double* U,
+                                 const int& U_gcw,
+                                 const double* alpha0,
+                                 const double* alpha1,
+#if (NDIM == 3)
+                                 const double* alpha2,
+#endif
+                                 const int& alpha_gcw,
+                                 const double& beta,
+                                 const double* F,
+                                 const int& F_gcw,
+                                 const int& ilower0,
+                                 const int& iupper0,
+                                 const int& ilower1,
+                                 const int& iupper1,
+#if (NDIM == 3)
+                                 const int& ilower2,
+                                 const int& iupper2,
+#endif
+                                 const double* dx,
+                                 const int& red_or_black);
+
+    void VC_GS_SMOOTH_FC(double* U0,
+                         double* U1,
+#if (NDIM == 3)
+                         double* U2,
+#endif
+                         const int& U_gcw,
+                         const double* F0,
+                         const double* F1,
+#if (NDIM == 3)
+                         const double* F2,
+#endif
+                         const int& F_gcw,
+                         const double* C0,
+                         const double* C1,
+#if (NDIM == 3)
+                         const double* C2,
+#endif
+                         const int& C_gcw,
+#if (NDIM == 2)
+                         const double* mu,
+#endif
+#if (NDIM == 3)
+                         const double* mu0,
+                         const double* mu1,
+                         const double* mu2,
+#endif
+                         const int& mu_gcw,
+                         const double& alpha,
+                         const double& beta,
+                         const int& ilower0,
+                         const int& iupper0,
+                         const int& ilower1,
+                         const int& iupper1,
+#if (NDIM == 3)
+                         const int& ilower2,
+                         const int& iupper2,
+#endif
+                         const double* dx,
+                         const int& var_c,
+                         const int& use_harmonic_interp);
+
+    void VC_GS_SMOOTH_MASK_FC(double* U0,
+                              double* U1,
+#if (NDIM == 3)
+                              double* U2,
+#endif
+                              const int& U_gcw,
+                              const double* F0,
+                              const double* F1,
+#if (NDIM == 3)
+                              const double* F2,
+#endif
+                              const int& F_gcw,
+                              const int* mask0,
+                              const int* mask1,
+#if (NDIM == 3)
+                              const int* mask2,
+#endif
+                              const int& mask_gcw,
+                              const double* C0,
+                              const double* C1,
+#if (NDIM == 3)
+                              const double* C2,
+#endif
+                              const int& C_gcw,
+#if (NDIM == 2)
+                              const double* mu,
+#endif
+#if (NDIM == 3)
+                              const double* mu0,
+                              const double* mu1,
+                              const double* mu2,
+#endif
+                              const int& mu_gcw,
+                              const double& alpha,
+                              const double& beta,
+                              const int& ilower0,
+                              const int& iupper0,
+                              const int& ilower1,
+                              const int& iupper1,
+#if (NDIM == 3)
+                              const int& ilower2,
+                              const int& iupper2,
+#endif
+                              const double* dx,
+                              const int& var_c,
+                              const int& use_harmonic_interp);
+
+    void VC_RB_GS_SMOOTH_FC(double* U0,
+                            double* U1,
+#if (NDIM == 3)
+                            double* U2,
+#endif
+                            const int& U_gcw,
+                            const double* F0,
+                            const double* F1,
+#if (NDIM == 3)
+                            const double* F2,
+#endif
+                            const int& F_gcw,
+                            const double* C0,
+                            const double* C1,
+#if (NDIM == 3)
+                            const double* C2,
+#endif
+                            const int& C_gcw,
+#if (NDIM == 2)
+                            const double* mu,
+#endif
+#if (NDIM == 3)
+                            const double* mu0,
+                            const double* mu1,
+                            const double* mu2,
+#endif
+                            const int& mu_gcw,
+                            const double& alpha,
+                            const double& beta,
+                            const int& ilower0,
+                            const int& iupper0,
+                            const int& ilower1,
+                            const int& iupper1,
+#if (NDIM == 3)
+                            const int& ilower2,
+                            const int& iupper2,
+#endif
+                            const double* dx,
+                            const int& var_c,
+                            const int& use_harmonic_interp,
+                            const int& red_or_black);
+
+    void VC_RB_GS_SMOOTH_MASK_FC(double* U0,
+                                 double* U1,
+#if (NDIM == 3)
+                                 double* U2,
+#endif
+                                 const int& U_gcw,
+                                 const double* F0,
+                                 const double* F1,
+#if (NDIM == 3)
+                                 const double* F2,
+#endif
+                                 const int& F_gcw,
+                                 const int* mask0,
+                                 const int* mask1,
+#if (NDIM == 3)
+                                 const int* mask2,
+#endif
+                                 const int& mask_gcw,
+                                 const double* C0,
+                                 const double* C1,
+#if (NDIM == 3)
+                                 const double* C2,
+#endif
+                                 const int& C_gcw,
+#if (NDIM == 2)
+                                 const double* mu,
+#endif
+#if (NDIM == 3)
+                                 const double* mu0,
+                                 const double* mu1,
+                                 const double* mu2,
+#endif
+                                 const int& mu_gcw,
+                                 const double& alpha,
+                                 const double& beta,
+                                 const int& ilower0,
+                                 const int& iupper0,
+                                 const int& ilower1,
+                                 const int& iupper1,
+#if (NDIM == 3)
+                                 const int& ilower2,
+                                 const int& iupper2,
+#endif
+                                 const double* dx,
+                                 const int& var_c,
+                                 const int& use_harmonic_interp,
+                                 const int& red_or_black);
+}
+
+#if (NDIM == 2)
+#define BOX_BOUNDS(box) box.lower(0), box.upper(0), box.lower(1), box.upper(1)
+#define SIDE_POINTERS(data, depth) data.getPointer(0, depth), data.getPointer(1, depth)
+#define MU_POINTERS(data, depth) data.getPointer(depth)
+#endif
+#if (NDIM == 3)
+#define BOX_BOUNDS(box) box.lower(0), box.upper(0), box.lower(1), box.upper(1), box.lower(2), box.upper(2)
+#define SIDE_POINTERS(data, depth) data.getPointer(0, depth), data.getPointer(1, depth), data.getPointer(2, depth)
+#define MU_POINTERS(data, depth) data.getPointer(0, depth), data.getPointer(1, depth), data.getPointer(2, depth)
+#endif
+
+namespace
+{
+// Fill the data (including ghost cells) with deterministic values in the range
+// [shift - scale, shift + scale].
+template <typename T>
+void
+fill_data(pdat::ArrayData<NDIM, T>& data, const double seed, const double shift, const double scale)
+{
+    const int n_vals = data.getBox().size();
+    for (int depth = 0; depth < data.getDepth(); ++depth)
+    {
+        T* const vals = data.getPointer(depth);
+        for (int k = 0; k < n_vals; ++k)
+        {
+            vals[k] = static_cast<T>(shift + scale * std::sin(seed + 0.37 * k + 0.001 * k * k + 1.3 * depth));
+        }
+    }
+    return;
+}
+
+// Mask out roughly one in five degrees of freedom.
+void
+fill_mask(pdat::ArrayData<NDIM, int>& mask, const int seed)
+{
+    const int n_vals = mask.getBox().size();
+    for (int depth = 0; depth < mask.getDepth(); ++depth)
+    {
+        int* const vals = mask.getPointer(depth);
+        for (int k = 0; k < n_vals; ++k) vals[k] = ((7 * k + seed + depth) % 5 == 0) ? 1 : 0;
+    }
+    return;
+}
+
+// Return the largest difference between the values (including ghost cells)
+// relative to the largest value of u.
+double
+relative_difference(const pdat::ArrayData<NDIM, double>& u, const pdat::ArrayData<NDIM, double>& v)
+{
+    double max_diff = 0.0, max_val = 0.0;
+    const int n_vals = u.getBox().size();
+    for (int depth = 0; depth < u.getDepth(); ++depth)
+    {
+        for (int k = 0; k < n_vals; ++k)
+        {
+            max_diff = std::max(max_diff, std::abs(u.getPointer(depth)[k] - v.getPointer(depth)[k]));
+            max_val = std::max(max_val, std::abs(u.getPointer(depth)[k]));
+        }
+    }
+    return max_diff / max_val;
+}
+
+double
+relative_difference(const pdat::SideData<NDIM, double>& u, const pdat::SideData<NDIM, double>& v)
+{
+    double diff = 0.0;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        diff = std::max(diff, relative_difference(u.getArrayData(axis), v.getArrayData(axis)));
+    }
+    return diff;
+}
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    tbox::SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    tbox::SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    tbox::SAMRAIManager::startup();
+
+    std::ofstream out("output");
+
+    // Use a box that spans several tiles along axes 0 and 1 and whose extents
+    // are not multiples of the tile widths.
+#if (NDIM == 2)
+    const hier::Box<NDIM> box(hier::Index<NDIM>(3, 2), hier::Index<NDIM>(80, 40));
+    const double dx[NDIM] = { 0.1, 0.07 };
+#endif
+#if (NDIM == 3)
+    const hier::Box<NDIM> box(hier::Index<NDIM>(1, 4, 0), hier::Index<NDIM>(70, 25, 7));
+    const double dx[NDIM] = { 0.1, 0.07, 0.12 };
+#endif
+    const int gcw = 1;
+    const int depth = 2;
+    const int num_sweeps = 4;
+    const double tol = 1.0e-12;
+
+    // Constant-coefficient smoothers for cell-centered data.
+    {
+        const hier::Box<NDIM> ghost_box = hier::Box<NDIM>::grow(box, hier::IntVector<NDIM>(gcw));
+        pdat::ArrayData<NDIM, double> u(ghost_box, depth), f(ghost_box, depth);
+        pdat::ArrayData<NDIM, int> mask(ghost_box, depth);
+        fill_data(u, 1.0, 0.0, 1.0);
+        fill_data(f, 2.0, 0.0, 1.0);
+        fill_mask(mask, 3);
+        const double alpha = -1.3, beta = 0.4;
+        for (const bool use_mask : { false, true })
+        {
+            for (const bool red_black : { false, true })
+            {
+                pdat::ArrayData<NDIM, double> u_cxx(ghost_box, depth), u_fortran(ghost_box, depth);
+                u_cxx.copy(u);
+                u_fortran.copy(u);
+                for (int sweep = 0; sweep < num_sweeps; ++sweep)
+                {
+                    const int red_or_black = sweep % 2;
+                    for (int d = 0; d < depth; ++d)
+                    {
+                        double* const U = u_fortran.getPointer(d);
+                        const double* const F = f.getPointer(d);
+                        const int* const M = mask.getPointer(d);
+                        if (red_black)
+                        {
+                            IBTK::rb_gs_smooth(
+                                u_cxx, f, d, box, alpha, beta, dx, red_or_black, use_mask ? &mask : nullptr);
+                            if (use_mask)
+                            {
+                                RB_GS_SMOOTH_MASK_FC(
+                                    U, gcw, alpha, beta, F, gcw, M, gcw, BOX_BOUNDS(box), dx, red_or_black);
+                            }
+                            else
+                            {
+                                RB_GS_SMOOTH_FC(U, gcw, alpha, beta, F, gcw, BOX_BOUNDS(box), dx, red_or_black);
+                            }
+                        }
+                        else
+                        {
+                            IBTK::gs_smooth(u_cxx, f, d, box, alpha, beta, dx, use_mask ? &mask : nullptr);
+                            if (use_mask)
+                            {
+                                GS_SMOOTH_MASK_FC(U, gcw, alpha, beta, F, gcw, M, gcw, BOX_BOUNDS(box), dx);
+                            }
+                            else
+                            {
+                                GS_SMOOTH_FC(U, gcw, alpha, beta, F, gcw, BOX_BOUNDS(box), dx);
+                            }
+                        }
+                    }
+                }
+                out << (red_black ? "rb_gs_smooth" : "gs_smooth") << (use_mask ? " with mask" : "")
+                    << " agrees with Fortran: " << (relative_difference(u_cxx, u_fortran) < tol) << "\n";
+            }
+        }
+    }
+
+    // Variable-coefficient smoothers for cell-centered data.
+    {
+        const hier::Box<NDIM> ghost_box = hier::Box<NDIM>::grow(box, hier::IntVector<NDIM>(gcw));
+        pdat::ArrayData<NDIM, double> u(ghost_box, depth), f(ghost_box, depth);
+        pdat::SideData<NDIM, double> alpha(box, depth, hier::IntVector<NDIM>(gcw));
+        fill_data(u, 1.0, 0.0, 1.0);
+        fill_data(f, 2.0, 0.0, 1.0);
+        for (unsigned int axis = 0; axis < NDIM; ++axis) fill_data(alpha.getArrayData(axis), 4.0 + axis, -1.5, 0.5);
+        const double beta = 0.3;
+        for (const bool red_black : { false, true })
+        {
+            pdat::ArrayData<NDIM, double> u_cxx(ghost_box, depth), u_fortran(ghost_box, depth);
+            u_cxx.copy(u);
+            u_fortran.copy(u);
+            for (int sweep = 0; sweep < num_sweeps; ++sweep)
+            {
+                const int red_or_black = sweep % 2;
+                for (int d = 0; d < depth; ++d)
+                {
+                    double* const U = u_fortran.getPointer(d);
+                    const double* const F = f.getPointer(d);
+                    if (red_black)
+                    {
+                        IBTK::vc_cell_rb_gs_smooth(u_cxx, alpha, beta, f, d, box, dx, red_or_black);
+                        VC_CELL_RB_GS_SMOOTH_FC(
+                            U, gcw, SIDE_POINTERS(alpha, d), gcw, beta, F, gcw, BOX_BOUNDS(box), dx, red_or_black);
+                    }
+                    else
+                    {
+                        IBTK::vc_cell_gs_smooth(u_cxx, alpha, beta, f, d, box, dx);
+                        VC_CELL_GS_SMOOTH_FC(U, gcw, SIDE_POINTERS(alpha, d), gcw, beta, F, gcw, BOX_BOUNDS(box), dx);
+                    }
+                }
+            }
+            out << (red_black ? "vc_cell_rb_gs_smooth" : "vc_cell_gs_smooth")
+                << " agrees with Fortran: " << (relative_difference(u_cxx, u_fortran) < tol) << "\n";
+        }
+    }
+
+    // Variable-coefficient smoothers for side-centered data.
+    {
+        pdat::SideData<NDIM, double> u(box, depth, hier::IntVector<NDIM>(gcw));
+        pdat::SideData<NDIM, double> f(box, depth, hier::IntVector<NDIM>(gcw));
+        pdat::SideData<NDIM, double> c(box, depth, hier::IntVector<NDIM>(gcw));
+        pdat::SideData<NDIM, int> mask(box, depth, hier::IntVector<NDIM>(gcw));
+        IBTK::ViscosityPatchData mu(box, depth, hier::IntVector<NDIM>(gcw));
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            fill_data(u.getArrayData(axis), 1.0 + axis, 0.0, 1.0);
+            fill_data(f.getArrayData(axis), 5.0 + axis, 0.0, 1.0);
+            fill_data(c.getArrayData(axis), 9.0 + axis, 1.0, 0.5);
+            fill_mask(mask.getArrayData(axis), axis);
+        }
+#if (NDIM == 2)
+        fill_data(mu.getArrayData(), 13.0, 1.5, 0.5);
+#endif
+#if (NDIM == 3)
+        for (unsigned int axis = 0; axis < NDIM; ++axis) fill_data(mu.getArrayData(axis), 13.0 + axis, 1.5, 0.5);
+#endif
+        const double alpha = 0.8;
+        for (const bool use_mask : { false, true })
+        {
+            for (const bool var_c : { false, true })
+            {
+                for (const bool use_harmonic_interp : { false, true })
+                {
+                    for (const bool red_black : { false, true })
+                    {
+                        const double beta = var_c ? 1.0 : -0.6;
+                        pdat::SideData<NDIM, double> u_cxx(box, depth, hier::IntVector<NDIM>(gcw));
+                        pdat::SideData<NDIM, double> u_fortran(box, depth, hier::IntVector<NDIM>(gcw));
+                        for (unsigned int axis = 0; axis < NDIM; ++axis)
+                        {
+                            u_cxx.getArrayData(axis).copy(u.getArrayData(axis));
+                            u_fortran.getArrayData(axis).copy(u.getArrayData(axis));
+                        }
+                        for (int sweep = 0; sweep < num_sweeps; ++sweep)
+                        {
+                            const int red_or_black = sweep % 2;
+                            for (int d = 0; d < depth; ++d)
+                            {
+                                const pdat::SideData<NDIM, int>* const mask_data = use_mask ? &mask : nullptr;
+                                const pdat::SideData<NDIM, double>* const c_data = var_c ? &c : nullptr;
+                                if (red_black)
+                                {
+                                    IBTK::vc_side_rb_gs_smooth(u_cxx,
+                                                               f,
+                                                               mask_data,
+                                                               c_data,
+                                                               mu,
+                                                               d,
+                                                               alpha,
+                                                               beta,
+                                                               box,
+                                                               dx,
+                                                               use_harmonic_interp,
+                                                               red_or_black);
+                                    if (use_mask)
+                                    {
+                                        VC_RB_GS_SMOOTH_MASK_FC(SIDE_POINTERS(u_fortran, d),
+                                                                gcw,
+                                                                SIDE_POINTERS(f, d),
+                                                                gcw,
+                                                                SIDE_POINTERS(mask, d),
+                                                                gcw,
+                                                                SIDE_POINTERS(c, d),
+                                                                gcw,
+                                                                MU_POINTERS(mu, d),
+                                                                gcw,
+                                                                alpha,
+                                                                beta,
+                                                                BOX_BOUNDS(box),
+                                                                dx,
+                                                                var_c,
+                                                                use_harmonic_interp,
+                                                                red_or_black);
+                                    }
+                                    else
+                                    {
+                                        VC_RB_GS_SMOOTH_FC(SIDE_POINTERS(u_fortran, d),
+                                                           gcw,
+                                                           SIDE_POINTERS(f, d),
+                                                           gcw,
+                                                           SIDE_POINTERS(c, d),
+                                                           gcw,
+                                                           MU_POINTERS(mu, d),
+                                                           gcw,
+                                                           alpha,
+                                                           beta,
+                                                           BOX_BOUNDS(box),
+                                                           dx,
+                                                           var_c,
+                                                           use_harmonic_interp,
+                                                           red_or_black);
+                                    }
+                                }
+                                else
+                                {
+                                    IBTK::vc_side_gs_smooth(u_cxx,
+                                                            f,
+                                                            mask_data,
+                                                            c_data,
+                                                            mu,
+                                                            d,
+                                                            alpha,
+                                                            beta,
+                                                            box,
+                                                            dx,
+                                                            use_harmonic_interp);
+                                    if (use_mask)
+                                    {
+                                        VC_GS_SMOOTH_MASK_FC(SIDE_POINTERS(u_fortran, d),
+                                                             gcw,
+                                                             SIDE_POINTERS(f, d),
+                                                             gcw,
+                                                             SIDE_POINTERS(mask, d),
+                                                             gcw,
+                                                             SIDE_POINTERS(c, d),
+                                                             gcw,
+                                                             MU_POINTERS(mu, d),
+                                                             gcw,
+                                                             alpha,
+                                                             beta,
+                                                             BOX_BOUNDS(box),
+                                                             dx,
+                                                             var_c,
+                                                             use_harmonic_interp);
+                                    }
+                                    else
+                                    {
+                                        VC_GS_SMOOTH_FC(SIDE_POINTERS(u_fortran, d),
+                                                        gcw,
+                                                        SIDE_POINTERS(f, d),
+                                                        gcw,
+                                                        SIDE_POINTERS(c, d),
+                                                        gcw,
+                                                        MU_POINTERS(mu, d),
+                                                        gcw,
+                                                        alpha,
+                                                        beta,
+                                                        BOX_BOUNDS(box),
+                                                        dx,
+                                                        var_c,
+                                                        use_harmonic_interp);
+                                    }
+                                }
+                            }
+                        }
+                        out << (red_black ? "vc_side_rb_gs_smooth" : "vc_side_gs_smooth")
+                            << " (mask = " << use_mask << ", variable C = " << var_c
+                            << ", harmonic = " << use_harmonic_interp
+                            << ") agrees with Fortran: " << (relative_difference(u_cxx, u_fortran) < tol) << "\n";
+                    }
+                }
+            }
+        }
+    }
+
+    tbox::SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
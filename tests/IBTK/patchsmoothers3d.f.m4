@@ -10,7 +10,11 @@ c license. The full text of the license can be found in the file
 c COPYRIGHT at the top level directory of IBAMR.
 c
 c ---------------------------------------------------------------------
-
+c
+c Reference implementations of the patch smoothers declared in
+c ibtk/patch_smoothers.h. These routines are only compiled into
+c patch_smoothers_01, which checks the C++ smoothers against them.
+c
 define(NDIM,3)dnl
 define(REAL,`double precision')dnl
 define(INTEGER,`integer')dnl
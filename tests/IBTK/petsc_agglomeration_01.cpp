@@ -0,0 +1,154 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCPoissonPETScLevelSolver.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <fstream>
+#include <string>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Verify that PETScLevelSolver gives the same solution when the level system is
+// agglomerated onto fewer processes (see agglomeration_reduction_factor) as when
+// it is solved on all processes.
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "petsc_agglomeration.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_cc");
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, ctx, IntVector<NDIM>(1));
+        const int v_cc_idx = var_db->registerClonedPatchDataIndex(u_cc_var, u_cc_idx);
+        const int f_cc_idx = var_db->registerClonedPatchDataIndex(u_cc_var, u_cc_idx);
+        const int e_cc_idx = var_db->registerClonedPatchDataIndex(u_cc_var, u_cc_idx);
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        level->allocatePatchData(u_cc_idx, 0.0);
+        level->allocatePatchData(v_cc_idx, 0.0);
+        level->allocatePatchData(f_cc_idx, 0.0);
+        level->allocatePatchData(e_cc_idx, 0.0);
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> v_vec("v", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> e_vec("e", patch_hierarchy, 0, 0);
+
+        u_vec.addComponent(u_cc_var, u_cc_idx, h_cc_idx);
+        v_vec.addComponent(u_cc_var, v_cc_idx, h_cc_idx);
+        f_vec.addComponent(u_cc_var, f_cc_idx, h_cc_idx);
+        e_vec.addComponent(u_cc_var, e_cc_idx, h_cc_idx);
+
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        f_fcn.setDataOnPatchHierarchy(f_cc_idx, u_cc_var, patch_hierarchy, 0.0);
+
+        // Solve (I - L) u = f with and without agglomeration.
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCConstant(1.0);
+        poisson_spec.setDConstant(-1.0);
+
+        Pointer<Database> reference_db = input_db->getDatabase("reference_solver_db");
+        CCPoissonPETScLevelSolver reference_solver("reference_solver", reference_db, "reference_");
+        reference_solver.setPoissonSpecifications(poisson_spec);
+        reference_solver.initializeSolverState(u_vec, f_vec);
+        u_vec.setToScalar(0.0);
+        reference_solver.solveSystem(u_vec, f_vec);
+
+        Pointer<Database> agglomerated_db = input_db->getDatabase("agglomerated_solver_db");
+        CCPoissonPETScLevelSolver agglomerated_solver("agglomerated_solver", agglomerated_db, "agglomerated_");
+        agglomerated_solver.setPoissonSpecifications(poisson_spec);
+        agglomerated_solver.initializeSolverState(v_vec, f_vec);
+        v_vec.setToScalar(0.0);
+        const bool converged = agglomerated_solver.solveSystem(v_vec, f_vec);
+
+        e_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&v_vec, false),
+                       Pointer<SAMRAIVectorReal<NDIM, double> >(&u_vec, false));
+        const double tol = input_db->getDouble("tol");
+
+        std::ofstream out;
+        if (SAMRAI_MPI::getRank() == 0) out.open("output");
+        out << "agglomerated solve converged: " << converged << "\n";
+        out << "agglomerated solution agrees with reference solution: " << (e_vec.maxNorm() <= tol * u_vec.maxNorm())
+            << "\n";
+        // An exact solve of the agglomerated system makes the outer Krylov
+        // method converge in a single iteration.
+        if (agglomerated_db->getStringWithDefault("agglomeration_pc_type", "lu") == "lu")
+        {
+            out << "agglomerated solve iterations: " << agglomerated_solver.getNumIterations() << "\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,259 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCPoissonPETScLevelSolver.h>
+#include <ibtk/CCPoissonSolverManager.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/SCPoissonPETScLevelSolver.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Verify that solvers whose problem coefficients are changed with
+// updateProblemCoefficients() give the same results as solvers that are
+// reinitialized from scratch with deallocateSolverState() and
+// initializeSolverState(). This covers the PETSc level solvers with the shell
+// (additive and multiplicative Schwarz) and ASM preconditioners and a Krylov
+// solver preconditioned by FAC with a PETSc coarse level solver.
+
+namespace
+{
+double
+max_difference(SAMRAIVectorReal<NDIM, double>& d_vec,
+               SAMRAIVectorReal<NDIM, double>& a_vec,
+               SAMRAIVectorReal<NDIM, double>& b_vec)
+{
+    d_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&a_vec, false),
+                   Pointer<SAMRAIVectorReal<NDIM, double> >(&b_vec, false));
+    return d_vec.maxNorm();
+}
+
+// Solve (C I + D L) u = f, change C and D with updateProblemCoefficients(),
+// and compare the new solution to the one obtained after reinitializing the
+// same solver.
+void
+test_update(std::ostream& out,
+            const std::string& label,
+            Pointer<PoissonSolver> solver,
+            SAMRAIVectorReal<NDIM, double>& f_vec,
+            SAMRAIVectorReal<NDIM, double>& u0_vec,
+            SAMRAIVectorReal<NDIM, double>& u1_vec,
+            SAMRAIVectorReal<NDIM, double>& d_vec,
+            const double tol)
+{
+    PoissonSpecifications poisson_spec("poisson_spec");
+    poisson_spec.setCConstant(1.0);
+    poisson_spec.setDConstant(-1.0);
+    solver->setPoissonSpecifications(poisson_spec);
+    solver->initializeSolverState(u0_vec, f_vec);
+    u0_vec.setToScalar(0.0);
+    solver->solveSystem(u0_vec, f_vec);
+
+    poisson_spec.setCConstant(2.0);
+    poisson_spec.setDConstant(-0.5);
+    solver->setPoissonSpecifications(poisson_spec);
+    const bool updated = solver->updateProblemCoefficients();
+    u0_vec.setToScalar(0.0);
+    const bool converged = solver->solveSystem(u0_vec, f_vec);
+
+    solver->deallocateSolverState();
+    solver->initializeSolverState(u1_vec, f_vec);
+    u1_vec.setToScalar(0.0);
+    solver->solveSystem(u1_vec, f_vec);
+    solver->deallocateSolverState();
+
+    out << label << ": coefficients updated in place: " << updated << "\n";
+    out << label << ": converged after update: " << converged << "\n";
+    out << label << ": solution agrees with reinitialized solver: "
+        << (max_difference(d_vec, u0_vec, u1_vec) <= tol * u1_vec.maxNorm()) << "\n";
+}
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "update_coefficients.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > cc_var = new CellVariable<NDIM, double>("cc");
+        Pointer<SideVariable<NDIM, double> > sc_var = new SideVariable<NDIM, double>("sc");
+        const int cc_idx = var_db->registerVariableAndContext(cc_var, ctx, IntVector<NDIM>(1));
+        const int sc_idx = var_db->registerVariableAndContext(sc_var, ctx, IntVector<NDIM>(1));
+        std::vector<int> cc_idxs, sc_idxs;
+        for (int k = 0; k < 4; ++k)
+        {
+            cc_idxs.push_back(var_db->registerClonedPatchDataIndex(cc_var, cc_idx));
+            sc_idxs.push_back(var_db->registerClonedPatchDataIndex(sc_var, sc_idx));
+        }
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (int k = 0; k < 4; ++k)
+            {
+                level->allocatePatchData(cc_idxs[k], 0.0);
+                level->allocatePatchData(sc_idxs[k], 0.0);
+            }
+        }
+
+        // Setup vector objects. The level solvers act on the coarsest level and
+        // the FAC-preconditioned solver acts on the whole hierarchy.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        const int h_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+        const std::vector<std::string> vec_names = { "f", "u0", "u1", "d" };
+        std::vector<std::unique_ptr<SAMRAIVectorReal<NDIM, double> > > cc_level_vecs, sc_level_vecs, cc_vecs;
+        for (int k = 0; k < 4; ++k)
+        {
+            cc_level_vecs.emplace_back(
+                new SAMRAIVectorReal<NDIM, double>(vec_names[k] + "_cc_level", patch_hierarchy, 0, 0));
+            cc_level_vecs[k]->addComponent(cc_var, cc_idxs[k], h_cc_idx);
+            sc_level_vecs.emplace_back(
+                new SAMRAIVectorReal<NDIM, double>(vec_names[k] + "_sc_level", patch_hierarchy, 0, 0));
+            sc_level_vecs[k]->addComponent(sc_var, sc_idxs[k], h_sc_idx);
+            cc_vecs.emplace_back(
+                new SAMRAIVectorReal<NDIM, double>(vec_names[k] + "_cc", patch_hierarchy, 0, finest_ln));
+            cc_vecs[k]->addComponent(cc_var, cc_idxs[k], h_cc_idx);
+        }
+
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        f_fcn.setDataOnPatchHierarchy(cc_idxs[0], cc_var, patch_hierarchy, 0.0);
+        f_fcn.setDataOnPatchHierarchy(sc_idxs[0], sc_var, patch_hierarchy, 0.0);
+
+        std::ofstream out;
+        if (SAMRAI_MPI::getRank() == 0) out.open("output");
+        const double tol = input_db->getDouble("tol");
+
+        for (const std::string shell_pc_type : { "additive", "multiplicative" })
+        {
+            Pointer<Database> solver_db = input_db->getDatabase("shell_solver_db");
+            solver_db->putString("shell_pc_type", shell_pc_type);
+            test_update(out,
+                        "cc level solver, " + shell_pc_type + " shell preconditioner",
+                        new CCPoissonPETScLevelSolver("cc_shell_solver", solver_db, "cc_shell_"),
+                        *cc_level_vecs[0],
+                        *cc_level_vecs[1],
+                        *cc_level_vecs[2],
+                        *cc_level_vecs[3],
+                        tol);
+        }
+
+        test_update(out,
+                    "cc level solver, asm preconditioner",
+                    new CCPoissonPETScLevelSolver("cc_asm_solver", input_db->getDatabase("asm_solver_db"), "cc_asm_"),
+                    *cc_level_vecs[0],
+                    *cc_level_vecs[1],
+                    *cc_level_vecs[2],
+                    *cc_level_vecs[3],
+                    tol);
+
+        test_update(out,
+                    "sc level solver, asm preconditioner",
+                    new SCPoissonPETScLevelSolver("sc_asm_solver", input_db->getDatabase("asm_solver_db"), "sc_asm_"),
+                    *sc_level_vecs[0],
+                    *sc_level_vecs[1],
+                    *sc_level_vecs[2],
+                    *sc_level_vecs[3],
+                    tol);
+
+        test_update(out,
+                    "krylov solver, fac preconditioner",
+                    CCPoissonSolverManager::getManager()->allocateSolver(
+                        CCPoissonSolverManager::PETSC_KRYLOV_SOLVER,
+                        "krylov_solver",
+                        input_db->getDatabase("krylov_solver_db"),
+                        "krylov_",
+                        CCPoissonSolverManager::POINT_RELAXATION_FAC_PRECONDITIONER,
+                        "fac_precond",
+                        input_db->getDatabase("fac_precond_db"),
+                        "fac_"),
+                    *cc_vecs[0],
+                    *cc_vecs[1],
+                    *cc_vecs[2],
+                    *cc_vecs[3],
+                    tol);
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,297 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscvec.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IBTK_CHKERRQ.h>
+#include <ibtk/PETScSAMRAIVectorReal.h>
+
+#include <CellVariable.h>
+#include <SideVariable.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Verify that the fused VecMDot() and VecMAXPY() implementations of
+// PETScSAMRAIVectorReal agree with repeated calls to VecDot() and VecAXPY()
+// for cell- and side-centered vectors with one or more components of one or
+// more depths.
+
+namespace
+{
+void
+get_arrays(Pointer<PatchData<NDIM> > data, std::vector<ArrayData<NDIM, double>*>& arrays)
+{
+    arrays.clear();
+    Pointer<CellData<NDIM, double> > cc_data = data;
+    Pointer<SideData<NDIM, double> > sc_data = data;
+    if (cc_data) arrays.push_back(&cc_data->getArrayData());
+    if (sc_data)
+    {
+        for (unsigned int axis = 0; axis < NDIM; ++axis) arrays.push_back(&sc_data->getArrayData(axis));
+    }
+    TBOX_ASSERT(!arrays.empty());
+}
+
+// Set every value, including ghost values, to something that depends on the
+// index, the depth, and the seed.
+void
+fill_vector(SAMRAIVectorReal<NDIM, double>& vec, const double seed)
+{
+    Pointer<PatchHierarchy<NDIM> > hierarchy = vec.getPatchHierarchy();
+    std::vector<ArrayData<NDIM, double>*> arrays;
+    for (int ln = vec.getCoarsestLevelNumber(); ln <= vec.getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            for (int comp = 0; comp < vec.getNumberOfComponents(); ++comp)
+            {
+                get_arrays(patch->getPatchData(vec.getComponentDescriptorIndex(comp)), arrays);
+                for (unsigned int a = 0; a < arrays.size(); ++a)
+                {
+                    ArrayData<NDIM, double>& array = *arrays[a];
+                    for (int d = 0; d < array.getDepth(); ++d)
+                    {
+                        for (Box<NDIM>::Iterator b(array.getBox()); b; b++)
+                        {
+                            const hier::Index<NDIM>& i = b();
+                            double value = seed * (d + 1) + 0.25 * a + 0.5 * comp + 0.125 * ln;
+                            for (unsigned int k = 0; k < NDIM; ++k) value += std::sin(seed * (k + 1) * i(k));
+                            array(i, d) = value;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Compute the largest difference between two vectors over all indices,
+// including ghost indices.
+double
+max_difference(const SAMRAIVectorReal<NDIM, double>& u, const SAMRAIVectorReal<NDIM, double>& v)
+{
+    Pointer<PatchHierarchy<NDIM> > hierarchy = u.getPatchHierarchy();
+    std::vector<ArrayData<NDIM, double>*> u_arrays, v_arrays;
+    double max_diff = 0.0;
+    for (int ln = u.getCoarsestLevelNumber(); ln <= u.getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            for (int comp = 0; comp < u.getNumberOfComponents(); ++comp)
+            {
+                get_arrays(patch->getPatchData(u.getComponentDescriptorIndex(comp)), u_arrays);
+                get_arrays(patch->getPatchData(v.getComponentDescriptorIndex(comp)), v_arrays);
+                TBOX_ASSERT(u_arrays.size() == v_arrays.size());
+                for (unsigned int a = 0; a < u_arrays.size(); ++a)
+                {
+                    TBOX_ASSERT(u_arrays[a]->getBox() == v_arrays[a]->getBox());
+                    TBOX_ASSERT(u_arrays[a]->getDepth() == v_arrays[a]->getDepth());
+                    const int n_values = u_arrays[a]->getBox().size() * u_arrays[a]->getDepth();
+                    const double* const u_ptr = u_arrays[a]->getPointer();
+                    const double* const v_ptr = v_arrays[a]->getPointer();
+                    for (int k = 0; k < n_values; ++k) max_diff = std::max(max_diff, std::abs(u_ptr[k] - v_ptr[k]));
+                }
+            }
+        }
+    }
+    return SAMRAI_MPI::maxReduction(max_diff);
+}
+
+// Each component is described by a variable and a control volume index (or
+// -1 for no control volume).
+using ComponentList = std::vector<std::pair<Pointer<Variable<NDIM> >, int> >;
+
+void
+test(std::ofstream& out,
+     const std::string& name,
+     Pointer<PatchHierarchy<NDIM> > hierarchy,
+     Pointer<VariableContext> ctx,
+     const ComponentList& components)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    Pointer<SAMRAIVectorReal<NDIM, double> > x_vec = new SAMRAIVectorReal<NDIM, double>(name, hierarchy, 0, finest_ln);
+    for (const auto& component : components)
+    {
+        const int idx = var_db->registerVariableAndContext(component.first, ctx, IntVector<NDIM>(1));
+        x_vec->addComponent(component.first, idx, component.second);
+    }
+    x_vec->allocateVectorData();
+
+    static const int nv = 5;
+    std::vector<Pointer<SAMRAIVectorReal<NDIM, double> > > y_vecs(nv);
+    for (int i = 0; i < nv; ++i)
+    {
+        y_vecs[i] = x_vec->cloneVector(name + "_y" + std::to_string(i));
+        y_vecs[i]->allocateVectorData();
+    }
+    Pointer<SAMRAIVectorReal<NDIM, double> > z_fused_vec = x_vec->cloneVector(name + "_z_fused");
+    Pointer<SAMRAIVectorReal<NDIM, double> > z_ref_vec = x_vec->cloneVector(name + "_z_ref");
+    z_fused_vec->allocateVectorData();
+    z_ref_vec->allocateVectorData();
+
+    fill_vector(*x_vec, 1.0);
+    for (int i = 0; i < nv; ++i) fill_vector(*y_vecs[i], 0.3 * (i + 2));
+    fill_vector(*z_fused_vec, 0.7);
+    fill_vector(*z_ref_vec, 0.7);
+
+    Vec x = PETScSAMRAIVectorReal::createPETScVector(x_vec);
+    std::vector<Vec> y(nv);
+    for (int i = 0; i < nv; ++i) y[i] = PETScSAMRAIVectorReal::createPETScVector(y_vecs[i]);
+    Vec z_fused = PETScSAMRAIVectorReal::createPETScVector(z_fused_vec);
+    Vec z_ref = PETScSAMRAIVectorReal::createPETScVector(z_ref_vec);
+
+    // Compare the fused dot products with the per-vector ones.
+    std::vector<PetscScalar> mdot_vals(nv), dot_vals(nv);
+    int ierr = VecMDot(x, nv, y.data(), mdot_vals.data());
+    IBTK_CHKERRQ(ierr);
+    bool mdot_agrees = true;
+    for (int i = 0; i < nv; ++i)
+    {
+        ierr = VecDot(x, y[i], &dot_vals[i]);
+        IBTK_CHKERRQ(ierr);
+        mdot_agrees = mdot_agrees && std::abs(mdot_vals[i] - dot_vals[i]) <= 1.0e-12 * std::abs(dot_vals[i]);
+    }
+    out << name << ": VecMDot agrees with VecDot: " << mdot_agrees << "\n";
+
+    // Compare the fused update with the per-vector one. Use coefficients equal
+    // to +1 and -1 as well since VecAXPY() treats them separately.
+    const std::vector<PetscScalar> alpha = { 1.0, -0.5, -1.0, 2.0, 0.25 };
+    ierr = VecMAXPY(z_fused, nv, alpha.data(), y.data());
+    IBTK_CHKERRQ(ierr);
+    for (int i = 0; i < nv; ++i)
+    {
+        ierr = VecAXPY(z_ref, alpha[i], y[i]);
+        IBTK_CHKERRQ(ierr);
+    }
+    out << name << ": VecMAXPY agrees with VecAXPY: " << (max_difference(*z_fused_vec, *z_ref_vec) <= 1.0e-12)
+        << "\n";
+
+    PETScSAMRAIVectorReal::destroyPETScVector(x);
+    for (int i = 0; i < nv; ++i) PETScSAMRAIVectorReal::destroyPETScVector(y[i]);
+    PETScSAMRAIVectorReal::destroyPETScVector(z_fused);
+    PETScSAMRAIVectorReal::destroyPETScVector(z_ref);
+
+    x_vec->deallocateVectorData();
+    for (int i = 0; i < nv; ++i)
+    {
+        y_vecs[i]->deallocateVectorData();
+        y_vecs[i]->freeVectorComponents();
+    }
+    z_fused_vec->deallocateVectorData();
+    z_fused_vec->freeVectorComponents();
+    z_ref_vec->deallocateVectorData();
+    z_ref_vec->freeVectorComponents();
+}
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "vec_mdot.log");
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int wgt_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        const int wgt_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > cc_1_var = new CellVariable<NDIM, double>("cc_1");
+        Pointer<CellVariable<NDIM, double> > cc_3_var = new CellVariable<NDIM, double>("cc_3", 3);
+        Pointer<SideVariable<NDIM, double> > sc_1_var = new SideVariable<NDIM, double>("sc_1");
+        Pointer<SideVariable<NDIM, double> > sc_2_var = new SideVariable<NDIM, double>("sc_2", 2);
+        Pointer<CellVariable<NDIM, double> > cc_2_var = new CellVariable<NDIM, double>("cc_2", 2);
+        Pointer<SideVariable<NDIM, double> > sc_3_var = new SideVariable<NDIM, double>("sc_3", 3);
+
+        std::ofstream out;
+        if (SAMRAI_MPI::getRank() == 0) out.open("output");
+
+        test(out, "cell, depth 1, no control volume", patch_hierarchy, ctx, { { cc_1_var, -1 } });
+        test(out, "cell, depth 3", patch_hierarchy, ctx, { { cc_3_var, wgt_cc_idx } });
+        test(out, "side, depth 1", patch_hierarchy, ctx, { { sc_1_var, wgt_sc_idx } });
+        test(out, "side, depth 2", patch_hierarchy, ctx, { { sc_2_var, wgt_sc_idx } });
+        test(out,
+             "cell and side components",
+             patch_hierarchy,
+             ctx,
+             { { cc_2_var, wgt_cc_idx }, { sc_3_var, wgt_sc_idx } });
+    }
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,245 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/StaggeredStokesPhysicalBoundaryHelper.h>
+#include <ibamr/StaggeredStokesSolver.h>
+#include <ibamr/StaggeredStokesSolverManager.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/KrylovLinearSolver.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <CellVariable.h>
+#include <HierarchyCellDataOpsReal.h>
+#include <SideVariable.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify the box relaxation (Vanka-type) FAC preconditioner for the
+// time-dependent incompressible Stokes equations on a locally refined,
+// periodic grid: FGMRES preconditioned by StaggeredStokesBoxRelaxationFACOperator
+// must converge within a fixed number of iterations and agree with the
+// solution computed with the level relaxation FAC preconditioner.
+
+namespace
+{
+// Solve the Stokes system with an FGMRES solver that uses the given FAC
+// preconditioner. Return whether the solver converged and set n_iterations.
+bool
+solve(const std::string& precond_type,
+      Pointer<Database> input_db,
+      const PoissonSpecifications& U_problem_coefs,
+      Pointer<StaggeredStokesPhysicalBoundaryHelper> bc_helper,
+      Pointer<SAMRAIVectorReal<NDIM, double> > nul_vec,
+      SAMRAIVectorReal<NDIM, double>& x_vec,
+      SAMRAIVectorReal<NDIM, double>& b_vec,
+      int& n_iterations)
+{
+    Pointer<StaggeredStokesSolver> stokes_solver =
+        StaggeredStokesSolverManager::getManager()->allocateSolver("PETSC_KRYLOV_SOLVER",
+                                                                   "stokes_solver",
+                                                                   input_db->getDatabase("stokes_solver_db"),
+                                                                   "stokes_",
+                                                                   precond_type,
+                                                                   "stokes_precond",
+                                                                   input_db->getDatabase("stokes_precond_db"),
+                                                                   "stokes_pc_");
+    const std::vector<RobinBcCoefStrategy<NDIM>*> U_bc_coefs(NDIM, nullptr);
+    stokes_solver->setVelocityPoissonSpecifications(U_problem_coefs);
+    stokes_solver->setPhysicalBcCoefs(U_bc_coefs, nullptr);
+    stokes_solver->setPhysicalBoundaryHelper(bc_helper);
+    stokes_solver->setComponentsHaveNullspace(false, true);
+    Pointer<KrylovLinearSolver> krylov_solver = stokes_solver;
+    TBOX_ASSERT(krylov_solver);
+    krylov_solver->setInitialGuessNonzero(false);
+    krylov_solver->setNullspace(false, { nul_vec });
+    stokes_solver->initializeSolverState(x_vec, b_vec);
+    x_vec.setToScalar(0.0);
+    const bool converged = stokes_solver->solveSystem(x_vec, b_vec);
+    n_iterations = krylov_solver->getNumIterations();
+    stokes_solver->deallocateSolverState();
+    return converged;
+}
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "stokes_box_relaxation.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<SideVariable<NDIM, double> > u_sc_var = new SideVariable<NDIM, double>("u_sc");
+        Pointer<CellVariable<NDIM, double> > p_cc_var = new CellVariable<NDIM, double>("p_cc");
+        const int u_sc_idx = var_db->registerVariableAndContext(u_sc_var, ctx, IntVector<NDIM>(1));
+        const int p_cc_idx = var_db->registerVariableAndContext(p_cc_var, ctx, IntVector<NDIM>(1));
+        std::vector<int> u_sc_idxs, p_cc_idxs;
+        for (int k = 0; k < 5; ++k)
+        {
+            u_sc_idxs.push_back(var_db->registerClonedPatchDataIndex(u_sc_var, u_sc_idx));
+            p_cc_idxs.push_back(var_db->registerClonedPatchDataIndex(p_cc_var, p_cc_idx));
+        }
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (int k = 0; k < 5; ++k)
+            {
+                level->allocatePatchData(u_sc_idxs[k], 0.0);
+                level->allocatePatchData(p_cc_idxs[k], 0.0);
+            }
+        }
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        const std::vector<std::string> vec_names = { "b", "x_ref", "x", "d", "nul" };
+        std::vector<Pointer<SAMRAIVectorReal<NDIM, double> > > vecs;
+        for (int k = 0; k < 5; ++k)
+        {
+            vecs.push_back(new SAMRAIVectorReal<NDIM, double>(vec_names[k], patch_hierarchy, 0, finest_ln));
+            vecs[k]->addComponent(u_sc_var, u_sc_idxs[k], h_sc_idx);
+            vecs[k]->addComponent(p_cc_var, p_cc_idxs[k], h_cc_idx);
+        }
+        SAMRAIVectorReal<NDIM, double>& b_vec = *vecs[0];
+        SAMRAIVectorReal<NDIM, double>& x_ref_vec = *vecs[1];
+        SAMRAIVectorReal<NDIM, double>& x_vec = *vecs[2];
+        SAMRAIVectorReal<NDIM, double>& d_vec = *vecs[3];
+        Pointer<SAMRAIVectorReal<NDIM, double> > nul_vec = vecs[4];
+
+        // The momentum equation is forced by f and the divergence constraint is
+        // homogeneous. The pressure is only determined up to a constant.
+        b_vec.setToScalar(0.0);
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        f_fcn.setDataOnPatchHierarchy(u_sc_idxs[0], u_sc_var, patch_hierarchy, 0.0);
+        nul_vec->setToScalar(0.0);
+        HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(patch_hierarchy, 0, finest_ln);
+        hier_cc_data_ops.setToScalar(p_cc_idxs[4], 1.0);
+
+        PoissonSpecifications U_problem_coefs("U_problem_coefs");
+        U_problem_coefs.setCConstant(input_db->getDouble("RHO") / input_db->getDouble("DT"));
+        U_problem_coefs.setDConstant(-input_db->getDouble("MU"));
+        Pointer<StaggeredStokesPhysicalBoundaryHelper> bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
+        bc_helper->cacheBcCoefData(std::vector<RobinBcCoefStrategy<NDIM>*>(NDIM, nullptr), 0.0, patch_hierarchy);
+
+        int n_ref_iterations = 0, n_box_iterations = 0;
+        const bool ref_converged = solve("LEVEL_RELAXATION_FAC_PRECONDITIONER",
+                                         input_db,
+                                         U_problem_coefs,
+                                         bc_helper,
+                                         nul_vec,
+                                         x_ref_vec,
+                                         b_vec,
+                                         n_ref_iterations);
+        const bool box_converged = solve("BOX_RELAXATION_FAC_PRECONDITIONER",
+                                         input_db,
+                                         U_problem_coefs,
+                                         bc_helper,
+                                         nul_vec,
+                                         x_vec,
+                                         b_vec,
+                                         n_box_iterations);
+
+        // Compare the solutions up to a constant pressure.
+        d_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&x_vec, false),
+                       Pointer<SAMRAIVectorReal<NDIM, double> >(&x_ref_vec, false));
+        d_vec.axpy(-d_vec.dot(nul_vec) / nul_vec->dot(nul_vec),
+                   nul_vec,
+                   Pointer<SAMRAIVectorReal<NDIM, double> >(&d_vec, false));
+        const double tol = input_db->getDouble("tol");
+        const int max_box_iterations = input_db->getInteger("max_box_iterations");
+
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "level relaxation: converged: " << ref_converged << "\n";
+            out << "box relaxation: converged: " << box_converged << "\n";
+            out << "box relaxation: converged within " << max_box_iterations
+                << " iterations: " << (n_box_iterations <= max_box_iterations) << "\n";
+            out << "box relaxation: solution agrees with level relaxation: "
+                << (d_vec.maxNorm() <= tol * x_ref_vec.maxNorm()) << "\n";
+        }
+        bc_helper->clearBcCoefData();
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
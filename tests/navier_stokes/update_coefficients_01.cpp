@@ -0,0 +1,160 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <HierarchyCellDataOpsReal.h>
+#include <HierarchySideDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify that INSStaggeredHierarchyIntegrator gives the same results when the
+// time step size changes every step and the solvers are updated in place with
+// updateProblemCoefficients() as when every solver is reinitialized from
+// scratch. The same problem is solved twice, each time on its own hierarchy.
+
+namespace
+{
+// Advance the Navier-Stokes equations with a time step size that alternates
+// between DT and DT_RATIO * DT. Return the L2 norms of the velocity and the
+// pressure after every step.
+std::vector<double>
+run(const std::string& name, Pointer<AppInitializer> app_initializer, const bool reinitialize_solvers)
+{
+    Pointer<Database> input_db = app_initializer->getInputDatabase();
+    Pointer<INSStaggeredHierarchyIntegrator> time_integrator = new INSStaggeredHierarchyIntegrator(
+        name + "::INSStaggeredHierarchyIntegrator",
+        app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"),
+        false);
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+        name + "::CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+        new PatchHierarchy<NDIM>(name + "::PatchHierarchy", grid_geometry);
+    Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+        new StandardTagAndInitialize<NDIM>(name + "::StandardTagAndInitialize",
+                                           time_integrator,
+                                           app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+    Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+    Pointer<LoadBalancer<NDIM> > load_balancer =
+        new LoadBalancer<NDIM>(name + "::LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+    Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+        new GriddingAlgorithm<NDIM>(name + "::GriddingAlgorithm",
+                                    app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                    error_detector,
+                                    box_generator,
+                                    load_balancer);
+
+    Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+        name + "::u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+    time_integrator->registerVelocityInitialConditions(u_init);
+    Pointer<CartGridFunction> p_init = new muParserCartGridFunction(
+        name + "::p_init", app_initializer->getComponentDatabase("PressureInitialConditions"), grid_geometry);
+    time_integrator->registerPressureInitialConditions(p_init);
+
+    time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int u_idx = var_db->mapVariableAndContextToIndex(time_integrator->getVelocityVariable(),
+                                                           time_integrator->getCurrentContext());
+    const int p_idx = var_db->mapVariableAndContextToIndex(time_integrator->getPressureVariable(),
+                                                           time_integrator->getCurrentContext());
+
+    const double dt = input_db->getDouble("DT");
+    const double dt_ratio = input_db->getDouble("DT_RATIO");
+    const int num_steps = input_db->getInteger("NUM_STEPS");
+    std::vector<double> norms;
+    for (int step = 0; step < num_steps; ++step)
+    {
+        if (reinitialize_solvers)
+        {
+            time_integrator->setStokesSolverNeedsInit();
+            time_integrator->setVelocitySubdomainSolverNeedsInit();
+            time_integrator->setPressureSubdomainSolverNeedsInit();
+        }
+        time_integrator->advanceHierarchy(step % 2 == 0 ? dt : dt_ratio * dt);
+
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        HierarchyMathOps hier_math_ops(name + "::HierarchyMathOps", patch_hierarchy);
+        HierarchySideDataOpsReal<NDIM, double> hier_sc_data_ops(patch_hierarchy, 0, finest_ln);
+        HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(patch_hierarchy, 0, finest_ln);
+        norms.push_back(hier_sc_data_ops.L2Norm(u_idx, hier_math_ops.getSideWeightPatchDescriptorIndex()));
+        norms.push_back(hier_cc_data_ops.L2Norm(p_idx, hier_math_ops.getCellWeightPatchDescriptorIndex()));
+    }
+    return norms;
+}
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "INS.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        const std::vector<double> updated_norms = run("updated", app_initializer, false);
+        const std::vector<double> reinitialized_norms = run("reinitialized", app_initializer, true);
+
+        const double tol = input_db->getDouble("TOL");
+        bool norms_agree = updated_norms.size() == reinitialized_norms.size();
+        for (std::size_t k = 0; norms_agree && k < updated_norms.size(); ++k)
+        {
+            norms_agree = std::abs(updated_norms[k] - reinitialized_norms[k]) <=
+                          tol * std::max(std::abs(reinitialized_norms[k]), 1.0);
+        }
+
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "number of time steps: " << updated_norms.size() / 2 << '\n';
+            out << "updated and reinitialized solvers agree: " << norms_agree << '\n';
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main